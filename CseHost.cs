@@ -0,0 +1,12 @@
+using System.Runtime.CompilerServices;
+
+namespace Cse
+{
+    // Add this file to a script to send results back to the executor (read them with results_read).
+    // The methods are bound to the executor by name, don't rename the namespace, class or methods.
+    public static class CseHost
+    {
+        [MethodImpl(MethodImplOptions.InternalCall)]
+        public static extern void Emit(string key, byte[] payload);
+    }
+}
\ No newline at end of file
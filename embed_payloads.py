@@ -0,0 +1,137 @@
+import argparse
+import hashlib
+import os
+import re
+import struct
+
+# Packs assemblies for embedding into the executor as RCDATA resources.
+# Each payload is written as a packed blob (16 byte "CSEZ" header, see BlobHeader in compression.hpp),
+# optionally LZ4 compressed, and listed in a generated manifest header together with its SHA-256.
+
+BLOB_MAGIC = 0x5A455343
+CODEC_NONE = 0
+CODEC_LZ4 = 1
+
+MIN_MATCH = 4
+LAST_LITERALS = 5
+MF_LIMIT = 12
+MAX_OFFSET = 65535
+
+
+def write_length(out, length):
+    while length >= 255:
+        out.append(255)
+        length -= 255
+    out.append(length)
+
+
+def write_sequence(out, literals, match_length, offset):
+    lit_len = len(literals)
+    token = min(lit_len, 15) << 4
+    if match_length is not None:
+        token |= min(match_length - MIN_MATCH, 15)
+    out.append(token)
+
+    if lit_len >= 15:
+        write_length(out, lit_len - 15)
+    out += literals
+
+    if match_length is not None:
+        out += struct.pack("<H", offset)
+        if match_length - MIN_MATCH >= 15:
+            write_length(out, match_length - MIN_MATCH - 15)
+
+
+# greedy LZ4 block compressor, same format the executor's lz4::Decompress reads
+def lz4_compress(data):
+    out = bytearray()
+    table = {}
+    anchor = 0
+    pos = 0
+    limit = len(data) - MF_LIMIT
+
+    while pos < limit:
+        key = data[pos:pos + 4]
+        candidate = table.get(key)
+        table[key] = pos
+
+        if candidate is None or pos - candidate > MAX_OFFSET:
+            pos += 1
+            continue
+
+        match_end = pos + 4
+        end = len(data) - LAST_LITERALS
+        while match_end < end and data[match_end] == data[candidate + match_end - pos]:
+            match_end += 1
+
+        write_sequence(out, data[anchor:pos], match_end - pos, pos - candidate)
+        pos = match_end
+        anchor = pos
+
+    write_sequence(out, data[anchor:], None, 0)
+    return bytes(out)
+
+
+def pack_blob(data, compress):
+    codec = CODEC_NONE
+    body = data
+
+    if compress:
+        compressed = lz4_compress(data)
+        # not worth the decode when it doesn't shrink, same rule as PackBlob
+        if len(compressed) < len(data):
+            codec = CODEC_LZ4
+            body = compressed
+
+    return struct.pack("<IB3xQ", BLOB_MAGIC, codec, len(data)) + body, codec
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Packs assemblies into RCDATA resources and a manifest header")
+    parser.add_argument("--output-dir", required=True)
+    parser.add_argument("payloads", nargs="+", metavar="NAME=PATH[:lz4]")
+    args = parser.parse_args()
+
+    os.makedirs(args.output_dir, exist_ok=True)
+
+    entries = []
+    for spec in args.payloads:
+        name, _, path = spec.partition("=")
+        compress = False
+        if path.endswith(":lz4"):
+            path = path[:-4]
+            compress = True
+
+        if not re.fullmatch(r"[A-Za-z_][A-Za-z0-9_]*", name):
+            parser.error(f"invalid payload name: {name}")
+
+        with open(path, "rb") as f:
+            data = f.read()
+
+        blob, codec = pack_blob(data, compress)
+        blob_path = os.path.join(args.output_dir, f"{name}.blob")
+        with open(blob_path, "wb") as f:
+            f.write(blob)
+
+        entries.append((name, hashlib.sha256(data).digest(), len(data), len(blob), codec, blob_path))
+        print(f"Embedded {name}: {len(data)} bytes, {len(blob)} stored ({'lz4' if codec == CODEC_LZ4 else 'none'})")
+
+    resource_id = lambda name: f"CSE_PAYLOAD_{name.upper()}"
+
+    with open(os.path.join(args.output_dir, "payloads.rc"), "w") as f:
+        for name, _, _, _, _, blob_path in entries:
+            f.write(f"{resource_id(name)} RCDATA \"{os.path.abspath(blob_path).replace(os.sep, '/')}\"\n")
+
+    with open(os.path.join(args.output_dir, "embedded_manifest.h"), "w") as f:
+        f.write("#pragma once\n")
+        f.write("// generated by embed_payloads.py\n")
+        f.write("#include <array>\n\n")
+        f.write(f"inline constexpr std::array<cse::EmbeddedManifestEntry, {len(entries)}> CSE_EMBEDDED_MANIFEST = {{ {{\n")
+        for name, digest, size, stored, codec, _ in entries:
+            hash_bytes = ", ".join(f"0x{b:02X}" for b in digest)
+            f.write(f"    {{ \"{name}\", \"{resource_id(name)}\", {size}, {stored}, {{ {hash_bytes} }} }},\n")
+        f.write("} };\n")
+
+
+if __name__ == "__main__":
+    main()
\ No newline at end of file
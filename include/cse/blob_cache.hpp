@@ -0,0 +1,53 @@
+#pragma once
+#include <cse/hash.hpp>
+#include <cse/compression.hpp>
+#include <vector>
+#include <list>
+#include <mutex>
+#include <unordered_map>
+
+namespace cse
+{
+    /**
+     * @brief In-process cache of recently executed payloads, keyed by SHA-256 of the raw bytes.
+     * Blobs are kept LZ4 packed (PackBlob), the least recently used are dropped once the budget is exceeded.
+     */
+    class BlobCache
+    {
+    private:
+        struct Entry
+        {
+            Hash256 m_Hash;
+            std::vector<uint8_t> m_Blob;
+        };
+
+        std::mutex m_Mutex;
+        std::list<Entry> m_Entries; // front = most recently used
+        std::unordered_map<Hash256, std::list<Entry>::iterator, Hash256Hasher> m_Index;
+
+        size_t m_Bytes = 0;
+        size_t m_Budget = 256 * 1024 * 1024;
+
+    public:
+        static BlobCache& GetInstance();
+
+        /**
+         * @brief Stores the raw bytes (if not already present) and returns their hash.
+         */
+        Hash256 Put(std::span<const uint8_t> data);
+        void Put(const Hash256& hash, std::span<const uint8_t> data);
+
+        bool Contains(const Hash256& hash);
+
+        /**
+         * @brief Returns the uncompressed bytes for a hash, or nullopt if they were never stored or got evicted.
+         */
+        std::optional<std::vector<uint8_t>> Get(const Hash256& hash);
+
+        void SetBudget(size_t bytes);
+        size_t GetSize();
+
+    private:
+        void Evict();
+    };
+}
\ No newline at end of file
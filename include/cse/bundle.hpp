@@ -0,0 +1,105 @@
+#pragma once
+#include <cse/hash.hpp>
+#include <cse/compression.hpp>
+#include <cse/metadata.hpp>
+#include <cstdint>
+#include <optional>
+#include <span>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace cse
+{
+    /**
+     * Several assemblies in one file: 16 byte header, fixed size index entries,
+     * then one packed blob (see PackBlob) per image and pdb.
+     */
+    struct BundleHeader
+    {
+        static constexpr uint32_t MAGIC = 0x42455343; // "CSEB"
+        static constexpr uint16_t VERSION = 1;
+
+        uint32_t m_Magic;
+        uint16_t m_Version;
+        uint16_t m_Count;
+        uint64_t m_Reserved;
+    };
+    static_assert(sizeof(BundleHeader) == 16);
+
+    struct BundleIndexEntry
+    {
+        // SHA-256 of the uncompressed image
+        Hash256 m_Hash;
+
+        // packed blobs, offsets from the start of the bundle, m_PdbLength is 0 without a pdb
+        uint64_t m_Offset;
+        uint64_t m_Length;
+        uint64_t m_PdbOffset;
+        uint64_t m_PdbLength;
+
+        // informational, loading goes by the names in the images' metadata
+        char m_Name[64];
+    };
+    static_assert(sizeof(BundleIndexEntry) == 128);
+
+    struct BundleEntry
+    {
+        std::string_view m_Name;
+        Hash256 m_Hash;
+        Payload m_Image;
+        std::optional<Payload> m_Pdb;
+    };
+
+    struct BundleInput
+    {
+        std::string m_Name;
+        std::span<const uint8_t> m_Image;
+        std::span<const uint8_t> m_Pdb;
+    };
+
+    enum class BundleEntryStatus
+    {
+        Loaded,
+        // an assembly with the same name already lives in the domain
+        AlreadyLoaded,
+        Failed,
+        // not attempted because an earlier entry failed
+        Skipped,
+    };
+
+    const char* BundleEntryStatusName(BundleEntryStatus status);
+
+    struct BundleEntryResult
+    {
+        std::string m_Name;
+        std::string m_Version;
+        Hash256 m_Hash;
+        BundleEntryStatus m_Status = BundleEntryStatus::Skipped;
+    };
+
+    struct BundleResult
+    {
+        bool m_Success = false;
+        std::string m_Error;
+
+        // in load order, dependencies first
+        std::vector<BundleEntryResult> m_Entries;
+    };
+
+    bool IsBundle(std::span<const uint8_t> data);
+
+    /**
+     * @brief Views the entries of a bundle without copying or decoding them.
+     */
+    std::optional<std::vector<BundleEntry>> ReadBundle(std::span<const uint8_t> data, const char** error = nullptr);
+
+    std::vector<uint8_t> WriteBundle(std::span<const BundleInput> inputs, Codec codec);
+
+    /**
+     * @brief Orders assemblies so that every one comes after the bundle members it references.
+     * References to assemblies outside the set are ignored, ties keep the input order.
+     * @return Indices into assemblies, nullopt if the references form a cycle.
+     */
+    std::optional<std::vector<size_t>> OrderByReferences(std::span<const AssemblyMetadata> assemblies);
+}
\ No newline at end of file
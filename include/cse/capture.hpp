@@ -0,0 +1,118 @@
+#pragma once
+#include <cse/mono.hpp>
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <string>
+#include <vector>
+
+namespace cse
+{
+    enum class OutputStream : uint8_t
+    {
+        Out,
+        Error,
+    };
+
+    const char* OutputStreamName(OutputStream stream);
+
+    struct CapturedChunk
+    {
+        uint64_t m_Sequence;
+
+        // microseconds since capture was first enabled
+        uint64_t m_Timestamp;
+
+        // latest execution in the writing domain when the chunk was drained
+        uint64_t m_Execution;
+        std::string m_Resource;
+        OutputStream m_Stream;
+
+        // UTF-8, converted from the UTF-16 the writer produced when read
+        std::string m_Text;
+    };
+
+    struct CaptureBatch
+    {
+        std::vector<CapturedChunk> m_Chunks;
+
+        // pass back to continue after the last chunk
+        uint64_t m_Cursor = 0;
+
+        // bytes overwritten before this reader got to them
+        uint64_t m_Skipped = 0;
+    };
+
+    struct CaptureFilter
+    {
+        // 0 for all
+        uint64_t m_Execution = 0;
+
+        // empty for all
+        std::string m_Resource;
+    };
+
+    struct CaptureStats
+    {
+        bool m_Enabled = false;
+        size_t m_Domains = 0;
+
+        uint64_t m_Chunks = 0;
+        uint64_t m_Bytes = 0;
+
+        // ring position, bytes ever written including headers
+        uint64_t m_Written = 0;
+    };
+
+    /**
+     * @brief Captures Console.Out and Console.Error of domains the executor ran scripts in.
+     *
+     * Each domain's writers are replaced with StreamWriters over a native pipe (UTF-16LE, no BOM, auto flush),
+     * so writing costs one WriteFile instead of console rendering. A drain thread per domain appends the UTF-16
+     * chunks to one process wide lock-free ring, readers keep their own cursor and old chunks are overwritten once it is full.
+     *
+     * The writers stay replaced for the whole domain until capture is turned off or the domain unloads, so everything
+     * the resource itself prints is captured too and tagged with the domain's latest execution.
+     */
+    class OutputCapture
+    {
+    private:
+        struct Impl;
+        std::unique_ptr<Impl> m_Impl;
+
+    public:
+        // bytes for all domains, allocated when capture is first enabled
+        static constexpr size_t RING_CAPACITY = 1 << 22;
+
+        static OutputCapture& GetInstance();
+
+        /**
+         * @brief Turning capture off gives every hooked domain its original writers back.
+         */
+        void SetEnabled(bool enabled);
+        bool IsEnabled();
+
+        /**
+         * @brief Hooks domain's writers if capture is on and they aren't yet, later output is tagged with execution.
+         * Requires a thread attached to domain.
+         */
+        void Attach(MonoDomain* domain, uint64_t execution, const std::string& resource);
+
+        /**
+         * @brief Drops the hook of an unloaded domain, ending its drain threads. Its chunks stay readable.
+         */
+        void Detach(int32_t domainId);
+
+        /**
+         * @brief Copies chunks starting at cursor, waiting up to wait for the first one.
+         */
+        CaptureBatch Read(uint64_t cursor, size_t maxBytes, const CaptureFilter& filter, std::chrono::milliseconds wait = {});
+
+        CaptureStats GetStats();
+
+    private:
+        OutputCapture();
+        ~OutputCapture();
+    };
+}
\ No newline at end of file
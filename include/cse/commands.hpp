@@ -0,0 +1,138 @@
+#pragma once
+#include <cstdint>
+#include <chrono>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <functional>
+#include <type_traits>
+#include <nlohmann/json.hpp>
+#include <cse/scheduler.hpp>
+
+namespace cse
+{
+    // FNV-1a, evaluated at compile time for registered names and at runtime for incoming "cmd" strings
+    constexpr uint32_t HashCommandName(std::string_view name)
+    {
+        uint32_t hash = 2166136261u;
+        for (char c : name)
+        {
+            hash ^= static_cast<uint8_t>(c);
+            hash *= 16777619u;
+        }
+
+        return hash;
+    }
+
+    struct CommandId
+    {
+        uint32_t m_Hash;
+        std::string_view m_Name;
+    };
+
+    consteval CommandId operator""_cmd(const char* name, size_t length)
+    {
+        return CommandId{ HashCommandName(std::string_view(name, length)), std::string_view(name, length) };
+    }
+
+    enum class ExecutionPolicy
+    {
+        // run on the IPC client thread, for cheap calls
+        Inline,
+
+        // run on the scheduler's workers
+        WorkerPool,
+
+        // run on the scheduler's workers, but serialized per value of the request's queue key (usually "resource")
+        DomainQueue,
+    };
+
+    // scheduler serial key of a resource's domain queue, anything submitted under it runs one at a time with its executions
+    inline std::string DomainQueueKey(std::string_view resource)
+    {
+        return std::string("domain:").append(resource);
+    }
+
+    struct CommandPolicy
+    {
+        ExecutionPolicy m_Policy = ExecutionPolicy::Inline;
+
+        // scheduler class for WorkerPool/DomainQueue commands
+        PriorityClass m_Priority = PriorityClass::Interactive;
+
+        // max invocations of this command in flight at once, 0 = unlimited
+        uint32_t m_MaxConcurrency = 0;
+
+        // how long the caller waits for a queued command, 0 = forever. A command still queued then is withdrawn and the caller
+        // gets { "error": "timeout" }, a running one replies { "status": "running", "pending": id } for PollPending
+        std::chrono::milliseconds m_Timeout{ 0 };
+
+        // request field selecting the queue for ExecutionPolicy::DomainQueue
+        const char* m_QueueKey = "resource";
+    };
+
+    using CommandHandler = std::function<nlohmann::json(const nlohmann::json&)>;
+
+    /**
+     * @brief Table of IPC commands, keyed by the hash of their name.
+     * Each command declares how it is scheduled instead of running wherever the request arrived.
+     */
+    class CommandRegistry
+    {
+    private:
+        struct Impl;
+        std::unique_ptr<Impl> m_Impl;
+
+    public:
+        // replies of timed out commands kept for polling
+        static constexpr size_t MAX_PENDING = 64;
+
+        static CommandRegistry& GetInstance();
+
+        /**
+         * @brief Registers a handler taking a typed request.
+         * The request is decoded with nlohmann's from_json for Request, a decode failure is reported as an error reply.
+         * Use nlohmann::json as Request to get the raw request.
+         */
+        template <typename Request>
+        void Register(CommandId id, CommandPolicy policy, std::function<nlohmann::json(const Request&)> handler)
+        {
+            RegisterHandler(id, policy, [handler = std::move(handler)](const nlohmann::json& request) -> nlohmann::json
+            {
+                if constexpr (std::is_same_v<Request, nlohmann::json>)
+                {
+                    return handler(request);
+                }
+                else
+                {
+                    return handler(request.get<Request>());
+                }
+            });
+        }
+
+        /**
+         * @brief Looks up the request's "cmd" and runs it according to its policy, blocking until there is a reply.
+         * @param clientId Identifies the IPC client for fair scheduling.
+         */
+        nlohmann::json Dispatch(const nlohmann::json& request, uint64_t clientId = 0);
+
+        /**
+         * @brief Id of the client whose command is running on the calling thread, 0 outside of commands.
+         */
+        static uint64_t CurrentClientId();
+
+        /**
+         * @brief Reply of a command that was still running when its caller timed out, taken once it is done.
+         * @return { "status": "running", "pending": id } until then.
+         */
+        nlohmann::json PollPending(uint64_t id);
+
+        void Shutdown();
+
+    private:
+        CommandRegistry();
+        ~CommandRegistry();
+
+        void RegisterHandler(CommandId id, CommandPolicy policy, CommandHandler handler);
+    };
+}
\ No newline at end of file
@@ -0,0 +1,94 @@
+#pragma once
+#include <cse/hash.hpp>
+#include <cse/mapped_file.hpp>
+#include <chrono>
+#include <cstdint>
+#include <filesystem>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace cse
+{
+    struct CompilerOptions
+    {
+        // csc.exe or mcs, empty picks the .NET Framework csc found next to the system
+        std::filesystem::path m_Compiler;
+
+        // passed as /reference: to every compilation before the request's own, e.g. CitizenFX.Core.Client.dll
+        std::vector<std::string> m_References;
+
+        // compiled assemblies, keyed by their cache key
+        std::filesystem::path m_CacheDirectory;
+
+        std::chrono::milliseconds m_Timeout{ 30000 };
+    };
+
+    struct CompileRequest
+    {
+        std::string m_Source;
+        std::vector<std::string> m_References;
+
+        // extra compiler arguments, e.g. "/optimize+" or "/define:DEBUG", anything outside a small allowlist fails the compilation
+        std::vector<std::string> m_Arguments;
+
+        // a portable PDB with Roslyn's csc or mcs, the Framework csc gets /debug:full and its Windows PDB isn't returned
+        bool m_Debug = false;
+    };
+
+    struct CompileResult
+    {
+        bool m_Success = false;
+
+        // the image was already in the cache, the compiler never ran
+        bool m_Cached = false;
+
+        // hash of compiler, source, references and arguments
+        Hash256 m_Key{};
+
+        // compiler output, warnings included
+        std::string m_Output;
+        int m_ExitCode = 0;
+
+        double m_CompileMs = 0;
+
+        std::unique_ptr<MappedFile> m_Image;
+        std::unique_ptr<MappedFile> m_Pdb;
+    };
+
+    struct CompilerStats
+    {
+        uint64_t m_Compiled = 0;
+        uint64_t m_Hits = 0;
+        uint64_t m_Failed = 0;
+    };
+
+    /**
+     * @brief Compiles C# source with an external compiler process.
+     * Images are kept in the cache directory under their cache key, unchanged snippets are never compiled twice.
+     */
+    class SourceCompiler
+    {
+    private:
+        std::mutex m_Mutex;
+        CompilerOptions m_Options;
+
+        CompilerStats m_Stats;
+
+    public:
+        static SourceCompiler& GetInstance();
+
+        void SetOptions(CompilerOptions options);
+        CompilerOptions GetOptions();
+
+        CompileResult Compile(const CompileRequest& request);
+        CompilerStats GetStats();
+
+    private:
+        SourceCompiler() = default;
+
+        // options with the default compiler and cache directory filled in
+        CompilerOptions ResolvedOptions();
+    };
+}
\ No newline at end of file
@@ -0,0 +1,89 @@
+#pragma once
+#include <cstdint>
+#include <cstddef>
+#include <span>
+#include <vector>
+#include <optional>
+#include <string_view>
+#include <functional>
+
+namespace cse
+{
+    enum class Codec : uint8_t
+    {
+        None = 0,
+        // LZ4 block format, compatible with LZ4_compress_default / LZ4_decompress_safe
+        Lz4 = 1,
+    };
+
+    const char* CodecName(Codec codec);
+    std::optional<Codec> CodecFromName(std::string_view name);
+
+    // largest uncompressed payload accepted, sizes are claimed by clients and blob headers and allocated before decoding
+    inline constexpr size_t MAX_PAYLOAD_SIZE = 64 * 1024 * 1024;
+
+    /**
+     * @brief Bytes handed to the executor, optionally still compressed.
+     * Compressed payloads are decoded straight into their final destination (e.g. a managed byte[]),
+     * so the uncompressed image never exists in an intermediate native buffer.
+     */
+    struct Payload
+    {
+        std::span<const uint8_t> m_Data;
+        Codec m_Codec = Codec::None;
+
+        // uncompressed size, equal to m_Data.size() for Codec::None
+        size_t m_Size = 0;
+
+        // custom source (e.g. a delta rebuilt against a cached base), takes precedence over m_Data/m_Codec
+        std::function<bool(std::span<uint8_t>)> m_Producer;
+
+        Payload() = default;
+        Payload(std::span<const uint8_t> data) : m_Data(data), m_Size(data.size()) {}
+        Payload(const std::vector<uint8_t>& data) : Payload(std::span<const uint8_t>(data)) {}
+        Payload(std::span<const uint8_t> data, Codec codec, size_t size) : m_Data(data), m_Codec(codec), m_Size(size) {}
+
+        /**
+         * @brief Writes the uncompressed bytes into dst, which must be exactly m_Size bytes long.
+         * @return false if the payload is corrupt or doesn't decode to m_Size bytes.
+         */
+        bool DecodeInto(std::span<uint8_t> dst) const;
+
+        /**
+         * @brief Whether m_Size is at most MAX_PAYLOAD_SIZE and something m_Data can decode to, checked before allocating m_Size bytes.
+         */
+        bool HasValidSize() const;
+
+        std::vector<uint8_t> Decode() const;
+    };
+
+    size_t CompressBound(Codec codec, size_t size);
+    std::vector<uint8_t> Compress(Codec codec, std::span<const uint8_t> data);
+
+    /**
+     * @brief Decompresses src into dst, dst must be exactly the uncompressed size.
+     */
+    bool Decompress(Codec codec, std::span<const uint8_t> src, std::span<uint8_t> dst);
+
+    /**
+     * Self-describing blob used for payloads at rest (files, caches):
+     * 16 byte header followed by the (possibly compressed) data.
+     */
+    struct BlobHeader
+    {
+        static constexpr uint32_t MAGIC = 0x5A455343; // "CSEZ"
+
+        uint32_t m_Magic;
+        uint8_t m_Codec;
+        uint8_t m_Reserved[3];
+        uint64_t m_Size;
+    };
+    static_assert(sizeof(BlobHeader) == 16);
+
+    std::vector<uint8_t> PackBlob(std::span<const uint8_t> data, Codec codec);
+
+    /**
+     * @brief Views a packed blob without copying. Returns nullopt if data isn't a packed blob.
+     */
+    std::optional<Payload> UnpackBlob(std::span<const uint8_t> data);
+}
\ No newline at end of file
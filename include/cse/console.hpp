@@ -5,5 +5,6 @@ namespace cse
 {
     std::function<void()> init_console();
 
+    // formats on the caller and queues the line for the logger thread, see log.hpp for deferred formatting
     void println(const char* fmt, ...);
 }
\ No newline at end of file
@@ -0,0 +1,57 @@
+#pragma once
+#include <cstdint>
+#include <span>
+#include <vector>
+#include <optional>
+
+namespace cse
+{
+    /**
+     * rsync-style deltas: the executor publishes block signatures of an assembly it holds,
+     * the client matches them against its new build and sends only copy/literal instructions
+     * (compute_delta in ipc_load.py produces them).
+     */
+
+    constexpr size_t DELTA_DEFAULT_BLOCK_SIZE = 2048;
+
+    // block sizes accepted from clients, smaller ones make the signature list bigger than the image
+    constexpr size_t DELTA_MIN_BLOCK_SIZE = 64;
+    constexpr size_t DELTA_MAX_BLOCK_SIZE = 64 * 1024;
+
+    struct BlockSignature
+    {
+        // rolling adler-style checksum, cheap to slide one byte at a time
+        uint32_t m_Weak;
+
+        // first 8 bytes of the block's SHA-256, checked only when the weak checksum matches
+        uint64_t m_Strong;
+    };
+
+    struct DeltaOp
+    {
+        // copy: m_Count base blocks starting at m_Block, literal: m_Count == 0 and the bytes in m_Literal
+        uint32_t m_Block = 0;
+        uint32_t m_Count = 0;
+        std::vector<uint8_t> m_Literal;
+
+        bool IsCopy() const { return m_Count != 0; }
+    };
+
+    uint32_t WeakChecksum(std::span<const uint8_t> block);
+    uint64_t StrongChecksum(std::span<const uint8_t> block);
+
+    /**
+     * @brief Signs every block of data, the last block may be shorter than blockSize.
+     */
+    std::vector<BlockSignature> ComputeSignatures(std::span<const uint8_t> data, size_t blockSize);
+
+    /**
+     * @brief Size of the image the ops rebuild, nullopt if they reference blocks outside the base.
+     */
+    std::optional<size_t> DeltaOutputSize(size_t baseSize, size_t blockSize, std::span<const DeltaOp> ops);
+
+    /**
+     * @brief Rebuilds the image into dst, which must be exactly DeltaOutputSize bytes long.
+     */
+    bool ApplyDelta(std::span<const uint8_t> base, size_t blockSize, std::span<const DeltaOp> ops, std::span<uint8_t> dst);
+}
\ No newline at end of file
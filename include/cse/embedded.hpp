@@ -0,0 +1,65 @@
+#pragma once
+#include <cse/hash.hpp>
+#include <cse/compression.hpp>
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <span>
+#include <string_view>
+#include <vector>
+
+namespace cse
+{
+    // one line of the manifest generated by embed_payloads.py
+    struct EmbeddedManifestEntry
+    {
+        const char* m_Name;
+        const char* m_ResourceId;
+        uint64_t m_Size;
+        uint64_t m_StoredSize;
+        Hash256 m_Hash;
+    };
+
+    struct EmbeddedPayloadInfo
+    {
+        std::string_view m_Name;
+        Hash256 m_Hash;
+        uint64_t m_Size;
+        uint64_t m_StoredSize;
+        Codec m_Codec;
+        bool m_Decoded;
+    };
+
+    /**
+     * @brief Assemblies linked into the executor as RCDATA resources (see embed_payloads.py).
+     *
+     * The resources are read in place from the loaded image. Uncompressed payloads are never copied,
+     * compressed ones are decoded once, on first use. Each payload is checked against its manifest hash when first located.
+     */
+    class EmbeddedPayloads
+    {
+    private:
+        struct Impl;
+        std::unique_ptr<Impl> m_Impl;
+
+    public:
+        static EmbeddedPayloads& GetInstance();
+
+        /**
+         * @brief Raw bytes of a payload, decompressing it on the first call.
+         * @return nullopt if there is no such payload or its resource is missing, damaged or doesn't match the manifest hash.
+         */
+        std::optional<std::span<const uint8_t>> Get(std::string_view name);
+
+        /**
+         * @brief Payload view over the stored resource, for decoding straight into a managed array without the cached copy.
+         */
+        std::optional<Payload> GetPayload(std::string_view name);
+
+        std::vector<EmbeddedPayloadInfo> List();
+
+    private:
+        EmbeddedPayloads();
+        ~EmbeddedPayloads();
+    };
+}
\ No newline at end of file
@@ -1,6 +1,15 @@
 #pragma once
+#include <cstdint>
+#include <span>
 
 namespace cse
 {
     void entrypoint();
+
+    // keeps the dll loaded for the rest of the process, for code that can still be reached once entrypoint returned
+    void pin_module(const char* reason);
+    bool is_module_pinned();
+
+    // the "executed" payload embedded into the executor, empty if it is missing
+    std::span<const uint8_t> embedded_script();
 }
\ No newline at end of file
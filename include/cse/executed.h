@@ -1,677 +0,0 @@
-#pragma once
-
-const unsigned char executed[] = {
-    0x4D, 0x5A, 0x90, 0x00, 0x03, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00,
-    0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00,
-    0x0E, 0x1F, 0xBA, 0x0E, 0x00, 0xB4, 0x09, 0xCD, 0x21, 0xB8, 0x01, 0x4C, 0xCD, 0x21, 0x54, 0x68,
-    0x69, 0x73, 0x20, 0x70, 0x72, 0x6F, 0x67, 0x72, 0x61, 0x6D, 0x20, 0x63, 0x61, 0x6E, 0x6E, 0x6F,
-    0x74, 0x20, 0x62, 0x65, 0x20, 0x72, 0x75, 0x6E, 0x20, 0x69, 0x6E, 0x20, 0x44, 0x4F, 0x53, 0x20,
-    0x6D, 0x6F, 0x64, 0x65, 0x2E, 0x0D, 0x0D, 0x0A, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x50, 0x45, 0x00, 0x00, 0x4C, 0x01, 0x03, 0x00, 0x5A, 0xA1, 0x59, 0xAC, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x22, 0x20, 0x0B, 0x01, 0x30, 0x00, 0x00, 0x22, 0x00, 0x00,
-    0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7A, 0x41, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00,
-    0x00, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x20, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00,
-    0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xA0, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x60, 0x85,
-    0x00, 0x00, 0x10, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x10, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x26, 0x41, 0x00, 0x00, 0x4F, 0x00, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0xB8, 0x03, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x80, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x88, 0x33, 0x00, 0x00, 0x70, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x20, 0x00, 0x00, 0x48, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2E, 0x74, 0x65, 0x78, 0x74, 0x00, 0x00, 0x00,
-    0x80, 0x21, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x60,
-    0x2E, 0x72, 0x73, 0x72, 0x63, 0x00, 0x00, 0x00, 0xB8, 0x03, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00,
-    0x00, 0x04, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x40, 0x2E, 0x72, 0x65, 0x6C, 0x6F, 0x63, 0x00, 0x00,
-    0x0C, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x42,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x5A, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x00, 0x00, 0x00, 0x02, 0x00, 0x05, 0x00,
-    0x08, 0x24, 0x00, 0x00, 0x80, 0x0F, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x1E, 0x02, 0x7B, 0x14, 0x00, 0x00, 0x0A, 0x2A, 0x1E, 0x02, 0x7B, 0x15, 0x00, 0x00, 0x0A, 0x2A,
-    0x56, 0x02, 0x28, 0x16, 0x00, 0x00, 0x0A, 0x02, 0x03, 0x7D, 0x14, 0x00, 0x00, 0x0A, 0x02, 0x04,
-    0x7D, 0x15, 0x00, 0x00, 0x0A, 0x2A, 0x00, 0x00, 0x13, 0x30, 0x03, 0x00, 0x43, 0x00, 0x00, 0x00,
-    0x01, 0x00, 0x00, 0x11, 0x03, 0x75, 0x01, 0x00, 0x00, 0x1B, 0x0A, 0x02, 0x06, 0x2E, 0x36, 0x06,
-    0x2C, 0x30, 0x28, 0x17, 0x00, 0x00, 0x0A, 0x02, 0x7B, 0x14, 0x00, 0x00, 0x0A, 0x06, 0x7B, 0x14,
-    0x00, 0x00, 0x0A, 0x6F, 0x18, 0x00, 0x00, 0x0A, 0x2C, 0x18, 0x28, 0x19, 0x00, 0x00, 0x0A, 0x02,
-    0x7B, 0x15, 0x00, 0x00, 0x0A, 0x06, 0x7B, 0x15, 0x00, 0x00, 0x0A, 0x6F, 0x1A, 0x00, 0x00, 0x0A,
-    0x2B, 0x01, 0x16, 0x2B, 0x01, 0x17, 0x2A, 0xD2, 0x20, 0x1A, 0x00, 0xAA, 0x04, 0x20, 0x29, 0x55,
-    0x55, 0xA5, 0x5A, 0x28, 0x17, 0x00, 0x00, 0x0A, 0x02, 0x7B, 0x14, 0x00, 0x00, 0x0A, 0x6F, 0x1B,
-    0x00, 0x00, 0x0A, 0x58, 0x20, 0x29, 0x55, 0x55, 0xA5, 0x5A, 0x28, 0x19, 0x00, 0x00, 0x0A, 0x02,
-    0x7B, 0x15, 0x00, 0x00, 0x0A, 0x6F, 0x1C, 0x00, 0x00, 0x0A, 0x58, 0x2A, 0x13, 0x30, 0x07, 0x00,
-    0x62, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x11, 0x14, 0x72, 0x01, 0x00, 0x00, 0x70, 0x18, 0x8D,
-    0x0E, 0x00, 0x00, 0x01, 0x25, 0x16, 0x02, 0x7B, 0x14, 0x00, 0x00, 0x0A, 0x0A, 0x12, 0x00, 0x25,
-    0x71, 0x04, 0x00, 0x00, 0x1B, 0x8C, 0x04, 0x00, 0x00, 0x1B, 0x2D, 0x04, 0x26, 0x14, 0x2B, 0x0B,
-    0xFE, 0x16, 0x04, 0x00, 0x00, 0x1B, 0x6F, 0x1D, 0x00, 0x00, 0x0A, 0xA2, 0x25, 0x17, 0x02, 0x7B,
-    0x15, 0x00, 0x00, 0x0A, 0x0B, 0x12, 0x01, 0x25, 0x71, 0x05, 0x00, 0x00, 0x1B, 0x8C, 0x05, 0x00,
-    0x00, 0x1B, 0x2D, 0x04, 0x26, 0x14, 0x2B, 0x0B, 0xFE, 0x16, 0x05, 0x00, 0x00, 0x1B, 0x6F, 0x1D,
-    0x00, 0x00, 0x0A, 0xA2, 0x28, 0x1E, 0x00, 0x00, 0x0A, 0x2A, 0x52, 0x02, 0x28, 0x1F, 0x00, 0x00,
-    0x0A, 0x00, 0x00, 0x72, 0x3D, 0x00, 0x00, 0x70, 0x28, 0x20, 0x00, 0x00, 0x0A, 0x00, 0x2A, 0x00,
-    0x13, 0x30, 0x02, 0x00, 0x38, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x11, 0x73, 0x09, 0x00, 0x00,
-    0x06, 0x0A, 0x06, 0x28, 0x21, 0x00, 0x00, 0x0A, 0x7D, 0x04, 0x00, 0x00, 0x04, 0x06, 0x02, 0x7D,
-    0x05, 0x00, 0x00, 0x04, 0x06, 0x15, 0x7D, 0x03, 0x00, 0x00, 0x04, 0x06, 0x7C, 0x04, 0x00, 0x00,
-    0x04, 0x12, 0x00, 0x28, 0x01, 0x00, 0x00, 0x2B, 0x06, 0x7C, 0x04, 0x00, 0x00, 0x04, 0x28, 0x23,
-    0x00, 0x00, 0x0A, 0x2A, 0x22, 0x02, 0x28, 0x16, 0x00, 0x00, 0x0A, 0x00, 0x2A, 0x00, 0x00, 0x00,
-    0x1B, 0x30, 0x09, 0x00, 0x09, 0x02, 0x00, 0x00, 0x04, 0x00, 0x00, 0x11, 0x02, 0x7B, 0x03, 0x00,
-    0x00, 0x04, 0x0A, 0x06, 0x2C, 0x02, 0x2B, 0x05, 0x38, 0x99, 0x00, 0x00, 0x00, 0x00, 0x16, 0x20,
-    0xA7, 0x00, 0x00, 0x00, 0x28, 0x24, 0x00, 0x00, 0x0A, 0x0B, 0x07, 0x39, 0xB4, 0x01, 0x00, 0x00,
-    0x00, 0x02, 0x72, 0x7F, 0x00, 0x00, 0x70, 0x28, 0x25, 0x00, 0x00, 0x0A, 0x7D, 0x06, 0x00, 0x00,
-    0x04, 0x02, 0x7B, 0x06, 0x00, 0x00, 0x04, 0x28, 0x26, 0x00, 0x00, 0x0A, 0x2C, 0x10, 0x02, 0x7B,
-    0x06, 0x00, 0x00, 0x04, 0x28, 0x27, 0x00, 0x00, 0x0A, 0x16, 0xFE, 0x01, 0x2B, 0x01, 0x17, 0x0C,
-    0x08, 0x2C, 0x06, 0x00, 0xDD, 0x97, 0x01, 0x00, 0x00, 0x02, 0x7B, 0x06, 0x00, 0x00, 0x04, 0x28,
-    0x28, 0x00, 0x00, 0x0A, 0x00, 0x2B, 0x64, 0x00, 0x1F, 0x0A, 0x28, 0x29, 0x00, 0x00, 0x0A, 0x6F,
-    0x2A, 0x00, 0x00, 0x0A, 0x0D, 0x12, 0x03, 0x28, 0x2B, 0x00, 0x00, 0x0A, 0x2D, 0x44, 0x02, 0x16,
-    0x25, 0x0A, 0x7D, 0x03, 0x00, 0x00, 0x04, 0x02, 0x09, 0x7D, 0x0E, 0x00, 0x00, 0x04, 0x02, 0x13,
-    0x04, 0x02, 0x7C, 0x04, 0x00, 0x00, 0x04, 0x12, 0x03, 0x12, 0x04, 0x28, 0x02, 0x00, 0x00, 0x2B,
-    0x00, 0xDD, 0x5E, 0x01, 0x00, 0x00, 0x02, 0x7B, 0x0E, 0x00, 0x00, 0x04, 0x0D, 0x02, 0x7C, 0x0E,
-    0x00, 0x00, 0x04, 0xFE, 0x15, 0x1A, 0x00, 0x00, 0x01, 0x02, 0x15, 0x25, 0x0A, 0x7D, 0x03, 0x00,
-    0x00, 0x04, 0x12, 0x03, 0x28, 0x2D, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x02, 0x7B, 0x06, 0x00, 0x00,
-    0x04, 0x28, 0x2E, 0x00, 0x00, 0x0A, 0x16, 0xFE, 0x01, 0x13, 0x05, 0x11, 0x05, 0x2D, 0x88, 0x02,
-    0x28, 0x2F, 0x00, 0x00, 0x0A, 0x7D, 0x07, 0x00, 0x00, 0x04, 0x02, 0x02, 0x7B, 0x07, 0x00, 0x00,
-    0x04, 0x17, 0x28, 0x30, 0x00, 0x00, 0x0A, 0x7D, 0x08, 0x00, 0x00, 0x04, 0x02, 0x02, 0x7B, 0x07,
-    0x00, 0x00, 0x04, 0x28, 0x31, 0x00, 0x00, 0x0A, 0x7D, 0x09, 0x00, 0x00, 0x04, 0x02, 0x02, 0x7C,
-    0x08, 0x00, 0x00, 0x04, 0x7B, 0x32, 0x00, 0x00, 0x0A, 0x22, 0x00, 0x00, 0x00, 0x40, 0x58, 0x7D,
-    0x0A, 0x00, 0x00, 0x04, 0x02, 0x02, 0x7C, 0x08, 0x00, 0x00, 0x04, 0x7B, 0x33, 0x00, 0x00, 0x0A,
-    0x22, 0x00, 0x00, 0x00, 0x40, 0x58, 0x7D, 0x0B, 0x00, 0x00, 0x04, 0x02, 0x02, 0x7C, 0x08, 0x00,
-    0x00, 0x04, 0x7B, 0x34, 0x00, 0x00, 0x0A, 0x7D, 0x0C, 0x00, 0x00, 0x04, 0x02, 0x02, 0x7B, 0x06,
-    0x00, 0x00, 0x04, 0x02, 0x7B, 0x0A, 0x00, 0x00, 0x04, 0x02, 0x7B, 0x0B, 0x00, 0x00, 0x04, 0x02,
-    0x7B, 0x0C, 0x00, 0x00, 0x04, 0x02, 0x7B, 0x09, 0x00, 0x00, 0x04, 0x17, 0x16, 0x28, 0x35, 0x00,
-    0x00, 0x0A, 0x7D, 0x0D, 0x00, 0x00, 0x04, 0x02, 0x7B, 0x07, 0x00, 0x00, 0x04, 0x02, 0x7B, 0x0D,
-    0x00, 0x00, 0x04, 0x15, 0x28, 0x36, 0x00, 0x00, 0x0A, 0x00, 0x02, 0x7B, 0x06, 0x00, 0x00, 0x04,
-    0x28, 0x37, 0x00, 0x00, 0x0A, 0x00, 0x72, 0x8F, 0x00, 0x00, 0x70, 0x17, 0x8D, 0x0E, 0x00, 0x00,
-    0x01, 0x25, 0x16, 0x19, 0x8D, 0x22, 0x00, 0x00, 0x01, 0x25, 0x17, 0x20, 0xFF, 0x00, 0x00, 0x00,
-    0x9E, 0x18, 0x8D, 0x1F, 0x00, 0x00, 0x01, 0x25, 0x16, 0x72, 0xAF, 0x00, 0x00, 0x70, 0xA2, 0x25,
-    0x17, 0x72, 0xC3, 0x00, 0x00, 0x70, 0xA2, 0x73, 0x38, 0x00, 0x00, 0x0A, 0xA2, 0x28, 0x39, 0x00,
-    0x00, 0x0A, 0x00, 0x00, 0xDE, 0x1A, 0x13, 0x06, 0x02, 0x1F, 0xFE, 0x7D, 0x03, 0x00, 0x00, 0x04,
-    0x02, 0x7C, 0x04, 0x00, 0x00, 0x04, 0x11, 0x06, 0x28, 0x3A, 0x00, 0x00, 0x0A, 0x00, 0xDE, 0x14,
-    0x02, 0x1F, 0xFE, 0x7D, 0x03, 0x00, 0x00, 0x04, 0x02, 0x7C, 0x04, 0x00, 0x00, 0x04, 0x28, 0x3B,
-    0x00, 0x00, 0x0A, 0x00, 0x2A, 0x00, 0x00, 0x00, 0x41, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x07, 0x00, 0x00, 0x00, 0xD3, 0x01, 0x00, 0x00, 0xDA, 0x01, 0x00, 0x00, 0x1A, 0x00, 0x00, 0x00,
-    0x1B, 0x00, 0x00, 0x01, 0x06, 0x2A, 0x00, 0x00, 0x42, 0x53, 0x4A, 0x42, 0x01, 0x00, 0x01, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x76, 0x34, 0x2E, 0x30, 0x2E, 0x33, 0x30, 0x33,
-    0x31, 0x39, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x6C, 0x00, 0x00, 0x00, 0x04, 0x05, 0x00, 0x00,
-    0x23, 0x7E, 0x00, 0x00, 0x70, 0x05, 0x00, 0x00, 0x6C, 0x06, 0x00, 0x00, 0x23, 0x53, 0x74, 0x72,
-    0x69, 0x6E, 0x67, 0x73, 0x00, 0x00, 0x00, 0x00, 0xDC, 0x0B, 0x00, 0x00, 0xE8, 0x00, 0x00, 0x00,
-    0x23, 0x55, 0x53, 0x00, 0xC4, 0x0C, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x23, 0x47, 0x55, 0x49,
-    0x44, 0x00, 0x00, 0x00, 0xD4, 0x0C, 0x00, 0x00, 0xAC, 0x02, 0x00, 0x00, 0x23, 0x42, 0x6C, 0x6F,
-    0x62, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x01, 0x57, 0x17, 0xA2, 0x0B,
-    0x09, 0x0E, 0x00, 0x00, 0x00, 0xFA, 0x01, 0x33, 0x00, 0x16, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-    0x22, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x00,
-    0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x3B, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00,
-    0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
-    0x02, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
-    0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0x04,
-    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x73, 0x03, 0x5B, 0x05, 0x06, 0x00, 0xDE, 0x03,
-    0x5B, 0x05, 0x06, 0x00, 0x54, 0x02, 0x38, 0x05, 0x0F, 0x00, 0x7B, 0x05, 0x00, 0x00, 0x06, 0x00,
-    0xE0, 0x02, 0x29, 0x04, 0x06, 0x00, 0xC5, 0x03, 0xA1, 0x04, 0x06, 0x00, 0x54, 0x03, 0xA1, 0x04,
-    0x06, 0x00, 0x11, 0x03, 0xA1, 0x04, 0x06, 0x00, 0x2E, 0x03, 0xA1, 0x04, 0x06, 0x00, 0x93, 0x03,
-    0xA1, 0x04, 0x06, 0x00, 0x83, 0x02, 0xA1, 0x04, 0x06, 0x00, 0x39, 0x02, 0x5B, 0x05, 0x06, 0x00,
-    0xAC, 0x03, 0x38, 0x05, 0x06, 0x00, 0xC2, 0x05, 0x8F, 0x04, 0x06, 0x00, 0x17, 0x02, 0x38, 0x05,
-    0x06, 0x00, 0x68, 0x02, 0x38, 0x05, 0x06, 0x00, 0xF9, 0x02, 0x38, 0x05, 0x0A, 0x00, 0x40, 0x06,
-    0x01, 0x02, 0x0A, 0x00, 0xB8, 0x00, 0x02, 0x04, 0x06, 0x00, 0xFC, 0x01, 0x8F, 0x04, 0x06, 0x00,
-    0x9A, 0x02, 0x5B, 0x05, 0x06, 0x00, 0xB5, 0x02, 0x38, 0x05, 0x0A, 0x00, 0xD2, 0x02, 0x01, 0x02,
-    0x06, 0x00, 0x5D, 0x04, 0x9D, 0x05, 0x06, 0x00, 0xCC, 0x01, 0x5B, 0x05, 0x06, 0x00, 0x11, 0x05,
-    0x5B, 0x05, 0x06, 0x00, 0xB6, 0x04, 0x8F, 0x04, 0x06, 0x00, 0xED, 0x04, 0x5B, 0x05, 0x0A, 0x00,
-    0x64, 0x00, 0x01, 0x02, 0x06, 0x00, 0x21, 0x00, 0xCB, 0x00, 0x06, 0x00, 0x45, 0x04, 0x8F, 0x04,
-    0x06, 0x00, 0xDD, 0x04, 0x8F, 0x04, 0x0A, 0x00, 0x4C, 0x04, 0x01, 0x02, 0x06, 0x00, 0x34, 0x00,
-    0x8F, 0x04, 0x00, 0x00, 0x00, 0x00, 0xAF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0x00,
-    0x00, 0x01, 0x10, 0x00, 0x44, 0x00, 0x00, 0x00, 0x39, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00,
-    0x10, 0x00, 0x96, 0x04, 0x05, 0x06, 0x49, 0x00, 0x03, 0x00, 0x07, 0x00, 0x03, 0x01, 0x10, 0x00,
-    0x0D, 0x00, 0x00, 0x00, 0x39, 0x00, 0x03, 0x00, 0x09, 0x00, 0x21, 0x00, 0x56, 0x01, 0x30, 0x00,
-    0x21, 0x00, 0x66, 0x01, 0x34, 0x00, 0x06, 0x00, 0x2E, 0x02, 0x33, 0x01, 0x06, 0x00, 0x04, 0x05,
-    0x36, 0x01, 0x06, 0x00, 0x93, 0x05, 0x3A, 0x01, 0x01, 0x00, 0x01, 0x00, 0x3E, 0x01, 0x01, 0x00,
-    0x3A, 0x00, 0x33, 0x01, 0x01, 0x00, 0x5A, 0x00, 0x41, 0x01, 0x01, 0x00, 0x6C, 0x00, 0xF7, 0x00,
-    0x01, 0x00, 0x7A, 0x00, 0xF7, 0x00, 0x01, 0x00, 0x87, 0x00, 0xF7, 0x00, 0x01, 0x00, 0x94, 0x00,
-    0xF7, 0x00, 0x01, 0x00, 0xA1, 0x00, 0x33, 0x01, 0x01, 0x00, 0x1A, 0x00, 0x45, 0x01, 0x50, 0x20,
-    0x00, 0x00, 0x00, 0x00, 0x86, 0x08, 0x28, 0x05, 0x49, 0x01, 0x01, 0x00, 0x58, 0x20, 0x00, 0x00,
-    0x00, 0x00, 0x86, 0x08, 0x8A, 0x05, 0x4E, 0x01, 0x01, 0x00, 0x60, 0x20, 0x00, 0x00, 0x00, 0x00,
-    0x86, 0x18, 0x32, 0x05, 0x15, 0x01, 0x01, 0x00, 0x78, 0x20, 0x00, 0x00, 0x00, 0x00, 0xC6, 0x00,
-    0xB4, 0x05, 0x53, 0x01, 0x03, 0x00, 0xC7, 0x20, 0x00, 0x00, 0x00, 0x00, 0xC6, 0x00, 0x75, 0x01,
-    0x58, 0x01, 0x04, 0x00, 0xFC, 0x20, 0x00, 0x00, 0x00, 0x00, 0xC6, 0x00, 0x43, 0x04, 0x72, 0x00,
-    0x04, 0x00, 0x6A, 0x21, 0x00, 0x00, 0x00, 0x00, 0x86, 0x18, 0x32, 0x05, 0x06, 0x00, 0x04, 0x00,
-    0x80, 0x21, 0x00, 0x00, 0x00, 0x00, 0x86, 0x00, 0x52, 0x04, 0x9F, 0x00, 0x04, 0x00, 0xC4, 0x21,
-    0x00, 0x00, 0x00, 0x00, 0x86, 0x18, 0x32, 0x05, 0x06, 0x00, 0x04, 0x00, 0xD0, 0x21, 0x00, 0x00,
-    0x00, 0x00, 0xE1, 0x01, 0x51, 0x06, 0x06, 0x00, 0x04, 0x00, 0x04, 0x24, 0x00, 0x00, 0x00, 0x00,
-    0xE1, 0x01, 0xDF, 0x01, 0x21, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x2C, 0x05, 0x00, 0x00,
-    0x02, 0x00, 0x8E, 0x05, 0x00, 0x00, 0x01, 0x00, 0xFC, 0x03, 0x00, 0x00, 0x01, 0x00, 0xEF, 0x01,
-    0x04, 0x00, 0x65, 0x00, 0x09, 0x00, 0x32, 0x05, 0x01, 0x00, 0x11, 0x00, 0x32, 0x05, 0x06, 0x00,
-    0x19, 0x00, 0x32, 0x05, 0x0A, 0x00, 0x29, 0x00, 0x32, 0x05, 0x10, 0x00, 0x31, 0x00, 0x32, 0x05,
-    0x10, 0x00, 0x39, 0x00, 0x32, 0x05, 0x10, 0x00, 0x41, 0x00, 0x32, 0x05, 0x10, 0x00, 0x49, 0x00,
-    0x32, 0x05, 0x10, 0x00, 0x51, 0x00, 0x32, 0x05, 0x10, 0x00, 0x59, 0x00, 0x32, 0x05, 0x10, 0x00,
-    0x61, 0x00, 0x32, 0x05, 0x06, 0x00, 0x69, 0x00, 0x32, 0x05, 0x10, 0x00, 0x81, 0x00, 0x32, 0x05,
-    0x15, 0x00, 0x89, 0x00, 0x32, 0x05, 0x06, 0x00, 0xA9, 0x00, 0x32, 0x05, 0x1B, 0x00, 0xB1, 0x00,
-    0x32, 0x05, 0x06, 0x00, 0xB9, 0x00, 0x32, 0x05, 0x06, 0x00, 0xC9, 0x00, 0x51, 0x06, 0x06, 0x00,
-    0xC9, 0x00, 0xDF, 0x01, 0x21, 0x00, 0x0C, 0x00, 0x56, 0x01, 0x30, 0x00, 0x0C, 0x00, 0x66, 0x01,
-    0x34, 0x00, 0x71, 0x00, 0x32, 0x05, 0x06, 0x00, 0x14, 0x00, 0xE5, 0x05, 0x4A, 0x00, 0x14, 0x00,
-    0xB4, 0x05, 0x53, 0x00, 0x1C, 0x00, 0xE5, 0x05, 0x4A, 0x00, 0x1C, 0x00, 0xB4, 0x05, 0x53, 0x00,
-    0x14, 0x00, 0x75, 0x01, 0x62, 0x00, 0x1C, 0x00, 0x75, 0x01, 0x62, 0x00, 0x71, 0x00, 0x43, 0x04,
-    0x72, 0x00, 0xF9, 0x00, 0xBB, 0x05, 0x79, 0x00, 0x91, 0x00, 0x32, 0x05, 0x06, 0x00, 0x09, 0x01,
-    0xC2, 0x01, 0x83, 0x00, 0xE1, 0x00, 0x10, 0x02, 0x8D, 0x00, 0xE1, 0x00, 0x4B, 0x06, 0x92, 0x00,
-    0xE1, 0x00, 0x59, 0x04, 0x9F, 0x00, 0x99, 0x00, 0x1A, 0x01, 0xB1, 0x00, 0x99, 0x00, 0x60, 0x06,
-    0xB7, 0x00, 0x99, 0x00, 0x81, 0x01, 0xBC, 0x00, 0x99, 0x00, 0x92, 0x01, 0xBC, 0x00, 0x99, 0x00,
-    0x62, 0x04, 0xC1, 0x00, 0x91, 0x00, 0x5A, 0x06, 0xC6, 0x00, 0xC1, 0x00, 0x1D, 0x05, 0xCC, 0x00,
-    0xD1, 0x00, 0x46, 0x01, 0xD1, 0x00, 0xE1, 0x00, 0x2F, 0x01, 0xD5, 0x00, 0xD1, 0x00, 0xF1, 0x05,
-    0x06, 0x00, 0x99, 0x00, 0xF2, 0x00, 0xBC, 0x00, 0x99, 0x00, 0xE6, 0x00, 0xE7, 0x00, 0x99, 0x00,
-    0x4B, 0x05, 0xEB, 0x00, 0x99, 0x00, 0x18, 0x04, 0xF2, 0x00, 0xE9, 0x00, 0xBC, 0x00, 0xF7, 0x00,
-    0xE9, 0x00, 0xBE, 0x00, 0xF7, 0x00, 0xE9, 0x00, 0xC0, 0x00, 0xF7, 0x00, 0x99, 0x00, 0xA2, 0x01,
-    0xFA, 0x00, 0x99, 0x00, 0xB0, 0x01, 0x05, 0x01, 0x99, 0x00, 0x01, 0x01, 0xC1, 0x00, 0x34, 0x00,
-    0x32, 0x05, 0x15, 0x01, 0x91, 0x00, 0x33, 0x06, 0x1D, 0x01, 0xE1, 0x00, 0xB3, 0x04, 0x24, 0x01,
-    0xE1, 0x00, 0xFB, 0x05, 0x06, 0x00, 0x21, 0x00, 0x6B, 0x00, 0x5F, 0x02, 0x2E, 0x00, 0x0B, 0x00,
-    0x66, 0x01, 0x2E, 0x00, 0x13, 0x00, 0x6F, 0x01, 0x2E, 0x00, 0x1B, 0x00, 0x8E, 0x01, 0x2E, 0x00,
-    0x23, 0x00, 0x97, 0x01, 0x2E, 0x00, 0x2B, 0x00, 0xE5, 0x01, 0x2E, 0x00, 0x33, 0x00, 0x02, 0x02,
-    0x2E, 0x00, 0x3B, 0x00, 0x0D, 0x02, 0x2E, 0x00, 0x43, 0x00, 0x1A, 0x02, 0x2E, 0x00, 0x4B, 0x00,
-    0xE5, 0x01, 0x2E, 0x00, 0x53, 0x00, 0xE5, 0x01, 0x41, 0x00, 0x6B, 0x00, 0x5F, 0x02, 0x43, 0x00,
-    0x5B, 0x00, 0x25, 0x02, 0x43, 0x00, 0x63, 0x00, 0x68, 0x02, 0x60, 0x00, 0x73, 0x00, 0x25, 0x02,
-    0x80, 0x00, 0x73, 0x00, 0x25, 0x02, 0x83, 0x00, 0x5B, 0x00, 0x25, 0x02, 0xA0, 0x00, 0x73, 0x00,
-    0x25, 0x02, 0xC0, 0x00, 0x73, 0x00, 0x25, 0x02, 0x00, 0x01, 0x7B, 0x00, 0x2A, 0x02, 0x00, 0x01,
-    0x83, 0x00, 0x25, 0x02, 0x00, 0x01, 0x8B, 0x00, 0x25, 0x02, 0x60, 0x01, 0x73, 0x00, 0x25, 0x02,
-    0x38, 0x00, 0x68, 0x00, 0x88, 0x00, 0xA4, 0x00, 0x02, 0x00, 0x01, 0x00, 0x00, 0x00, 0x2C, 0x05,
-    0x5C, 0x01, 0x00, 0x00, 0x8E, 0x05, 0x61, 0x01, 0x02, 0x00, 0x01, 0x00, 0x03, 0x00, 0x02, 0x00,
-    0x02, 0x00, 0x05, 0x00, 0x04, 0x00, 0x14, 0x00, 0x25, 0x00, 0x04, 0x00, 0x16, 0x00, 0x27, 0x00,
-    0x27, 0x00, 0x43, 0x00, 0x5B, 0x00, 0x6F, 0x00, 0x76, 0x00, 0x0C, 0x01, 0x04, 0x80, 0x00, 0x00,
-    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC9, 0x05,
-    0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2A, 0x01,
-    0xC2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x1D, 0x06, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x03, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x04, 0x00, 0xC0, 0x04, 0x01, 0x00, 0x00, 0x00, 0x04, 0x00, 0xCF, 0x04, 0x45, 0x00,
-    0x9A, 0x00, 0x59, 0x00, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x6D, 0x6F, 0x64, 0x65, 0x6C, 0x3E,
-    0x35, 0x5F, 0x5F, 0x31, 0x00, 0x3C, 0x4F, 0x6E, 0x54, 0x69, 0x63, 0x6B, 0x3E, 0x64, 0x5F, 0x5F,
-    0x31, 0x00, 0x3C, 0x3E, 0x75, 0x5F, 0x5F, 0x31, 0x00, 0x45, 0x71, 0x75, 0x61, 0x6C, 0x69, 0x74,
-    0x79, 0x43, 0x6F, 0x6D, 0x70, 0x61, 0x72, 0x65, 0x72, 0x60, 0x31, 0x00, 0x49, 0x6E, 0x74, 0x33,
-    0x32, 0x00, 0x3C, 0x70, 0x65, 0x64, 0x3E, 0x35, 0x5F, 0x5F, 0x32, 0x00, 0x3C, 0x3E, 0x66, 0x5F,
-    0x5F, 0x41, 0x6E, 0x6F, 0x6E, 0x79, 0x6D, 0x6F, 0x75, 0x73, 0x54, 0x79, 0x70, 0x65, 0x30, 0x60,
-    0x32, 0x00, 0x3C, 0x70, 0x6F, 0x73, 0x3E, 0x35, 0x5F, 0x5F, 0x33, 0x00, 0x56, 0x65, 0x63, 0x74,
-    0x6F, 0x72, 0x33, 0x00, 0x3C, 0x68, 0x65, 0x61, 0x64, 0x69, 0x6E, 0x67, 0x3E, 0x35, 0x5F, 0x5F,
-    0x34, 0x00, 0x3C, 0x73, 0x70, 0x61, 0x77, 0x6E, 0x58, 0x3E, 0x35, 0x5F, 0x5F, 0x35, 0x00, 0x3C,
-    0x73, 0x70, 0x61, 0x77, 0x6E, 0x59, 0x3E, 0x35, 0x5F, 0x5F, 0x36, 0x00, 0x3C, 0x73, 0x70, 0x61,
-    0x77, 0x6E, 0x5A, 0x3E, 0x35, 0x5F, 0x5F, 0x37, 0x00, 0x3C, 0x76, 0x65, 0x68, 0x69, 0x63, 0x6C,
-    0x65, 0x3E, 0x35, 0x5F, 0x5F, 0x38, 0x00, 0x3C, 0x4D, 0x6F, 0x64, 0x75, 0x6C, 0x65, 0x3E, 0x00,
-    0x41, 0x50, 0x49, 0x00, 0x58, 0x00, 0x59, 0x00, 0x5A, 0x00, 0x6D, 0x73, 0x63, 0x6F, 0x72, 0x6C,
-    0x69, 0x62, 0x00, 0x53, 0x79, 0x73, 0x74, 0x65, 0x6D, 0x2E, 0x43, 0x6F, 0x6C, 0x6C, 0x65, 0x63,
-    0x74, 0x69, 0x6F, 0x6E, 0x73, 0x2E, 0x47, 0x65, 0x6E, 0x65, 0x72, 0x69, 0x63, 0x00, 0x50, 0x6C,
-    0x61, 0x79, 0x65, 0x72, 0x50, 0x65, 0x64, 0x49, 0x64, 0x00, 0x48, 0x61, 0x73, 0x4D, 0x6F, 0x64,
-    0x65, 0x6C, 0x4C, 0x6F, 0x61, 0x64, 0x65, 0x64, 0x00, 0x53, 0x65, 0x74, 0x4D, 0x6F, 0x64, 0x65,
-    0x6C, 0x41, 0x73, 0x4E, 0x6F, 0x4C, 0x6F, 0x6E, 0x67, 0x65, 0x72, 0x4E, 0x65, 0x65, 0x64, 0x65,
-    0x64, 0x00, 0x49, 0x73, 0x43, 0x6F, 0x6E, 0x74, 0x72, 0x6F, 0x6C, 0x4A, 0x75, 0x73, 0x74, 0x50,
-    0x72, 0x65, 0x73, 0x73, 0x65, 0x64, 0x00, 0x41, 0x77, 0x61, 0x69, 0x74, 0x55, 0x6E, 0x73, 0x61,
-    0x66, 0x65, 0x4F, 0x6E, 0x43, 0x6F, 0x6D, 0x70, 0x6C, 0x65, 0x74, 0x65, 0x64, 0x00, 0x67, 0x65,
-    0x74, 0x5F, 0x49, 0x73, 0x43, 0x6F, 0x6D, 0x70, 0x6C, 0x65, 0x74, 0x65, 0x64, 0x00, 0x3C, 0x63,
-    0x6F, 0x6C, 0x6F, 0x72, 0x3E, 0x69, 0x5F, 0x5F, 0x46, 0x69, 0x65, 0x6C, 0x64, 0x00, 0x3C, 0x61,
-    0x72, 0x67, 0x73, 0x3E, 0x69, 0x5F, 0x5F, 0x46, 0x69, 0x65, 0x6C, 0x64, 0x00, 0x47, 0x65, 0x74,
-    0x48, 0x61, 0x73, 0x68, 0x43, 0x6F, 0x64, 0x65, 0x00, 0x49, 0x73, 0x4D, 0x6F, 0x64, 0x65, 0x6C,
-    0x49, 0x6E, 0x43, 0x64, 0x69, 0x6D, 0x61, 0x67, 0x65, 0x00, 0x49, 0x73, 0x4D, 0x6F, 0x64, 0x65,
-    0x6C, 0x41, 0x56, 0x65, 0x68, 0x69, 0x63, 0x6C, 0x65, 0x00, 0x43, 0x72, 0x65, 0x61, 0x74, 0x65,
-    0x56, 0x65, 0x68, 0x69, 0x63, 0x6C, 0x65, 0x00, 0x53, 0x65, 0x74, 0x50, 0x65, 0x64, 0x49, 0x6E,
-    0x74, 0x6F, 0x56, 0x65, 0x68, 0x69, 0x63, 0x6C, 0x65, 0x00, 0x57, 0x72, 0x69, 0x74, 0x65, 0x4C,
-    0x69, 0x6E, 0x65, 0x00, 0x49, 0x41, 0x73, 0x79, 0x6E, 0x63, 0x53, 0x74, 0x61, 0x74, 0x65, 0x4D,
-    0x61, 0x63, 0x68, 0x69, 0x6E, 0x65, 0x00, 0x53, 0x65, 0x74, 0x53, 0x74, 0x61, 0x74, 0x65, 0x4D,
-    0x61, 0x63, 0x68, 0x69, 0x6E, 0x65, 0x00, 0x73, 0x74, 0x61, 0x74, 0x65, 0x4D, 0x61, 0x63, 0x68,
-    0x69, 0x6E, 0x65, 0x00, 0x54, 0x79, 0x70, 0x65, 0x00, 0x43, 0x69, 0x74, 0x69, 0x7A, 0x65, 0x6E,
-    0x46, 0x58, 0x2E, 0x43, 0x6F, 0x72, 0x65, 0x00, 0x43, 0x72, 0x65, 0x61, 0x74, 0x65, 0x00, 0x44,
-    0x65, 0x62, 0x75, 0x67, 0x67, 0x65, 0x72, 0x42, 0x72, 0x6F, 0x77, 0x73, 0x61, 0x62, 0x6C, 0x65,
-    0x53, 0x74, 0x61, 0x74, 0x65, 0x00, 0x3C, 0x3E, 0x31, 0x5F, 0x5F, 0x73, 0x74, 0x61, 0x74, 0x65,
-    0x00, 0x43, 0x6F, 0x6D, 0x70, 0x69, 0x6C, 0x65, 0x72, 0x47, 0x65, 0x6E, 0x65, 0x72, 0x61, 0x74,
-    0x65, 0x64, 0x41, 0x74, 0x74, 0x72, 0x69, 0x62, 0x75, 0x74, 0x65, 0x00, 0x44, 0x65, 0x62, 0x75,
-    0x67, 0x67, 0x61, 0x62, 0x6C, 0x65, 0x41, 0x74, 0x74, 0x72, 0x69, 0x62, 0x75, 0x74, 0x65, 0x00,
-    0x44, 0x65, 0x62, 0x75, 0x67, 0x67, 0x65, 0x72, 0x42, 0x72, 0x6F, 0x77, 0x73, 0x61, 0x62, 0x6C,
-    0x65, 0x41, 0x74, 0x74, 0x72, 0x69, 0x62, 0x75, 0x74, 0x65, 0x00, 0x41, 0x73, 0x73, 0x65, 0x6D,
-    0x62, 0x6C, 0x79, 0x54, 0x69, 0x74, 0x6C, 0x65, 0x41, 0x74, 0x74, 0x72, 0x69, 0x62, 0x75, 0x74,
-    0x65, 0x00, 0x41, 0x73, 0x79, 0x6E, 0x63, 0x53, 0x74, 0x61, 0x74, 0x65, 0x4D, 0x61, 0x63, 0x68,
-    0x69, 0x6E, 0x65, 0x41, 0x74, 0x74, 0x72, 0x69, 0x62, 0x75, 0x74, 0x65, 0x00, 0x44, 0x65, 0x62,
-    0x75, 0x67, 0x67, 0x65, 0x72, 0x53, 0x74, 0x65, 0x70, 0x54, 0x68, 0x72, 0x6F, 0x75, 0x67, 0x68,
-    0x41, 0x74, 0x74, 0x72, 0x69, 0x62, 0x75, 0x74, 0x65, 0x00, 0x54, 0x69, 0x63, 0x6B, 0x41, 0x74,
-    0x74, 0x72, 0x69, 0x62, 0x75, 0x74, 0x65, 0x00, 0x54, 0x61, 0x72, 0x67, 0x65, 0x74, 0x46, 0x72,
-    0x61, 0x6D, 0x65, 0x77, 0x6F, 0x72, 0x6B, 0x41, 0x74, 0x74, 0x72, 0x69, 0x62, 0x75, 0x74, 0x65,
-    0x00, 0x44, 0x65, 0x62, 0x75, 0x67, 0x67, 0x65, 0x72, 0x48, 0x69, 0x64, 0x64, 0x65, 0x6E, 0x41,
-    0x74, 0x74, 0x72, 0x69, 0x62, 0x75, 0x74, 0x65, 0x00, 0x41, 0x73, 0x73, 0x65, 0x6D, 0x62, 0x6C,
-    0x79, 0x46, 0x69, 0x6C, 0x65, 0x56, 0x65, 0x72, 0x73, 0x69, 0x6F, 0x6E, 0x41, 0x74, 0x74, 0x72,
-    0x69, 0x62, 0x75, 0x74, 0x65, 0x00, 0x41, 0x73, 0x73, 0x65, 0x6D, 0x62, 0x6C, 0x79, 0x49, 0x6E,
-    0x66, 0x6F, 0x72, 0x6D, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x61, 0x6C, 0x56, 0x65, 0x72, 0x73, 0x69,
-    0x6F, 0x6E, 0x41, 0x74, 0x74, 0x72, 0x69, 0x62, 0x75, 0x74, 0x65, 0x00, 0x41, 0x73, 0x73, 0x65,
-    0x6D, 0x62, 0x6C, 0x79, 0x43, 0x6F, 0x6E, 0x66, 0x69, 0x67, 0x75, 0x72, 0x61, 0x74, 0x69, 0x6F,
-    0x6E, 0x41, 0x74, 0x74, 0x72, 0x69, 0x62, 0x75, 0x74, 0x65, 0x00, 0x43, 0x6F, 0x6D, 0x70, 0x69,
-    0x6C, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x52, 0x65, 0x6C, 0x61, 0x78, 0x61, 0x74, 0x69, 0x6F, 0x6E,
-    0x73, 0x41, 0x74, 0x74, 0x72, 0x69, 0x62, 0x75, 0x74, 0x65, 0x00, 0x41, 0x73, 0x73, 0x65, 0x6D,
-    0x62, 0x6C, 0x79, 0x50, 0x72, 0x6F, 0x64, 0x75, 0x63, 0x74, 0x41, 0x74, 0x74, 0x72, 0x69, 0x62,
-    0x75, 0x74, 0x65, 0x00, 0x44, 0x65, 0x62, 0x75, 0x67, 0x67, 0x65, 0x72, 0x44, 0x69, 0x73, 0x70,
-    0x6C, 0x61, 0x79, 0x41, 0x74, 0x74, 0x72, 0x69, 0x62, 0x75, 0x74, 0x65, 0x00, 0x41, 0x73, 0x73,
-    0x65, 0x6D, 0x62, 0x6C, 0x79, 0x43, 0x6F, 0x6D, 0x70, 0x61, 0x6E, 0x79, 0x41, 0x74, 0x74, 0x72,
-    0x69, 0x62, 0x75, 0x74, 0x65, 0x00, 0x52, 0x75, 0x6E, 0x74, 0x69, 0x6D, 0x65, 0x43, 0x6F, 0x6D,
-    0x70, 0x61, 0x74, 0x69, 0x62, 0x69, 0x6C, 0x69, 0x74, 0x79, 0x41, 0x74, 0x74, 0x72, 0x69, 0x62,
-    0x75, 0x74, 0x65, 0x00, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x00, 0x43, 0x69, 0x74, 0x69, 0x7A, 0x65,
-    0x6E, 0x46, 0x58, 0x2E, 0x43, 0x6F, 0x72, 0x65, 0x2E, 0x4E, 0x61, 0x74, 0x69, 0x76, 0x65, 0x00,
-    0x47, 0x65, 0x74, 0x45, 0x6E, 0x74, 0x69, 0x74, 0x79, 0x48, 0x65, 0x61, 0x64, 0x69, 0x6E, 0x67,
-    0x00, 0x53, 0x79, 0x73, 0x74, 0x65, 0x6D, 0x2E, 0x52, 0x75, 0x6E, 0x74, 0x69, 0x6D, 0x65, 0x2E,
-    0x56, 0x65, 0x72, 0x73, 0x69, 0x6F, 0x6E, 0x69, 0x6E, 0x67, 0x00, 0x54, 0x6F, 0x53, 0x74, 0x72,
-    0x69, 0x6E, 0x67, 0x00, 0x44, 0x65, 0x62, 0x75, 0x67, 0x00, 0x4F, 0x6E, 0x54, 0x69, 0x63, 0x6B,
-    0x00, 0x67, 0x65, 0x74, 0x5F, 0x54, 0x61, 0x73, 0x6B, 0x00, 0x52, 0x65, 0x71, 0x75, 0x65, 0x73,
-    0x74, 0x4D, 0x6F, 0x64, 0x65, 0x6C, 0x00, 0x45, 0x78, 0x65, 0x63, 0x75, 0x74, 0x65, 0x64, 0x52,
-    0x65, 0x73, 0x6F, 0x75, 0x72, 0x63, 0x65, 0x2E, 0x43, 0x6C, 0x69, 0x65, 0x6E, 0x74, 0x2E, 0x6E,
-    0x65, 0x74, 0x2E, 0x64, 0x6C, 0x6C, 0x00, 0x53, 0x79, 0x73, 0x74, 0x65, 0x6D, 0x00, 0x43, 0x6C,
-    0x69, 0x65, 0x6E, 0x74, 0x4D, 0x61, 0x69, 0x6E, 0x00, 0x53, 0x79, 0x73, 0x74, 0x65, 0x6D, 0x2E,
-    0x52, 0x65, 0x66, 0x6C, 0x65, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x00, 0x53, 0x65, 0x74, 0x45, 0x78,
-    0x63, 0x65, 0x70, 0x74, 0x69, 0x6F, 0x6E, 0x00, 0x3C, 0x63, 0x6F, 0x6C, 0x6F, 0x72, 0x3E, 0x6A,
-    0x5F, 0x5F, 0x54, 0x50, 0x61, 0x72, 0x00, 0x3C, 0x61, 0x72, 0x67, 0x73, 0x3E, 0x6A, 0x5F, 0x5F,
-    0x54, 0x50, 0x61, 0x72, 0x00, 0x49, 0x46, 0x6F, 0x72, 0x6D, 0x61, 0x74, 0x50, 0x72, 0x6F, 0x76,
-    0x69, 0x64, 0x65, 0x72, 0x00, 0x41, 0x73, 0x79, 0x6E, 0x63, 0x54, 0x61, 0x73, 0x6B, 0x4D, 0x65,
-    0x74, 0x68, 0x6F, 0x64, 0x42, 0x75, 0x69, 0x6C, 0x64, 0x65, 0x72, 0x00, 0x3C, 0x3E, 0x74, 0x5F,
-    0x5F, 0x62, 0x75, 0x69, 0x6C, 0x64, 0x65, 0x72, 0x00, 0x54, 0x61, 0x73, 0x6B, 0x41, 0x77, 0x61,
-    0x69, 0x74, 0x65, 0x72, 0x00, 0x47, 0x65, 0x74, 0x41, 0x77, 0x61, 0x69, 0x74, 0x65, 0x72, 0x00,
-    0x67, 0x65, 0x74, 0x5F, 0x63, 0x6F, 0x6C, 0x6F, 0x72, 0x00, 0x2E, 0x63, 0x74, 0x6F, 0x72, 0x00,
-    0x53, 0x79, 0x73, 0x74, 0x65, 0x6D, 0x2E, 0x44, 0x69, 0x61, 0x67, 0x6E, 0x6F, 0x73, 0x74, 0x69,
-    0x63, 0x73, 0x00, 0x47, 0x65, 0x74, 0x45, 0x6E, 0x74, 0x69, 0x74, 0x79, 0x43, 0x6F, 0x6F, 0x72,
-    0x64, 0x73, 0x00, 0x53, 0x79, 0x73, 0x74, 0x65, 0x6D, 0x2E, 0x52, 0x75, 0x6E, 0x74, 0x69, 0x6D,
-    0x65, 0x2E, 0x43, 0x6F, 0x6D, 0x70, 0x69, 0x6C, 0x65, 0x72, 0x53, 0x65, 0x72, 0x76, 0x69, 0x63,
-    0x65, 0x73, 0x00, 0x44, 0x65, 0x62, 0x75, 0x67, 0x67, 0x69, 0x6E, 0x67, 0x4D, 0x6F, 0x64, 0x65,
-    0x73, 0x00, 0x67, 0x65, 0x74, 0x5F, 0x61, 0x72, 0x67, 0x73, 0x00, 0x3C, 0x3E, 0x34, 0x5F, 0x5F,
-    0x74, 0x68, 0x69, 0x73, 0x00, 0x53, 0x79, 0x73, 0x74, 0x65, 0x6D, 0x2E, 0x54, 0x68, 0x72, 0x65,
-    0x61, 0x64, 0x69, 0x6E, 0x67, 0x2E, 0x54, 0x61, 0x73, 0x6B, 0x73, 0x00, 0x45, 0x71, 0x75, 0x61,
-    0x6C, 0x73, 0x00, 0x46, 0x6F, 0x72, 0x6D, 0x61, 0x74, 0x00, 0x4F, 0x62, 0x6A, 0x65, 0x63, 0x74,
-    0x00, 0x45, 0x78, 0x65, 0x63, 0x75, 0x74, 0x65, 0x64, 0x52, 0x65, 0x73, 0x6F, 0x75, 0x72, 0x63,
-    0x65, 0x2E, 0x43, 0x6C, 0x69, 0x65, 0x6E, 0x74, 0x2E, 0x6E, 0x65, 0x74, 0x00, 0x67, 0x65, 0x74,
-    0x5F, 0x44, 0x65, 0x66, 0x61, 0x75, 0x6C, 0x74, 0x00, 0x47, 0x65, 0x74, 0x52, 0x65, 0x73, 0x75,
-    0x6C, 0x74, 0x00, 0x53, 0x65, 0x74, 0x52, 0x65, 0x73, 0x75, 0x6C, 0x74, 0x00, 0x45, 0x78, 0x65,
-    0x63, 0x75, 0x74, 0x65, 0x64, 0x52, 0x65, 0x73, 0x6F, 0x75, 0x72, 0x63, 0x65, 0x2E, 0x43, 0x6C,
-    0x69, 0x65, 0x6E, 0x74, 0x00, 0x43, 0x69, 0x74, 0x69, 0x7A, 0x65, 0x6E, 0x46, 0x58, 0x2E, 0x43,
-    0x6F, 0x72, 0x65, 0x2E, 0x43, 0x6C, 0x69, 0x65, 0x6E, 0x74, 0x00, 0x54, 0x72, 0x69, 0x67, 0x67,
-    0x65, 0x72, 0x45, 0x76, 0x65, 0x6E, 0x74, 0x00, 0x42, 0x61, 0x73, 0x65, 0x53, 0x63, 0x72, 0x69,
-    0x70, 0x74, 0x00, 0x53, 0x74, 0x61, 0x72, 0x74, 0x00, 0x4D, 0x6F, 0x76, 0x65, 0x4E, 0x65, 0x78,
-    0x74, 0x00, 0x44, 0x65, 0x6C, 0x61, 0x79, 0x00, 0x47, 0x65, 0x74, 0x48, 0x61, 0x73, 0x68, 0x4B,
-    0x65, 0x79, 0x00, 0x00, 0x00, 0x3B, 0x7B, 0x00, 0x7B, 0x00, 0x20, 0x00, 0x63, 0x00, 0x6F, 0x00,
-    0x6C, 0x00, 0x6F, 0x00, 0x72, 0x00, 0x20, 0x00, 0x3D, 0x00, 0x20, 0x00, 0x7B, 0x00, 0x30, 0x00,
-    0x7D, 0x00, 0x2C, 0x00, 0x20, 0x00, 0x61, 0x00, 0x72, 0x00, 0x67, 0x00, 0x73, 0x00, 0x20, 0x00,
-    0x3D, 0x00, 0x20, 0x00, 0x7B, 0x00, 0x31, 0x00, 0x7D, 0x00, 0x20, 0x00, 0x7D, 0x00, 0x7D, 0x00,
-    0x00, 0x41, 0x48, 0x00, 0x69, 0x00, 0x20, 0x00, 0x66, 0x00, 0x72, 0x00, 0x6F, 0x00, 0x6D, 0x00,
-    0x20, 0x00, 0x45, 0x00, 0x78, 0x00, 0x65, 0x00, 0x63, 0x00, 0x75, 0x00, 0x74, 0x00, 0x65, 0x00,
-    0x64, 0x00, 0x52, 0x00, 0x65, 0x00, 0x73, 0x00, 0x6F, 0x00, 0x75, 0x00, 0x72, 0x00, 0x63, 0x00,
-    0x65, 0x00, 0x2E, 0x00, 0x43, 0x00, 0x6C, 0x00, 0x69, 0x00, 0x65, 0x00, 0x6E, 0x00, 0x74, 0x00,
-    0x21, 0x00, 0x00, 0x0F, 0x73, 0x00, 0x61, 0x00, 0x6E, 0x00, 0x63, 0x00, 0x68, 0x00, 0x65, 0x00,
-    0x7A, 0x00, 0x00, 0x1F, 0x63, 0x00, 0x68, 0x00, 0x61, 0x00, 0x74, 0x00, 0x3A, 0x00, 0x61, 0x00,
-    0x64, 0x00, 0x64, 0x00, 0x4D, 0x00, 0x65, 0x00, 0x73, 0x00, 0x73, 0x00, 0x61, 0x00, 0x67, 0x00,
-    0x65, 0x00, 0x00, 0x13, 0x5B, 0x00, 0x53, 0x00, 0x70, 0x00, 0x61, 0x00, 0x77, 0x00, 0x6E, 0x00,
-    0x65, 0x00, 0x72, 0x00, 0x5D, 0x00, 0x00, 0x21, 0x53, 0x00, 0x61, 0x00, 0x6E, 0x00, 0x63, 0x00,
-    0x68, 0x00, 0x65, 0x00, 0x7A, 0x00, 0x20, 0x00, 0x73, 0x00, 0x70, 0x00, 0x61, 0x00, 0x77, 0x00,
-    0x6E, 0x00, 0x65, 0x00, 0x64, 0x00, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x97, 0xB3, 0x6C, 0xA6,
-    0xEE, 0xDE, 0xE8, 0x41, 0x80, 0x8A, 0x88, 0xFA, 0x48, 0xFD, 0x88, 0x05, 0x00, 0x04, 0x20, 0x01,
-    0x01, 0x08, 0x03, 0x20, 0x00, 0x01, 0x05, 0x20, 0x01, 0x01, 0x11, 0x11, 0x04, 0x20, 0x01, 0x01,
-    0x0E, 0x05, 0x20, 0x01, 0x01, 0x11, 0x3D, 0x05, 0x20, 0x01, 0x01, 0x12, 0x51, 0x05, 0x20, 0x01,
-    0x01, 0x12, 0x65, 0x08, 0x15, 0x12, 0x08, 0x02, 0x13, 0x00, 0x13, 0x01, 0x03, 0x06, 0x13, 0x00,
-    0x03, 0x06, 0x13, 0x01, 0x0A, 0x07, 0x01, 0x15, 0x12, 0x08, 0x02, 0x13, 0x00, 0x13, 0x01, 0x06,
-    0x15, 0x12, 0x79, 0x01, 0x13, 0x00, 0x08, 0x00, 0x00, 0x15, 0x12, 0x79, 0x01, 0x13, 0x00, 0x07,
-    0x20, 0x02, 0x02, 0x13, 0x00, 0x13, 0x00, 0x06, 0x15, 0x12, 0x79, 0x01, 0x13, 0x01, 0x05, 0x20,
-    0x01, 0x08, 0x13, 0x00, 0x06, 0x07, 0x02, 0x13, 0x00, 0x13, 0x01, 0x02, 0x13, 0x00, 0x03, 0x20,
-    0x00, 0x0E, 0x02, 0x13, 0x01, 0x09, 0x00, 0x03, 0x0E, 0x12, 0x80, 0x81, 0x0E, 0x1D, 0x1C, 0x04,
-    0x00, 0x01, 0x01, 0x0E, 0x04, 0x07, 0x01, 0x12, 0x10, 0x04, 0x00, 0x00, 0x11, 0x71, 0x07, 0x30,
-    0x01, 0x01, 0x01, 0x10, 0x1E, 0x00, 0x04, 0x0A, 0x01, 0x12, 0x10, 0x04, 0x20, 0x00, 0x12, 0x61,
-    0x0C, 0x07, 0x07, 0x08, 0x02, 0x02, 0x11, 0x69, 0x12, 0x10, 0x02, 0x12, 0x6D, 0x05, 0x00, 0x02,
-    0x02, 0x08, 0x08, 0x04, 0x00, 0x01, 0x08, 0x0E, 0x04, 0x00, 0x01, 0x02, 0x09, 0x04, 0x00, 0x01,
-    0x01, 0x09, 0x05, 0x00, 0x01, 0x12, 0x61, 0x08, 0x04, 0x20, 0x00, 0x11, 0x69, 0x03, 0x20, 0x00,
-    0x02, 0x0A, 0x30, 0x02, 0x02, 0x01, 0x10, 0x1E, 0x00, 0x10, 0x1E, 0x01, 0x06, 0x0A, 0x02, 0x11,
-    0x69, 0x12, 0x10, 0x03, 0x00, 0x00, 0x08, 0x06, 0x00, 0x02, 0x11, 0x75, 0x08, 0x02, 0x04, 0x00,
-    0x01, 0x0C, 0x08, 0x02, 0x06, 0x0C, 0x0A, 0x00, 0x07, 0x08, 0x09, 0x0C, 0x0C, 0x0C, 0x0C, 0x02,
-    0x02, 0x06, 0x00, 0x03, 0x01, 0x08, 0x08, 0x08, 0x08, 0x15, 0x12, 0x08, 0x02, 0x1D, 0x08, 0x1D,
-    0x0E, 0x07, 0x20, 0x02, 0x01, 0x13, 0x00, 0x13, 0x01, 0x06, 0x00, 0x02, 0x01, 0x0E, 0x1D, 0x1C,
-    0x05, 0x20, 0x01, 0x01, 0x12, 0x6D, 0x08, 0xB7, 0x7A, 0x5C, 0x56, 0x19, 0x34, 0xE0, 0x89, 0x02,
-    0x06, 0x08, 0x03, 0x06, 0x11, 0x71, 0x03, 0x06, 0x12, 0x0C, 0x02, 0x06, 0x09, 0x03, 0x06, 0x11,
-    0x75, 0x03, 0x06, 0x11, 0x69, 0x04, 0x20, 0x00, 0x13, 0x00, 0x04, 0x20, 0x00, 0x13, 0x01, 0x04,
-    0x20, 0x01, 0x02, 0x1C, 0x03, 0x20, 0x00, 0x08, 0x04, 0x28, 0x00, 0x13, 0x00, 0x04, 0x28, 0x00,
-    0x13, 0x01, 0x08, 0x01, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1E, 0x01, 0x00, 0x01, 0x00,
-    0x54, 0x02, 0x16, 0x57, 0x72, 0x61, 0x70, 0x4E, 0x6F, 0x6E, 0x45, 0x78, 0x63, 0x65, 0x70, 0x74,
-    0x69, 0x6F, 0x6E, 0x54, 0x68, 0x72, 0x6F, 0x77, 0x73, 0x01, 0x08, 0x01, 0x00, 0x07, 0x01, 0x00,
-    0x00, 0x00, 0x00, 0x4D, 0x01, 0x00, 0x1C, 0x2E, 0x4E, 0x45, 0x54, 0x46, 0x72, 0x61, 0x6D, 0x65,
-    0x77, 0x6F, 0x72, 0x6B, 0x2C, 0x56, 0x65, 0x72, 0x73, 0x69, 0x6F, 0x6E, 0x3D, 0x76, 0x34, 0x2E,
-    0x35, 0x2E, 0x32, 0x01, 0x00, 0x54, 0x0E, 0x14, 0x46, 0x72, 0x61, 0x6D, 0x65, 0x77, 0x6F, 0x72,
-    0x6B, 0x44, 0x69, 0x73, 0x70, 0x6C, 0x61, 0x79, 0x4E, 0x61, 0x6D, 0x65, 0x14, 0x2E, 0x4E, 0x45,
-    0x54, 0x20, 0x46, 0x72, 0x61, 0x6D, 0x65, 0x77, 0x6F, 0x72, 0x6B, 0x20, 0x34, 0x2E, 0x35, 0x2E,
-    0x32, 0x1C, 0x01, 0x00, 0x17, 0x45, 0x78, 0x65, 0x63, 0x75, 0x74, 0x65, 0x64, 0x52, 0x65, 0x73,
-    0x6F, 0x75, 0x72, 0x63, 0x65, 0x2E, 0x43, 0x6C, 0x69, 0x65, 0x6E, 0x74, 0x00, 0x00, 0x0A, 0x01,
-    0x00, 0x05, 0x44, 0x65, 0x62, 0x75, 0x67, 0x00, 0x00, 0x0C, 0x01, 0x00, 0x07, 0x31, 0x2E, 0x30,
-    0x2E, 0x30, 0x2E, 0x30, 0x00, 0x00, 0x0A, 0x01, 0x00, 0x05, 0x31, 0x2E, 0x30, 0x2E, 0x30, 0x00,
-    0x00, 0x04, 0x01, 0x00, 0x00, 0x00, 0x34, 0x01, 0x00, 0x2F, 0x45, 0x78, 0x65, 0x63, 0x75, 0x74,
-    0x65, 0x64, 0x52, 0x65, 0x73, 0x6F, 0x75, 0x72, 0x63, 0x65, 0x2E, 0x43, 0x6C, 0x69, 0x65, 0x6E,
-    0x74, 0x2E, 0x43, 0x6C, 0x69, 0x65, 0x6E, 0x74, 0x4D, 0x61, 0x69, 0x6E, 0x2B, 0x3C, 0x4F, 0x6E,
-    0x54, 0x69, 0x63, 0x6B, 0x3E, 0x64, 0x5F, 0x5F, 0x31, 0x00, 0x00, 0x08, 0x01, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x40, 0x01, 0x00, 0x23, 0x5C, 0x7B, 0x20, 0x63, 0x6F, 0x6C, 0x6F, 0x72,
-    0x20, 0x3D, 0x20, 0x7B, 0x63, 0x6F, 0x6C, 0x6F, 0x72, 0x7D, 0x2C, 0x20, 0x61, 0x72, 0x67, 0x73,
-    0x20, 0x3D, 0x20, 0x7B, 0x61, 0x72, 0x67, 0x73, 0x7D, 0x20, 0x7D, 0x01, 0x00, 0x54, 0x0E, 0x04,
-    0x54, 0x79, 0x70, 0x65, 0x10, 0x3C, 0x41, 0x6E, 0x6F, 0x6E, 0x79, 0x6D, 0x6F, 0x75, 0x73, 0x20,
-    0x54, 0x79, 0x70, 0x65, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB1, 0x53, 0x61, 0xA2,
-    0x00, 0x01, 0x4D, 0x50, 0x02, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0xF8, 0x33, 0x00, 0x00,
-    0xF8, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-    0x13, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x30, 0x34, 0x00, 0x00, 0x30, 0x16, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0x11, 0x00, 0x00, 0x00, 0xCF, 0x0C, 0x00, 0x00,
-    0x57, 0x34, 0x00, 0x00, 0x57, 0x16, 0x00, 0x00, 0x52, 0x53, 0x44, 0x53, 0x9C, 0x51, 0x15, 0x1A,
-    0x47, 0x3F, 0x16, 0x40, 0x83, 0x54, 0x5E, 0x10, 0x4D, 0x3D, 0xCA, 0xD7, 0x01, 0x00, 0x00, 0x00,
-    0x45, 0x78, 0x65, 0x63, 0x75, 0x74, 0x65, 0x64, 0x52, 0x65, 0x73, 0x6F, 0x75, 0x72, 0x63, 0x65,
-    0x2E, 0x43, 0x6C, 0x69, 0x65, 0x6E, 0x74, 0x2E, 0x6E, 0x65, 0x74, 0x2E, 0x70, 0x64, 0x62, 0x00,
-    0x53, 0x48, 0x41, 0x32, 0x35, 0x36, 0x00, 0x9C, 0x51, 0x15, 0x1A, 0x47, 0x3F, 0x16, 0xD0, 0xC3,
-    0x54, 0x5E, 0x10, 0x4D, 0x3D, 0xCA, 0xD7, 0xB1, 0x53, 0x61, 0x22, 0xB3, 0xC1, 0x42, 0x22, 0x69,
-    0xB1, 0xE4, 0xDC, 0xAD, 0x2F, 0xAD, 0xB7, 0x4D, 0x50, 0x44, 0x42, 0x9C, 0x15, 0x00, 0x00, 0x9D,
-    0x98, 0x09, 0x5C, 0x13, 0xC7, 0x1A, 0xC0, 0x67, 0x43, 0x0C, 0x97, 0x28, 0xB7, 0xAF, 0x4A, 0x2D,
-    0x22, 0x6A, 0x15, 0x89, 0x1C, 0xE1, 0x52, 0x29, 0x10, 0x12, 0xCE, 0x84, 0x20, 0xC1, 0xC2, 0xAB,
-    0xE7, 0x26, 0x2C, 0x18, 0x4C, 0x36, 0x61, 0x77, 0x83, 0x44, 0x2B, 0x82, 0xDA, 0x4A, 0x05, 0xAD,
-    0x88, 0x5C, 0xDE, 0x57, 0x3D, 0xD0, 0xE2, 0x8D, 0x78, 0x80, 0x56, 0xAB, 0xD4, 0xAB, 0xC5, 0x5A,
-    0x95, 0xB6, 0x2A, 0x5A, 0x4B, 0xAB, 0x56, 0xEB, 0xD9, 0xA7, 0x56, 0x2B, 0x6F, 0x96, 0x4C, 0x62,
-    0x0C, 0xB4, 0xEF, 0xF7, 0x7B, 0xF9, 0xFD, 0x66, 0x67, 0x76, 0xF2, 0xFD, 0xBF, 0xF9, 0xE6, 0xF8,
-    0xE6, 0x9B, 0x1D, 0xA1, 0x3C, 0x49, 0x88, 0x01, 0x0C, 0xB0, 0xBF, 0xDE, 0x30, 0xA5, 0x8A, 0x84,
-    0xDE, 0xF9, 0x81, 0xFC, 0x80, 0xAE, 0x0A, 0xC0, 0x03, 0x1F, 0xC2, 0xA7, 0x0E, 0xA6, 0xC1, 0xA9,
-    0x59, 0x0A, 0xB6, 0xE6, 0x2E, 0x4A, 0x83, 0x0B, 0x01, 0x68, 0x83, 0x18, 0x97, 0x2D, 0xCB, 0x19,
-    0x4A, 0x45, 0xE6, 0xD0, 0xEC, 0xFF, 0x57, 0x4C, 0x75, 0xE3, 0xE5, 0xE0, 0x3A, 0x2C, 0x17, 0xB1,
-    0xE5, 0xF8, 0xF1, 0x89, 0x22, 0x98, 0x4F, 0xE5, 0x00, 0x30, 0xD6, 0x0D, 0xBE, 0x0B, 0xD5, 0x5A,
-    0x56, 0xD9, 0xCA, 0x71, 0x1E, 0xFD, 0xE3, 0xA3, 0x3C, 0xA3, 0xE7, 0xA5, 0x4F, 0x76, 0x96, 0x46,
-    0x9E, 0xBE, 0xBC, 0x4B, 0x8E, 0xAF, 0x67, 0x75, 0x64, 0xF4, 0x5B, 0xEF, 0x68, 0xDF, 0x07, 0x74,
-    0x59, 0xE5, 0x03, 0x8C, 0xFA, 0xE0, 0x2B, 0x70, 0x44, 0x65, 0xB6, 0x7E, 0x0C, 0x4C, 0xFD, 0x2C,
-    0xDE, 0x39, 0x16, 0x89, 0x67, 0x51, 0x67, 0xF9, 0x1F, 0x30, 0xE6, 0xC6, 0xCE, 0x82, 0x5F, 0x51,
-    0xCD, 0x97, 0x5D, 0x3A, 0x58, 0xDD, 0x36, 0x16, 0xFA, 0x6C, 0x61, 0x0A, 0x86, 0xA5, 0xD1, 0x90,
-    0x98, 0x0E, 0x73, 0x0A, 0xE6, 0x97, 0x61, 0xDE, 0x01, 0x73, 0x3E, 0x86, 0x81, 0xB1, 0x98, 0x49,
-    0x63, 0xF7, 0x1F, 0x06, 0x2E, 0xB9, 0xBC, 0x2E, 0xC7, 0xBA, 0x82, 0x2E, 0x7D, 0x5C, 0x60, 0x1A,
-    0x67, 0x77, 0x98, 0xEC, 0x2C, 0xDE, 0xC3, 0x61, 0x72, 0xB0, 0x78, 0xB7, 0xE7, 0x98, 0xD8, 0xB7,
-    0x5C, 0x39, 0xC8, 0x2E, 0x07, 0x48, 0x0C, 0x83, 0xA5, 0x49, 0xD8, 0x30, 0x28, 0xF9, 0x88, 0x03,
-    0xB0, 0x5E, 0x60, 0x88, 0x2B, 0xC0, 0x78, 0x20, 0xD2, 0x35, 0x1A, 0x96, 0xFD, 0xDC, 0xA2, 0x31,
-    0x5B, 0x70, 0x05, 0x96, 0xED, 0xC0, 0x1D, 0xD7, 0xD7, 0xB6, 0xF4, 0x6D, 0x1D, 0x5E, 0xD2, 0xE8,
-    0xE2, 0x26, 0x5C, 0x50, 0x3A, 0xA3, 0xCF, 0x47, 0xD5, 0xDB, 0x3D, 0x9F, 0x29, 0xC6, 0x45, 0x9D,
-    0xB4, 0xBD, 0xE0, 0xB2, 0x44, 0x0E, 0x8E, 0xCA, 0x36, 0x70, 0xD6, 0xF5, 0xBA, 0xFB, 0x6A, 0x5F,
-    0x6B, 0xD9, 0xBC, 0xA4, 0xAA, 0x1F, 0xE2, 0x14, 0xF3, 0x0F, 0x25, 0xB7, 0xD9, 0xC5, 0x4B, 0x0B,
-    0x49, 0xFB, 0x89, 0x92, 0xFA, 0x1F, 0xCE, 0x38, 0x1F, 0xCC, 0x65, 0x9C, 0xB6, 0xA4, 0x4D, 0xD1,
-    0x9F, 0x28, 0x6F, 0x16, 0xEF, 0x6D, 0xF4, 0xAE, 0xCC, 0xEB, 0x48, 0x6B, 0x9A, 0x76, 0xAE, 0xA0,
-    0xF4, 0x1A, 0xDF, 0x51, 0x58, 0xE3, 0x78, 0x23, 0x73, 0x7E, 0x63, 0xDD, 0x86, 0x13, 0x23, 0xFE,
-    0x4A, 0x1F, 0x72, 0xBB, 0x7F, 0xF4, 0xCA, 0x11, 0xCF, 0x65, 0xFD, 0x9C, 0xA9, 0x67, 0x03, 0x37,
-    0x6D, 0xD5, 0xB4, 0x3C, 0x63, 0x12, 0x9A, 0x15, 0xD3, 0x0E, 0xBF, 0x1F, 0xD0, 0x9E, 0x07, 0x38,
-    0x71, 0xA3, 0xED, 0x74, 0x94, 0x36, 0x97, 0x50, 0x32, 0xB4, 0xB3, 0xB8, 0x80, 0x50, 0xEA, 0x19,
-    0x22, 0x2B, 0x8D, 0xA0, 0xB5, 0x7A, 0x4A, 0x49, 0xF0, 0x62, 0xD5, 0x2A, 0x82, 0x64, 0x9C, 0x8C,
-    0x99, 0x14, 0x57, 0x91, 0x7C, 0x25, 0xCD, 0x9B, 0x88, 0x71, 0x9D, 0x06, 0x0E, 0xF1, 0x16, 0x24,
-    0x3D, 0x9A, 0x3C, 0xCB, 0x57, 0xDE, 0xF1, 0x5D, 0xCE, 0xDA, 0xF6, 0xC0, 0x95, 0x92, 0x94, 0x95,
-    0xBC, 0x94, 0x03, 0xBD, 0xAA, 0xF7, 0xA6, 0x0C, 0x38, 0x7A, 0x78, 0x53, 0x4B, 0x72, 0xFE, 0x1F,
-    0x3C, 0xF9, 0x34, 0x9C, 0x22, 0xB2, 0xEC, 0x44, 0x7A, 0x8D, 0xC6, 0x60, 0xE2, 0x26, 0x28, 0xBC,
-    0xDD, 0x1D, 0x2B, 0xAF, 0xA6, 0x96, 0x4C, 0xDE, 0xF1, 0x28, 0x64, 0xCE, 0xA4, 0xA5, 0x3E, 0x55,
-    0xCB, 0x4E, 0x49, 0xFF, 0x3D, 0x2E, 0x87, 0x1F, 0xF8, 0xA4, 0xB2, 0xA3, 0x30, 0x64, 0xFB, 0x42,
-    0xC3, 0x43, 0x1B, 0xAD, 0x22, 0xB7, 0x97, 0x88, 0x50, 0xE8, 0x73, 0x78, 0x24, 0xC1, 0x08, 0x42,
-    0x82, 0x82, 0xF8, 0x29, 0xE2, 0xF4, 0x38, 0x0A, 0xD7, 0x10, 0x33, 0xB4, 0xD4, 0xF4, 0x91, 0xEF,
-    0x13, 0x14, 0xAD, 0xD2, 0x92, 0x91, 0xF9, 0x02, 0x7E, 0x08, 0x3F, 0x88, 0x1F, 0x43, 0xD3, 0x84,
-    0x46, 0xA1, 0x36, 0xC4, 0x30, 0x70, 0x95, 0x2B, 0xA0, 0xF5, 0x34, 0x6C, 0xCB, 0xA9, 0xCB, 0xC6,
-    0xA2, 0x8A, 0xA2, 0xEA, 0xA2, 0x55, 0x45, 0x1B, 0xBD, 0x57, 0x3F, 0x59, 0x13, 0x3C, 0x91, 0xFF,
-    0xFC, 0x84, 0x7D, 0xBD, 0xE7, 0x12, 0x8D, 0x32, 0x23, 0x2A, 0xA4, 0x3C, 0xF5, 0xB7, 0xE9, 0x37,
-    0x07, 0x4D, 0x19, 0xBD, 0x6F, 0xE6, 0xBA, 0x79, 0x5A, 0xD7, 0xC5, 0xC3, 0xAC, 0x3B, 0xCE, 0x37,
-    0xF6, 0xD8, 0xAC, 0x3C, 0x91, 0xCC, 0xD6, 0x5A, 0xA9, 0x2D, 0xE6, 0x79, 0xFF, 0x51, 0x2E, 0x1F,
-    0xD1, 0x8A, 0x8F, 0xF2, 0xB4, 0xE3, 0x05, 0xE4, 0x9E, 0xE2, 0x36, 0x4D, 0x3D, 0xD7, 0xF4, 0xF2,
-    0xCE, 0x40, 0xF5, 0x05, 0x87, 0x9F, 0xEB, 0x46, 0xF7, 0x3A, 0x32, 0x60, 0xCB, 0xB0, 0xE2, 0x8A,
-    0x7C, 0xA3, 0xAD, 0x20, 0x08, 0x28, 0xB5, 0x1A, 0x9D, 0x4A, 0x4D, 0x50, 0xFE, 0xA6, 0x2A, 0x01,
-    0x3F, 0x50, 0xC0, 0x0F, 0xF0, 0x0F, 0xE6, 0x07, 0xC1, 0x1E, 0x06, 0xF2, 0x03, 0xFD, 0xC2, 0x82,
-    0x42, 0xC3, 0x43, 0xC3, 0x82, 0x04, 0x41, 0xA1, 0x44, 0x70, 0x40, 0x68, 0x20, 0x2E, 0x10, 0x04,
-    0x84, 0x66, 0x85, 0x06, 0x2B, 0x14, 0x21, 0x21, 0x02, 0x41, 0x04, 0x11, 0xA1, 0x08, 0x8F, 0x50,
-    0x86, 0xE2, 0x01, 0x38, 0x50, 0xE3, 0x64, 0x8E, 0x1E, 0xCF, 0x21, 0x40, 0xEC, 0x60, 0x60, 0x34,
-    0xD7, 0x3F, 0x1B, 0xAA, 0xF6, 0x57, 0x6A, 0xF5, 0x24, 0x03, 0x04, 0x40, 0xAB, 0x67, 0x74, 0x7A,
-    0xC6, 0x7F, 0xBA, 0x8A, 0xCC, 0x02, 0x22, 0x03, 0x89, 0x6B, 0x54, 0x4A, 0x5C, 0xAD, 0x36, 0x48,
-    0x54, 0xE4, 0x74, 0x22, 0x4B, 0xA2, 0x52, 0x50, 0x38, 0x65, 0x00, 0x5A, 0x1D, 0xA3, 0xD2, 0xA8,
-    0x66, 0xE2, 0x0C, 0x6B, 0x4B, 0x16, 0x3B, 0xDA, 0xFE, 0x3A, 0xB5, 0x9E, 0x06, 0x3A, 0x35, 0xCE,
-    0x64, 0x6B, 0x29, 0x0D, 0x88, 0x21, 0x0D, 0xB1, 0x3A, 0x3D, 0xA0, 0xA0, 0x4E, 0x95, 0x86, 0xB0,
-    0x30, 0x3B, 0x9C, 0x1F, 0x11, 0x1C, 0x18, 0x00, 0xB7, 0x20, 0x93, 0x1D, 0xE6, 0xFF, 0xC2, 0xF8,
-    0xC1, 0x50, 0x55, 0xB6, 0x8A, 0x84, 0xA6, 0x49, 0x12, 0xC5, 0x29, 0xE9, 0x23, 0x45, 0x62, 0xE1,
-    0xF8, 0xF8, 0x91, 0xEC, 0xF4, 0xA5, 0xC5, 0x48, 0xC5, 0x19, 0xB2, 0xB4, 0x64, 0xF6, 0x05, 0xCE,
-    0x29, 0x9B, 0x05, 0x05, 0x4C, 0x91, 0xA5, 0x4D, 0x89, 0x4F, 0x13, 0xC7, 0xA4, 0x8B, 0xD3, 0xD8,
-    0x8A, 0xE0, 0x6E, 0x15, 0x21, 0x56, 0x15, 0x02, 0x6B, 0x09, 0x41, 0x37, 0x89, 0x90, 0xC0, 0x6E,
-    0x35, 0x41, 0x16, 0x35, 0x60, 0xF1, 0x4F, 0xB1, 0x2A, 0x46, 0x35, 0x93, 0x20, 0xE3, 0x32, 0xF9,
-    0xB1, 0x5A, 0xCA, 0x3C, 0xD5, 0x59, 0x6A, 0x35, 0x74, 0xE9, 0x67, 0x9F, 0xDB, 0xE4, 0x00, 0x6F,
-    0x0F, 0x10, 0xEB, 0x63, 0x18, 0xF6, 0x41, 0xE2, 0x29, 0x51, 0xC5, 0xFD, 0x76, 0xDD, 0xA5, 0x5B,
-    0xB5, 0xF7, 0xA4, 0x2A, 0x25, 0xA5, 0xA5, 0xB5, 0xD9, 0x0C, 0x3F, 0x96, 0x5D, 0xD6, 0x3A, 0x24,
-    0xDE, 0xE5, 0xC3, 0x70, 0x0F, 0xDD, 0xE2, 0x7E, 0xA6, 0xF2, 0xC6, 0xE1, 0x33, 0xF1, 0x35, 0x97,
-    0xB2, 0xB0, 0x01, 0x13, 0x4E, 0x7D, 0x2D, 0xD5, 0x92, 0xDA, 0x9E, 0x24, 0x6D, 0x40, 0x6C, 0x9F,
-    0xD3, 0x33, 0xA7, 0x7C, 0xFD, 0xA3, 0x68, 0xDF, 0xA2, 0xED, 0xDC, 0x19, 0x97, 0x57, 0x0C, 0xEA,
-    0x92, 0x4C, 0xD5, 0xD2, 0xAA, 0x02, 0x24, 0xB8, 0x6D, 0x7D, 0x53, 0x26, 0xAB, 0x72, 0xDB, 0xF2,
-    0x9D, 0xAE, 0xD5, 0x2F, 0x6A, 0xE2, 0xAB, 0x03, 0x1D, 0x67, 0x8E, 0x9A, 0x71, 0x3E, 0x4F, 0x43,
-    0x2B, 0xB5, 0x94, 0x5A, 0xA5, 0x40, 0x62, 0xBF, 0x0F, 0x1A, 0x39, 0x89, 0xDD, 0x76, 0xAA, 0x9A,
-    0x5F, 0x30, 0x85, 0x63, 0x66, 0xC5, 0x2C, 0xCA, 0x9B, 0xF0, 0x51, 0xD9, 0xC4, 0x4C, 0x99, 0x94,
-    0xCE, 0x49, 0xC5, 0x95, 0xD3, 0x91, 0xD4, 0x03, 0xAE, 0x5F, 0x3A, 0xB8, 0x0E, 0x80, 0xE7, 0xB0,
-    0xFA, 0xC6, 0x17, 0xFB, 0x0E, 0x24, 0x6F, 0x0F, 0xDF, 0xB2, 0x79, 0xF7, 0x6E, 0x9B, 0xAD, 0x72,
-    0x03, 0xCD, 0x10, 0x1A, 0xD8, 0x7F, 0xB5, 0x1A, 0x3A, 0x3E, 0x9C, 0x3B, 0x9A, 0x9F, 0xA8, 0xD1,
-    0xE8, 0x19, 0x5C, 0xA1, 0x26, 0x10, 0x1A, 0xC1, 0xA4, 0x67, 0xB2, 0x21, 0x02, 0x9B, 0x9E, 0x10,
-    0x3A, 0x58, 0x73, 0x5A, 0x56, 0x76, 0xA9, 0x60, 0xE9, 0x91, 0xE1, 0x2D, 0xFB, 0xCC, 0x28, 0x99,
-    0xAD, 0xCA, 0xD1, 0x53, 0x5D, 0x0B, 0xC8, 0xCA, 0xF4, 0x3F, 0x2A, 0xAB, 0xDF, 0x0D, 0x9C, 0xFF,
-    0x52, 0xBC, 0x76, 0xF9, 0x77, 0xB7, 0xEB, 0x6E, 0x3E, 0x88, 0x31, 0x23, 0x14, 0xF1, 0x86, 0x24,
-    0x06, 0xBE, 0x89, 0x3B, 0x10, 0x78, 0xF6, 0xEA, 0x81, 0xA4, 0x8A, 0xAB, 0x9A, 0xF1, 0xAB, 0x3F,
-    0x39, 0x36, 0x05, 0x49, 0x8A, 0x70, 0x06, 0xB7, 0xD2, 0x39, 0xEF, 0xF0, 0x89, 0xD6, 0x41, 0x14,
-    0x11, 0xD3, 0xEC, 0xE1, 0x36, 0xE4, 0x1D, 0xE1, 0xD9, 0x31, 0x48, 0xD2, 0x42, 0x08, 0xDA, 0x7A,
-    0x6E, 0x42, 0x82, 0x61, 0x3C, 0x41, 0x8A, 0xCA, 0x23, 0xFA, 0x4C, 0xB0, 0x49, 0xDD, 0x7F, 0xDA,
-    0xA4, 0x8E, 0xC2, 0x67, 0xC0, 0x00, 0x88, 0x84, 0x4B, 0x7C, 0x93, 0xA7, 0xB2, 0x1A, 0xDF, 0xBE,
-    0xD8, 0x3A, 0x75, 0xEC, 0xA5, 0x45, 0x71, 0x25, 0x01, 0x47, 0x0F, 0x9C, 0x6B, 0x75, 0x15, 0x23,
-    0x61, 0x31, 0xC9, 0x10, 0x94, 0x8E, 0x52, 0xD1, 0x84, 0x9C, 0xA0, 0xF2, 0x55, 0x4A, 0xB8, 0x9F,
-    0xBC, 0x69, 0x49, 0x4A, 0xC1, 0x18, 0xF0, 0x80, 0x2B, 0x15, 0x36, 0x3E, 0x9A, 0x57, 0x03, 0x36,
-    0x47, 0xEB, 0x11, 0x97, 0xA2, 0xD7, 0x10, 0x94, 0x4A, 0x69, 0x92, 0x8E, 0xB8, 0x7B, 0x22, 0x05,
-    0xAC, 0x05, 0xE0, 0xFC, 0xD0, 0x00, 0x22, 0x37, 0x59, 0x17, 0x37, 0xD7, 0x7F, 0xF1, 0x5E, 0x79,
-    0xEF, 0xD5, 0x8B, 0x91, 0x74, 0x1A, 0x91, 0x8D, 0x46, 0x9E, 0x2F, 0x25, 0x18, 0x3C, 0xEB, 0x75,
-    0x87, 0xF7, 0xB0, 0xE3, 0xEE, 0xCD, 0x01, 0x87, 0x34, 0xB5, 0xE4, 0x8A, 0x28, 0xA1, 0xF4, 0x90,
-    0xAE, 0xF4, 0xF6, 0xE3, 0x0F, 0xEF, 0xF9, 0x98, 0x40, 0xA3, 0x3F, 0xF2, 0xA1, 0x71, 0x2A, 0x5C,
-    0x8D, 0x1C, 0xD8, 0xD2, 0x42, 0xD8, 0x66, 0xC8, 0xE5, 0xD3, 0xCE, 0xC1, 0x47, 0x57, 0x46, 0x1F,
-    0x19, 0x55, 0x38, 0xE1, 0x97, 0x27, 0x91, 0xC7, 0x10, 0x8A, 0xFA, 0x23, 0xD5, 0x66, 0x11, 0x6A,
-    0x7E, 0x22, 0xDB, 0x4D, 0x12, 0x57, 0xD3, 0x56, 0xAC, 0xF0, 0x78, 0xFE, 0x88, 0x61, 0x9E, 0x1D,
-    0x92, 0x45, 0x4F, 0x4A, 0xCF, 0xE9, 0x2A, 0x3F, 0x93, 0x23, 0x36, 0x83, 0x50, 0x58, 0x8D, 0xB5,
-    0x2D, 0x67, 0xAD, 0xC7, 0x6F, 0x7E, 0x67, 0x65, 0x2B, 0xFF, 0x33, 0x47, 0xF5, 0xF2, 0xCF, 0xCE,
-    0x03, 0x48, 0x30, 0x53, 0xA3, 0xB6, 0x14, 0x8C, 0xE6, 0x80, 0xAB, 0xEE, 0x0B, 0x9E, 0xB7, 0x52,
-    0xCF, 0xE3, 0xE7, 0xE9, 0x65, 0xCC, 0x7B, 0x91, 0x45, 0x4A, 0x0B, 0x41, 0xB8, 0x25, 0xE5, 0x59,
-    0xB5, 0x1F, 0x15, 0xFB, 0x54, 0x32, 0xB5, 0x73, 0x7F, 0xC2, 0xE6, 0xAD, 0xB6, 0xD7, 0x5B, 0x53,
-    0x0D, 0x2E, 0x3D, 0xAC, 0x54, 0xB8, 0xF4, 0x94, 0x7A, 0x8A, 0x7A, 0xED, 0xB4, 0x86, 0x85, 0x1F,
-    0xC9, 0xD9, 0x99, 0x11, 0xD3, 0x5B, 0x0A, 0xF4, 0xCE, 0x45, 0xA2, 0x06, 0x55, 0x58, 0xF8, 0xC9,
-    0xBA, 0x13, 0xD9, 0x3D, 0xB0, 0x46, 0xA0, 0x00, 0x01, 0x86, 0x2A, 0x72, 0xD4, 0x92, 0x0D, 0x05,
-    0x71, 0x0B, 0xAE, 0x3F, 0xDF, 0x96, 0x14, 0x52, 0x72, 0xCB, 0x0C, 0x68, 0x74, 0x5A, 0x92, 0x8D,
-    0x78, 0x5D, 0x43, 0x15, 0x43, 0x92, 0x5A, 0x06, 0xB7, 0xE4, 0x3F, 0x44, 0x7C, 0x23, 0xD7, 0x6B,
-    0x63, 0x71, 0x4E, 0xBF, 0x84, 0x45, 0x25, 0x6D, 0x47, 0xA3, 0x87, 0x46, 0x1C, 0xEB, 0x99, 0x37,
-    0x32, 0x33, 0x11, 0x13, 0x7B, 0xDD, 0xB7, 0xED, 0xCF, 0x67, 0x51, 0xE2, 0xDA, 0xB6, 0xC6, 0xB8,
-    0x90, 0x65, 0x5E, 0x54, 0xCF, 0x8C, 0x38, 0x1F, 0x16, 0x85, 0x38, 0x4D, 0x64, 0xC5, 0xD0, 0x06,
-    0x52, 0x89, 0x74, 0xCC, 0x46, 0x3A, 0x94, 0x19, 0x35, 0x77, 0x9E, 0xDE, 0x76, 0x4B, 0xA8, 0x95,
-    0xCD, 0x26, 0x3F, 0xCB, 0x8F, 0xFE, 0xD9, 0xB4, 0xCE, 0x55, 0x78, 0x0E, 0xA9, 0xA5, 0x19, 0x76,
-    0x15, 0xC2, 0x41, 0x62, 0x28, 0x1C, 0x06, 0x75, 0x84, 0xCE, 0x41, 0xA8, 0x57, 0xC1, 0x66, 0x1F,
-    0xB1, 0xC0, 0x39, 0x71, 0x73, 0x4A, 0xEB, 0xF2, 0x56, 0x9F, 0xCF, 0xCE, 0xF6, 0x80, 0x76, 0xC5,
-    0x5E, 0x84, 0x15, 0x21, 0xCC, 0x39, 0xFD, 0xC6, 0xE5, 0x3E, 0x93, 0x5A, 0xE3, 0x4A, 0x8B, 0x2B,
-    0xFE, 0xF4, 0xB9, 0x56, 0x55, 0xD3, 0x03, 0x96, 0xAE, 0xD5, 0x9A, 0x57, 0xD3, 0x5C, 0x84, 0xBD,
-    0x48, 0x3A, 0x4E, 0xB7, 0x34, 0xF8, 0x8A, 0x3F, 0xEE, 0xAB, 0x6C, 0x62, 0xF6, 0xB5, 0x5F, 0xEB,
-    0x09, 0x83, 0x56, 0xBE, 0x76, 0xCE, 0x79, 0x08, 0x5C, 0xD0, 0x8F, 0x7F, 0xE3, 0x3E, 0xE6, 0x24,
-    0xDD, 0x3D, 0xE0, 0x2A, 0xC7, 0x7B, 0xF6, 0xC7, 0x5F, 0x99, 0x40, 0x63, 0x38, 0x33, 0x7B, 0x81,
-    0x11, 0x9A, 0x8F, 0xA0, 0xDB, 0xCD, 0xB3, 0x57, 0x7C, 0x13, 0x2E, 0x90, 0x96, 0x4C, 0xA1, 0xEE,
-    0xFD, 0x55, 0x7F, 0x6C, 0x3D, 0x82, 0xE2, 0xE1, 0x71, 0xD6, 0xDA, 0x55, 0x3E, 0x46, 0xC8, 0x6F,
-    0x87, 0xA2, 0xAE, 0x0C, 0xF8, 0xFC, 0xA6, 0x78, 0xFB, 0xC0, 0xC8, 0x94, 0xB0, 0xB0, 0x82, 0x3A,
-    0x84, 0x24, 0xCA, 0x4C, 0x9B, 0x05, 0x92, 0x13, 0xCA, 0x77, 0xAE, 0xBB, 0xD6, 0x91, 0x9D, 0x54,
-    0xB2, 0xA1, 0xE8, 0xE3, 0xDA, 0x9F, 0x08, 0x93, 0x37, 0x5A, 0x2C, 0xE0, 0x4F, 0x4C, 0x5D, 0xFE,
-    0xBE, 0x31, 0x73, 0xD9, 0xD6, 0xCF, 0x92, 0x8A, 0x1B, 0xA4, 0x83, 0x8F, 0xD5, 0x8B, 0xD6, 0x59,
-    0x4A, 0x8A, 0x0B, 0x74, 0x14, 0x41, 0xD3, 0x16, 0x2B, 0x69, 0x21, 0xA2, 0x22, 0x6D, 0x7E, 0x75,
-    0x94, 0xDB, 0x3C, 0x96, 0xAC, 0x10, 0x76, 0x36, 0xAF, 0xE9, 0xE8, 0x95, 0x64, 0x49, 0xA5, 0xE2,
-    0x14, 0x8C, 0xDF, 0xE6, 0x85, 0x54, 0x86, 0x90, 0x8B, 0x53, 0xDB, 0x24, 0x7B, 0x3E, 0xA8, 0x16,
-    0x1F, 0xB9, 0x55, 0x7E, 0xC4, 0xB5, 0xF0, 0x41, 0xBD, 0x25, 0x32, 0x4E, 0x4F, 0x50, 0x06, 0x8B,
-    0xCD, 0x7C, 0x11, 0x62, 0xEE, 0x4D, 0x96, 0xD9, 0x8F, 0x78, 0x8B, 0x27, 0x5C, 0xE7, 0xB7, 0x6C,
-    0xF0, 0xD8, 0x59, 0xE4, 0x05, 0xD3, 0xDE, 0x45, 0x30, 0x6C, 0x62, 0x8F, 0x57, 0xEC, 0x49, 0x87,
-    0xD2, 0x58, 0x0E, 0xD5, 0xA7, 0x88, 0xE5, 0x2F, 0x39, 0x78, 0xCC, 0xDF, 0xB7, 0x26, 0x69, 0x81,
-    0xDB, 0xE2, 0x0F, 0x98, 0x2F, 0x4E, 0x52, 0x16, 0x6C, 0x2A, 0x05, 0xCF, 0x12, 0x8C, 0x2A, 0xDF,
-    0xBC, 0x57, 0x96, 0x23, 0x26, 0xA1, 0xF9, 0xA2, 0x37, 0x77, 0xE1, 0x9F, 0xA2, 0xB2, 0xC1, 0x77,
-    0xDA, 0xCF, 0x88, 0x6A, 0x25, 0x16, 0x4C, 0x1A, 0x91, 0xA7, 0x27, 0x68, 0xF3, 0xFA, 0x5C, 0x8A,
-    0x88, 0xBA, 0xC7, 0x31, 0x9F, 0x5E, 0x31, 0x84, 0x47, 0x7F, 0x3E, 0xB5, 0x73, 0x76, 0xAB, 0xE4,
-    0xC1, 0x42, 0x44, 0xC8, 0x14, 0xEC, 0x09, 0xD5, 0xD2, 0x9F, 0x2A, 0x10, 0x90, 0xAC, 0x75, 0x7A,
-    0xC6, 0xBF, 0x35, 0x52, 0x56, 0x14, 0x73, 0xAE, 0x65, 0x67, 0xB0, 0xA2, 0xA2, 0xFB, 0x06, 0x6B,
-    0x94, 0xAF, 0x44, 0xF2, 0x57, 0xF6, 0x88, 0x7F, 0xC7, 0xCB, 0x68, 0xD1, 0xFE, 0x3E, 0x1E, 0x31,
-    0xF4, 0x3B, 0x9D, 0x27, 0xBB, 0xCB, 0x8B, 0x61, 0x5F, 0x10, 0x54, 0x85, 0x20, 0xFB, 0x86, 0xE8,
-    0xFB, 0xFE, 0x3B, 0x8E, 0x09, 0x9B, 0xD2, 0x3D, 0x56, 0xBF, 0xC4, 0x2E, 0x3F, 0xFC, 0x1B, 0x28,
-    0x51, 0x12, 0x4F, 0x90, 0xC4, 0x1B, 0x31, 0xB1, 0xDA, 0x34, 0xC1, 0x3A, 0xCF, 0x6B, 0xF3, 0x5A,
-    0xBC, 0xA2, 0xAB, 0xF2, 0x7D, 0xB6, 0x55, 0x1D, 0x1B, 0x71, 0xF3, 0x6F, 0x34, 0x48, 0x54, 0x39,
-    0xD3, 0x98, 0x19, 0x04, 0xFB, 0x44, 0x0A, 0x6A, 0x90, 0x82, 0xF3, 0x07, 0xBF, 0xF5, 0xBA, 0x7F,
-    0x7A, 0xB9, 0x64, 0x69, 0x6A, 0xE6, 0xA6, 0x0B, 0x37, 0x32, 0xDC, 0x7B, 0x50, 0x50, 0xC0, 0x10,
-    0xA4, 0xE5, 0xE2, 0x5A, 0x8E, 0xD0, 0xAC, 0x03, 0xDC, 0x0B, 0xA0, 0xBD, 0x55, 0xB6, 0x4C, 0x54,
-    0xDA, 0x5E, 0x38, 0xA6, 0x36, 0xBB, 0x3B, 0xDA, 0x6D, 0x02, 0x57, 0x20, 0xF4, 0xE8, 0xE4, 0xB6,
-    0xCE, 0xDC, 0x93, 0x5F, 0x24, 0x6E, 0x2F, 0xBF, 0x18, 0x75, 0xB1, 0xF5, 0xD7, 0x42, 0x33, 0x6A,
-    0x3C, 0x78, 0xD2, 0xE6, 0x92, 0x14, 0x27, 0xE1, 0x51, 0x90, 0x42, 0xF8, 0x2A, 0x84, 0xDF, 0x62,
-    0xCA, 0xDF, 0x5D, 0xD5, 0x5E, 0x29, 0xDC, 0x96, 0x7F, 0xCD, 0xC5, 0x3F, 0x38, 0x02, 0x58, 0x05,
-    0x31, 0xA3, 0xF0, 0x6A, 0x56, 0x18, 0x6E, 0xFD, 0xDC, 0x1D, 0x2E, 0x7B, 0x5A, 0x86, 0xE4, 0xC6,
-    0x37, 0x74, 0x44, 0x3E, 0xD0, 0x85, 0x7D, 0x1F, 0x61, 0x25, 0xDC, 0xAD, 0x7B, 0x6B, 0x51, 0x23,
-    0xEF, 0x15, 0xE7, 0x79, 0xDD, 0x6D, 0xAE, 0x8D, 0xDD, 0xA2, 0x8E, 0x1B, 0x5A, 0xB4, 0x70, 0x07,
-    0x6D, 0xC5, 0x75, 0x45, 0x3A, 0xAD, 0xCE, 0x2A, 0x9A, 0xAF, 0x43, 0x70, 0xD1, 0xE8, 0xBF, 0x3E,
-    0x7D, 0x58, 0xFF, 0x30, 0xB1, 0x22, 0xEA, 0xC8, 0x92, 0x25, 0xDF, 0xBA, 0xCC, 0xFA, 0x1F, 0x70,
-    0x06, 0x3C, 0x54, 0x6B, 0x67, 0xD0, 0x6F, 0x76, 0x60, 0x03, 0xD2, 0x75, 0x28, 0xFD, 0xA7, 0xB2,
-    0x47, 0x79, 0x5C, 0x59, 0x0D, 0xAF, 0x72, 0xF0, 0x81, 0x97, 0xC1, 0xC7, 0xAD, 0x74, 0x59, 0x9D,
-    0x10, 0x36, 0x22, 0x2A, 0xF7, 0xBD, 0xF1, 0x6B, 0x47, 0x3C, 0x9D, 0x2B, 0xFB, 0xE4, 0x45, 0xE5,
-    0xFE, 0x06, 0xC7, 0x2F, 0x1F, 0xFD, 0x63, 0xA0, 0x4F, 0xA2, 0xCD, 0x2B, 0x6B, 0x13, 0xE2, 0x87,
-    0x4F, 0x6A, 0x57, 0x36, 0xD9, 0xDE, 0x4B, 0x9E, 0xBF, 0x25, 0x01, 0xD8, 0xCE, 0xB9, 0x59, 0xF1,
-    0x8F, 0x7C, 0xB7, 0x89, 0xDE, 0x8C, 0xB4, 0xF4, 0x7D, 0xEB, 0x78, 0xF5, 0x7D, 0xD5, 0xBD, 0xA4,
-    0x92, 0x43, 0x83, 0xC6, 0xE5, 0xFC, 0xCC, 0x8B, 0xFE, 0x47, 0x2D, 0xAF, 0x83, 0xFC, 0x16, 0x84,
-    0xA7, 0x5C, 0xF5, 0xBB, 0x5D, 0xE4, 0xEB, 0x27, 0xDA, 0x1A, 0xE9, 0xCD, 0x1F, 0xCD, 0xDF, 0xF7,
-    0xB9, 0xF9, 0xC8, 0x01, 0x23, 0xB5, 0x8A, 0x31, 0xB0, 0xED, 0x92, 0x4A, 0x95, 0x0E, 0x37, 0x71,
-    0x75, 0x88, 0xF3, 0x9F, 0xB6, 0xF3, 0xE0, 0x49, 0xD7, 0x54, 0xF1, 0x9A, 0x61, 0xB7, 0x2B, 0xDF,
-    0xEB, 0xF3, 0x7D, 0x59, 0x4F, 0x47, 0x15, 0x91, 0x5E, 0xA7, 0x26, 0xCC, 0xC7, 0x63, 0x04, 0x72,
-    0x76, 0xB9, 0xE6, 0xB8, 0x79, 0x1C, 0x8E, 0xDD, 0xE8, 0x2E, 0x3D, 0x58, 0xF6, 0x6A, 0xF6, 0xF9,
-    0x9E, 0xC0, 0x04, 0x86, 0x31, 0x1D, 0xBF, 0xB7, 0x9B, 0xDC, 0xB0, 0x70, 0x1D, 0x73, 0xE8, 0xDB,
-    0x69, 0xF1, 0x1B, 0x3C, 0x65, 0x0E, 0x6B, 0xD7, 0x08, 0xA7, 0xF6, 0x84, 0xC1, 0xDD, 0x29, 0x5D,
-    0x69, 0x02, 0xEB, 0x11, 0x78, 0xE9, 0xF2, 0xDB, 0xAD, 0x63, 0x94, 0xE7, 0x63, 0x97, 0x0F, 0x12,
-    0x3D, 0x6E, 0x7A, 0x75, 0x8D, 0xEC, 0x09, 0xEC, 0x36, 0xB8, 0x3B, 0x4C, 0x6E, 0x20, 0xDB, 0x99,
-    0x1B, 0x96, 0xED, 0x2C, 0x2A, 0x6D, 0xCA, 0x1C, 0xE8, 0xF9, 0x6C, 0xE4, 0xDD, 0x9E, 0x60, 0xF3,
-    0x50, 0x19, 0xD1, 0x5D, 0x08, 0x3D, 0xF3, 0xA2, 0x6D, 0x3E, 0x77, 0xFE, 0xDE, 0x98, 0x9A, 0x91,
-    0xAB, 0xDE, 0x3E, 0x5B, 0x2B, 0x99, 0x86, 0xD0, 0x74, 0xA2, 0x80, 0x81, 0x47, 0x55, 0xA5, 0x36,
-    0xEB, 0x75, 0xEC, 0xDC, 0x6D, 0x8A, 0xD5, 0x5F, 0x0D, 0x57, 0x6F, 0x77, 0x8F, 0x4C, 0xAE, 0x7C,
-    0xFA, 0xC5, 0x61, 0x4C, 0x51, 0xB7, 0xA0, 0x47, 0xA4, 0x9B, 0x37, 0xED, 0x41, 0xF4, 0xE2, 0x2B,
-    0x3B, 0x6F, 0xD7, 0x51, 0xB9, 0xD2, 0x86, 0x8E, 0xB6, 0x35, 0x6D, 0x6D, 0xFF, 0xE9, 0xB4, 0xA4,
-    0xD3, 0x88, 0x1C, 0xBD, 0x1A, 0xA7, 0xBA, 0x87, 0xB1, 0x7D, 0xA6, 0x51, 0xF2, 0xFA, 0xF0, 0x3A,
-    0x98, 0x55, 0x15, 0xBB, 0x61, 0xE3, 0x8F, 0x5A, 0xA7, 0xC8, 0x47, 0x2D, 0x26, 0x78, 0x1A, 0x45,
-    0xE0, 0x16, 0x96, 0x36, 0x20, 0xF1, 0xCB, 0x35, 0xF7, 0xF1, 0x5D, 0x3F, 0xCC, 0x4C, 0xAA, 0xBF,
-    0xB5, 0x03, 0xE7, 0x9D, 0xEB, 0xFD, 0xB0, 0x9B, 0x78, 0x3A, 0x4E, 0x4F, 0x37, 0xB5, 0xB1, 0x1F,
-    0x41, 0x76, 0xFD, 0xAF, 0xB5, 0xE7, 0x78, 0x35, 0x48, 0x37, 0x0F, 0x6A, 0x22, 0x3A, 0x47, 0xCF,
-    0x16, 0xFC, 0x0D, 0x64, 0x15, 0x35, 0x0F, 0x9A, 0xBC, 0x4D, 0x15, 0xD8, 0x18, 0xEA, 0x75, 0x44,
-    0xB6, 0x6E, 0xFD, 0xC5, 0x55, 0xED, 0x37, 0xA6, 0xD8, 0x77, 0xA7, 0xE1, 0x72, 0x37, 0x6D, 0x63,
-    0x8D, 0xA6, 0x30, 0xF6, 0x48, 0xE9, 0x75, 0x65, 0xA3, 0xAF, 0x70, 0xEB, 0x53, 0xF7, 0xBC, 0xA4,
-    0x27, 0x03, 0x02, 0x2D, 0x8E, 0xB0, 0x69, 0x10, 0x23, 0xA8, 0x0C, 0x38, 0x73, 0x66, 0xEA, 0x10,
-    0xA2, 0x62, 0xDC, 0x5F, 0x31, 0xDF, 0x60, 0x3F, 0x4B, 0x36, 0x0D, 0x9D, 0xCF, 0xBB, 0xBE, 0xF8,
-    0xC2, 0x24, 0x0B, 0x2A, 0x53, 0xA4, 0x55, 0xC2, 0xDD, 0xC0, 0x7C, 0x82, 0x6D, 0x42, 0x08, 0x49,
-    0xBF, 0x6A, 0x0E, 0xD5, 0x28, 0x25, 0xCB, 0x93, 0x9E, 0x9D, 0x4A, 0xFE, 0x29, 0xBC, 0xD9, 0x12,
-    0xD1, 0xA8, 0x4D, 0x4E, 0x68, 0x6E, 0xA9, 0x19, 0x61, 0xF9, 0x72, 0x79, 0xFE, 0xD3, 0xD2, 0xF8,
-    0xE8, 0xEA, 0xB3, 0xCD, 0x61, 0xEB, 0x97, 0xCC, 0x68, 0xF1, 0x80, 0xDF, 0x9A, 0x6E, 0x0E, 0xF6,
-    0xB6, 0x00, 0xE3, 0xC0, 0x2F, 0x4F, 0x01, 0xC7, 0xCE, 0x11, 0x96, 0x0C, 0x3C, 0xA3, 0x36, 0xCF,
-    0x9E, 0x07, 0xAC, 0xCF, 0x9B, 0x9F, 0xC5, 0x8E, 0x58, 0xF9, 0x5D, 0xAC, 0xFC, 0x31, 0xB6, 0xD4,
-    0xC1, 0x46, 0xDA, 0x0F, 0xCB, 0xC0, 0x8A, 0x4F, 0x62, 0xC5, 0x0F, 0xB0, 0xB9, 0x7E, 0xD8, 0x5C,
-    0x25, 0x36, 0xB7, 0x1C, 0x9B, 0x7B, 0x04, 0x9B, 0xFB, 0x4B, 0x2F, 0xF8, 0x55, 0x5B, 0xBC, 0xB0,
-    0xA8, 0x9A, 0x6B, 0xBC, 0x90, 0x73, 0x00, 0x98, 0x8B, 0x3D, 0x06, 0x06, 0x71, 0xEC, 0x7A, 0xB3,
-    0x97, 0x7C, 0x5D, 0x6D, 0x0F, 0xE7, 0xD8, 0x39, 0x83, 0x70, 0x2E, 0x78, 0x87, 0xBD, 0x26, 0xEB,
-    0xAA, 0xB1, 0xE5, 0xD8, 0xF5, 0x02, 0xEE, 0x3C, 0x43, 0x6F, 0xF6, 0xB2, 0x0F, 0x63, 0x6F, 0xD5,
-    0x9C, 0x39, 0x76, 0x4E, 0x00, 0x8C, 0x67, 0x4D, 0xC4, 0xC0, 0xC0, 0x59, 0xC0, 0x99, 0xBD, 0xE6,
-    0xFB, 0x97, 0x03, 0x70, 0x04, 0x43, 0x38, 0xC0, 0x15, 0x0C, 0xE5, 0x02, 0x17, 0xE0, 0xC5, 0x01,
-    0xFD, 0x8C, 0x0F, 0x0F, 0x0E, 0x7C, 0x1D, 0xC7, 0x05, 0x7E, 0xC0, 0x97, 0x07, 0xDC, 0x80, 0x37,
-    0x0F, 0xF4, 0xE6, 0xF2, 0xB8, 0x20, 0x12, 0x60, 0x0E, 0x10, 0x67, 0x2F, 0x10, 0xFB, 0xB3, 0x9A,
-    0xEC, 0x00, 0x70, 0x62, 0x3F, 0xB9, 0x4B, 0x61, 0xAA, 0x63, 0x2F, 0xE8, 0xA2, 0x7D, 0xE1, 0x73,
-    0x2F, 0x94, 0xF8, 0x7F, 0xF3, 0xBE, 0x5E, 0x18, 0xC7, 0x99, 0x53, 0xF4, 0xA9, 0x4F, 0x71, 0x29,
-    0xE0, 0x14, 0x8B, 0x00, 0xF8, 0x2F, 0x4E, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x68, 0x41, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5A, 0x41,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5F, 0x43, 0x6F, 0x72,
-    0x44, 0x6C, 0x6C, 0x4D, 0x61, 0x69, 0x6E, 0x00, 0x6D, 0x73, 0x63, 0x6F, 0x72, 0x65, 0x65, 0x2E,
-    0x64, 0x6C, 0x6C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x25, 0x00, 0x20, 0x00, 0x10,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00,
-    0x10, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x80,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x48, 0x00, 0x00, 0x00, 0x58, 0x60, 0x00, 0x00, 0x5C, 0x03, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5C, 0x03, 0x34, 0x00, 0x00, 0x00, 0x56, 0x00,
-    0x53, 0x00, 0x5F, 0x00, 0x56, 0x00, 0x45, 0x00, 0x52, 0x00, 0x53, 0x00, 0x49, 0x00, 0x4F, 0x00,
-    0x4E, 0x00, 0x5F, 0x00, 0x49, 0x00, 0x4E, 0x00, 0x46, 0x00, 0x4F, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xBD, 0x04, 0xEF, 0xFE, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x04, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x44, 0x00, 0x00, 0x00, 0x01, 0x00, 0x56, 0x00, 0x61, 0x00, 0x72, 0x00,
-    0x46, 0x00, 0x69, 0x00, 0x6C, 0x00, 0x65, 0x00, 0x49, 0x00, 0x6E, 0x00, 0x66, 0x00, 0x6F, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x24, 0x00, 0x04, 0x00, 0x00, 0x00, 0x54, 0x00, 0x72, 0x00, 0x61, 0x00,
-    0x6E, 0x00, 0x73, 0x00, 0x6C, 0x00, 0x61, 0x00, 0x74, 0x00, 0x69, 0x00, 0x6F, 0x00, 0x6E, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB0, 0x04, 0xBC, 0x02, 0x00, 0x00, 0x01, 0x00, 0x53, 0x00,
-    0x74, 0x00, 0x72, 0x00, 0x69, 0x00, 0x6E, 0x00, 0x67, 0x00, 0x46, 0x00, 0x69, 0x00, 0x6C, 0x00,
-    0x65, 0x00, 0x49, 0x00, 0x6E, 0x00, 0x66, 0x00, 0x6F, 0x00, 0x00, 0x00, 0x98, 0x02, 0x00, 0x00,
-    0x01, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x34, 0x00, 0x62, 0x00,
-    0x30, 0x00, 0x00, 0x00, 0x50, 0x00, 0x18, 0x00, 0x01, 0x00, 0x43, 0x00, 0x6F, 0x00, 0x6D, 0x00,
-    0x70, 0x00, 0x61, 0x00, 0x6E, 0x00, 0x79, 0x00, 0x4E, 0x00, 0x61, 0x00, 0x6D, 0x00, 0x65, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x45, 0x00, 0x78, 0x00, 0x65, 0x00, 0x63, 0x00, 0x75, 0x00, 0x74, 0x00,
-    0x65, 0x00, 0x64, 0x00, 0x52, 0x00, 0x65, 0x00, 0x73, 0x00, 0x6F, 0x00, 0x75, 0x00, 0x72, 0x00,
-    0x63, 0x00, 0x65, 0x00, 0x2E, 0x00, 0x43, 0x00, 0x6C, 0x00, 0x69, 0x00, 0x65, 0x00, 0x6E, 0x00,
-    0x74, 0x00, 0x00, 0x00, 0x58, 0x00, 0x18, 0x00, 0x01, 0x00, 0x46, 0x00, 0x69, 0x00, 0x6C, 0x00,
-    0x65, 0x00, 0x44, 0x00, 0x65, 0x00, 0x73, 0x00, 0x63, 0x00, 0x72, 0x00, 0x69, 0x00, 0x70, 0x00,
-    0x74, 0x00, 0x69, 0x00, 0x6F, 0x00, 0x6E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x45, 0x00, 0x78, 0x00,
-    0x65, 0x00, 0x63, 0x00, 0x75, 0x00, 0x74, 0x00, 0x65, 0x00, 0x64, 0x00, 0x52, 0x00, 0x65, 0x00,
-    0x73, 0x00, 0x6F, 0x00, 0x75, 0x00, 0x72, 0x00, 0x63, 0x00, 0x65, 0x00, 0x2E, 0x00, 0x43, 0x00,
-    0x6C, 0x00, 0x69, 0x00, 0x65, 0x00, 0x6E, 0x00, 0x74, 0x00, 0x00, 0x00, 0x30, 0x00, 0x08, 0x00,
-    0x01, 0x00, 0x46, 0x00, 0x69, 0x00, 0x6C, 0x00, 0x65, 0x00, 0x56, 0x00, 0x65, 0x00, 0x72, 0x00,
-    0x73, 0x00, 0x69, 0x00, 0x6F, 0x00, 0x6E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x31, 0x00, 0x2E, 0x00,
-    0x30, 0x00, 0x2E, 0x00, 0x30, 0x00, 0x2E, 0x00, 0x30, 0x00, 0x00, 0x00, 0x60, 0x00, 0x20, 0x00,
-    0x01, 0x00, 0x49, 0x00, 0x6E, 0x00, 0x74, 0x00, 0x65, 0x00, 0x72, 0x00, 0x6E, 0x00, 0x61, 0x00,
-    0x6C, 0x00, 0x4E, 0x00, 0x61, 0x00, 0x6D, 0x00, 0x65, 0x00, 0x00, 0x00, 0x45, 0x00, 0x78, 0x00,
-    0x65, 0x00, 0x63, 0x00, 0x75, 0x00, 0x74, 0x00, 0x65, 0x00, 0x64, 0x00, 0x52, 0x00, 0x65, 0x00,
-    0x73, 0x00, 0x6F, 0x00, 0x75, 0x00, 0x72, 0x00, 0x63, 0x00, 0x65, 0x00, 0x2E, 0x00, 0x43, 0x00,
-    0x6C, 0x00, 0x69, 0x00, 0x65, 0x00, 0x6E, 0x00, 0x74, 0x00, 0x2E, 0x00, 0x6E, 0x00, 0x65, 0x00,
-    0x74, 0x00, 0x2E, 0x00, 0x64, 0x00, 0x6C, 0x00, 0x6C, 0x00, 0x00, 0x00, 0x28, 0x00, 0x02, 0x00,
-    0x01, 0x00, 0x4C, 0x00, 0x65, 0x00, 0x67, 0x00, 0x61, 0x00, 0x6C, 0x00, 0x43, 0x00, 0x6F, 0x00,
-    0x70, 0x00, 0x79, 0x00, 0x72, 0x00, 0x69, 0x00, 0x67, 0x00, 0x68, 0x00, 0x74, 0x00, 0x00, 0x00,
-    0x20, 0x00, 0x00, 0x00, 0x68, 0x00, 0x20, 0x00, 0x01, 0x00, 0x4F, 0x00, 0x72, 0x00, 0x69, 0x00,
-    0x67, 0x00, 0x69, 0x00, 0x6E, 0x00, 0x61, 0x00, 0x6C, 0x00, 0x46, 0x00, 0x69, 0x00, 0x6C, 0x00,
-    0x65, 0x00, 0x6E, 0x00, 0x61, 0x00, 0x6D, 0x00, 0x65, 0x00, 0x00, 0x00, 0x45, 0x00, 0x78, 0x00,
-    0x65, 0x00, 0x63, 0x00, 0x75, 0x00, 0x74, 0x00, 0x65, 0x00, 0x64, 0x00, 0x52, 0x00, 0x65, 0x00,
-    0x73, 0x00, 0x6F, 0x00, 0x75, 0x00, 0x72, 0x00, 0x63, 0x00, 0x65, 0x00, 0x2E, 0x00, 0x43, 0x00,
-    0x6C, 0x00, 0x69, 0x00, 0x65, 0x00, 0x6E, 0x00, 0x74, 0x00, 0x2E, 0x00, 0x6E, 0x00, 0x65, 0x00,
-    0x74, 0x00, 0x2E, 0x00, 0x64, 0x00, 0x6C, 0x00, 0x6C, 0x00, 0x00, 0x00, 0x50, 0x00, 0x18, 0x00,
-    0x01, 0x00, 0x50, 0x00, 0x72, 0x00, 0x6F, 0x00, 0x64, 0x00, 0x75, 0x00, 0x63, 0x00, 0x74, 0x00,
-    0x4E, 0x00, 0x61, 0x00, 0x6D, 0x00, 0x65, 0x00, 0x00, 0x00, 0x00, 0x00, 0x45, 0x00, 0x78, 0x00,
-    0x65, 0x00, 0x63, 0x00, 0x75, 0x00, 0x74, 0x00, 0x65, 0x00, 0x64, 0x00, 0x52, 0x00, 0x65, 0x00,
-    0x73, 0x00, 0x6F, 0x00, 0x75, 0x00, 0x72, 0x00, 0x63, 0x00, 0x65, 0x00, 0x2E, 0x00, 0x43, 0x00,
-    0x6C, 0x00, 0x69, 0x00, 0x65, 0x00, 0x6E, 0x00, 0x74, 0x00, 0x00, 0x00, 0x30, 0x00, 0x06, 0x00,
-    0x01, 0x00, 0x50, 0x00, 0x72, 0x00, 0x6F, 0x00, 0x64, 0x00, 0x75, 0x00, 0x63, 0x00, 0x74, 0x00,
-    0x56, 0x00, 0x65, 0x00, 0x72, 0x00, 0x73, 0x00, 0x69, 0x00, 0x6F, 0x00, 0x6E, 0x00, 0x00, 0x00,
-    0x31, 0x00, 0x2E, 0x00, 0x30, 0x00, 0x2E, 0x00, 0x30, 0x00, 0x00, 0x00, 0x38, 0x00, 0x08, 0x00,
-    0x01, 0x00, 0x41, 0x00, 0x73, 0x00, 0x73, 0x00, 0x65, 0x00, 0x6D, 0x00, 0x62, 0x00, 0x6C, 0x00,
-    0x79, 0x00, 0x20, 0x00, 0x56, 0x00, 0x65, 0x00, 0x72, 0x00, 0x73, 0x00, 0x69, 0x00, 0x6F, 0x00,
-    0x6E, 0x00, 0x00, 0x00, 0x31, 0x00, 0x2E, 0x00, 0x30, 0x00, 0x2E, 0x00, 0x30, 0x00, 0x2E, 0x00,
-    0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x40, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x7C, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-};
-const unsigned int executed_len = 10752;
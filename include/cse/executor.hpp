@@ -1,46 +1,215 @@
 #pragma once
 #include <cse/mono.hpp>
+#include <cse/compression.hpp>
+#include <cse/bundle.hpp>
+#include <cse/managed_method.hpp>
+#include <cse/watchdog.hpp>
 #include <string>
 #include <vector>
 #include <optional>
+#include <deque>
+#include <chrono>
+#include <unordered_map>
+#include <mutex>
+#include <atomic>
+#include <cstdint>
 
 namespace cse
 {
     struct RuntimeInfo
     {
         MonoDomain* m_Domain = nullptr;
+
+        // tells the domain apart from a later one allocated at the same address
+        int32_t m_DomainId = -1;
+
         MonoObject* m_InternalManager = nullptr;
         MonoMethod* m_CreateAssemblyInternal = nullptr;
 
+        // thunk of CreateAssemblyInternal(string name, byte[] assembly, byte[] pdb), returns the loaded Assembly
+        ManagedMethod<MonoObject*(std::string_view, MonoArray*, MonoArray*)> m_CreateAssembly;
+
+        // resolved once at discovery, a manager never changes its resource
+        std::string m_ResourceName;
+
         std::string GetResourceName() const;
     };
 
+    struct FanOutResult
+    {
+        std::string m_Resource;
+        bool m_Success = false;
+
+        // 0 if the image never reached CreateAssemblyInternal
+        uint64_t m_Execution = 0;
+        ExecutionOutcome m_Outcome = ExecutionOutcome::Failed;
+
+        // attach, copy and load in this runtime
+        double m_ElapsedMs = 0;
+    };
+
+    struct RuntimeSnapshot
+    {
+        std::string m_Resource;
+        std::string m_Domain;
+
+        // -1 if AppDomain.GetAssemblies failed
+        int64_t m_Assemblies = -1;
+    };
+
+    /**
+     * @brief Difference between the runtime set a client has seen and the current one.
+     * If m_Full is set the client's generation was unknown (or too old, or from another epoch) and m_Added holds every runtime.
+     * If nothing is set the client is up to date.
+     */
+    struct RuntimeChanges
+    {
+        uint64_t m_Epoch = 0;
+        uint64_t m_Generation = 0;
+        bool m_Full = false;
+
+        std::vector<std::string> m_Added;
+        std::vector<std::string> m_Removed;
+
+        bool IsModified() const { return m_Full || !m_Added.empty() || !m_Removed.empty(); }
+    };
+
     class Executor
     {
     private:
+        // guards the runtime list and generation history, never held while managed code runs
+        std::mutex m_Mutex;
+
         std::vector<RuntimeInfo> m_Runtimes;
 
+        // bumped every time the set of runtimes changes
+        uint64_t m_Generation = 1;
+
+        // random per instance, tells a client's generation from a previous injection apart from a current one
+        uint64_t m_Epoch = 0;
+
+        struct GenerationDelta
+        {
+            uint64_t m_Generation;
+            std::vector<std::string> m_Added;
+            std::vector<std::string> m_Removed;
+        };
+
+        // last few changes, enough to answer clients that are a couple of generations behind
+        std::deque<GenerationDelta> m_History;
+        static constexpr size_t MAX_HISTORY = 64;
+
+        struct RejectedDomain
+        {
+            int32_t m_Id;
+
+            // static strings, compared to log a domain again only when the reason changes
+            const char* m_Reason;
+            std::chrono::steady_clock::time_point m_Retry;
+        };
+
+        // domains that were probed and aren't runtimes (yet), keyed by address but only valid for the same domain id
+        std::unordered_map<MonoDomain*, RejectedDomain> m_Rejected;
+        static constexpr std::chrono::seconds REPROBE_INTERVAL{ 5 };
+
+        // every load of an image gets an id, see CurrentExecutionId
+        std::atomic<uint64_t> m_NextExecution{ 1 };
+
     public:
         static Executor& GetInstance();
 
         /**
          * @brief Executes a C# script within the specified runtime environment.
          * @param scriptName The name of the script to be executed.
-         * @param scriptData The bytecode of the C# script.
+         * @param scriptData The bytecode of the C# script, optionally compressed.
          * @param pdbData Optional PDB data for debugging purposes.
          * @param runtime Optional runtime environment to use. If not provided, the first available runtime will be used.
          * @return true if the script was executed successfully, false otherwise.
          */
-        bool Execute(const std::string& scriptName, const std::vector<uint8_t> &scriptData, 
-            std::optional<std::reference_wrapper<std::vector<uint8_t>>> pdbData = std::nullopt, std::optional<std::reference_wrapper<const RuntimeInfo>> runtime = std::nullopt);
+        bool Execute(const std::string& scriptName, const Payload& scriptData,
+            std::optional<Payload> pdbData = std::nullopt, std::optional<std::reference_wrapper<const RuntimeInfo>> runtime = std::nullopt);
 
+        /**
+         * @brief Loads every assembly of a bundle into one runtime, referenced assemblies first.
+         * Entries whose assembly name is already loaded in the domain are skipped, loading stops at the first failure.
+         * Hashes, images and the reference graph are all checked before anything is loaded.
+         */
+        BundleResult ExecuteBundle(std::span<const BundleEntry> entries,
+            std::optional<std::reference_wrapper<const RuntimeInfo>> runtime = std::nullopt);
+
+        /**
+         * @brief Loads one image into every target runtime concurrently, each posted to the scheduler through the target's domain queue.
+         * The payload is decoded and validated once, targets only copy the bytes into their own managed array.
+         * Blocks until every target is done, so it must not be called from a scheduler worker.
+         * @param clientId Scheduler client the loads are queued for.
+         * @param error Set to the reason when nothing was loaded.
+         * @return One result per target, in target order. Empty if the image or the pdb is invalid.
+         */
+        std::vector<FanOutResult> ExecuteFanOut(const std::string& scriptName, const Payload& scriptData,
+            const std::optional<Payload>& pdbData, std::span<const RuntimeInfo> targets, uint64_t clientId = 0, const char** error = nullptr);
+
+        /**
+         * @brief Id of the execution whose assembly is being loaded on this thread, 0 outside of a load.
+         */
+        static uint64_t CurrentExecutionId();
+
+        /**
+         * @brief Id of the last execution started on this thread, to look up its results once Execute returned.
+         */
+        static uint64_t LastExecutionId();
+
+        /**
+         * @brief How the last execution started on this thread ended, tells a timeout apart from a script that threw.
+         */
+        static ExecutionOutcome LastOutcome();
+
+        /**
+         * @brief Refreshes and returns a snapshot of all valid runtimes.
+         */
+        std::vector<RuntimeInfo> GetRuntimes();
+
+        /**
+         * @brief Refreshes the runtime list once and visits every runtime with a single attach to its domain.
+         */
+        std::vector<RuntimeSnapshot> Snapshot();
+
+        /**
+         * @brief Assemblies loaded in the domain, from AppDomain.GetAssemblies. Requires a MonoScope for the domain.
+         * @return nullopt if the call threw.
+         */
+        static std::optional<std::vector<MonoAssembly*>> LoadedAssemblies(MonoDomain* domain);
+
+        /**
+         * @brief Refreshes the runtime list and returns what changed since the given generation.
+         * Generations restart with every injection, so they are only compared within the same epoch.
+         * @param epoch The epoch the caller's generation belongs to, 0 if none.
+         * @param generation The last generation seen by the caller, 0 if none.
+         */
+        RuntimeChanges GetChangesSince(uint64_t epoch, uint64_t generation);
 
-        const std::vector<RuntimeInfo>& GetRuntimes();
     private:
+        Executor();
+
         /**
          * @brief Finds and initializes all available Mono runtimes in the current process.
-         * This method populates the m_Runtimes vector with information about each detected runtime.
+         * Only domains that weren't seen before are probed, ones without a runtime again after REPROBE_INTERVAL,
+         * runtimes of unloaded domains are dropped. Bumps m_Generation if the set changed.
+         * Requires m_Mutex.
          */
         void FindRuntimes();
+
+        /**
+         * @param error Receives why the domain has no usable runtime.
+         */
+        std::optional<RuntimeInfo> ProbeRuntime(MonoDomain* domain, const char** error);
+
+        std::optional<RuntimeInfo> SelectRuntime(std::optional<std::reference_wrapper<const RuntimeInfo>> runtime);
+
+        /**
+         * @brief Hands one image to CreateAssemblyInternal. Requires a MonoScope for the runtime's domain.
+         * @param validated Whether the image was already checked, otherwise it is checked once decoded.
+         */
+        bool Load(const RuntimeInfo& info, const std::string& resourceName, const std::string& scriptName,
+            const Payload& scriptData, bool validated, const std::optional<Payload>& pdbData);
     };
 }
\ No newline at end of file
@@ -0,0 +1,120 @@
+#pragma once
+#include <cse/mono.hpp>
+#include <cstdint>
+#include <cstring>
+#include <optional>
+#include <span>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace cse
+{
+    // what a field is read as, and the C++ type its values are written to
+    enum class FieldType : uint8_t
+    {
+        Bool,       // bool
+        Char,       // char16_t
+        Int8,       // int8_t
+        UInt8,      // uint8_t
+        Int16,      // int16_t
+        UInt16,     // uint16_t
+        Int32,      // int32_t
+        UInt32,     // uint32_t
+        Int64,      // int64_t
+        UInt64,     // uint64_t
+        Single,     // float
+        Double,     // double
+        IntPtr,     // intptr_t
+        String,     // std::string, UTF-8, empty for null
+        Object,     // uint32_t, a new gchandle the caller frees, 0 for null
+    };
+
+    const char* FieldTypeName(FieldType type);
+
+    struct FieldSpec
+    {
+        std::string_view m_Name;
+        FieldType m_Type;
+    };
+
+    /**
+     * @brief Instance field offsets of a class, resolved once and read straight from object memory.
+     *
+     * Offsets are cached per domain, class and field name, so resolving the same layout again is a map lookup.
+     * Reads go through one object at a time: a handle is resolved to its object right before its fields are copied and
+     * the object pointer never leaves the stack, where the GC's conservative scan pins it for the duration of the read.
+     * The calling thread has to be attached to the objects' domain.
+     */
+    class FieldLayout
+    {
+    private:
+        MonoClass* m_Class = nullptr;
+        std::vector<uint32_t> m_Offsets;
+        std::vector<FieldType> m_Types;
+
+    public:
+        /**
+         * @brief Resolves fields of klass, each has to be an instance field whose declared type matches its FieldType.
+         * @return nullopt if a field is missing, static or of another type.
+         */
+        static std::optional<FieldLayout> Resolve(MonoClass* klass, std::span<const FieldSpec> fields);
+
+        /**
+         * @brief Drops the cached offsets of classes resolved in a domain, once it is unloaded its class pointers get reused.
+         */
+        static void Forget(int32_t domainId);
+
+        MonoClass* GetClass() const { return m_Class; }
+        size_t GetFieldCount() const { return m_Offsets.size(); }
+
+        /**
+         * @brief Reads every field of the objects behind handles into an array of structs.
+         * Field i of object r is written to rows + r * rowSize + memberOffsets[i], usually offsetof of the matching member.
+         * Rows of null handles and of objects that aren't instances of the class are zeroed.
+         * @return Number of objects read.
+         */
+        size_t ReadRows(std::span<const uint32_t> handles, void* rows, size_t rowSize, std::span<const size_t> memberOffsets) const;
+
+        /**
+         * @brief Reads every field of the objects behind handles into one column per field.
+         * columns[i] points at handles.size() values of field i's C++ type.
+         * @return Number of objects read.
+         */
+        size_t ReadColumns(std::span<const uint32_t> handles, std::span<void* const> columns) const;
+
+        /**
+         * @brief Reads every field of one object into a struct, the object has to be pinned or referenced from the stack.
+         * @return false if obj is null or not an instance of the class.
+         */
+        bool ReadRow(MonoObject* obj, void* row, std::span<const size_t> memberOffsets) const;
+
+        /**
+         * @brief Reads one primitive field of an object the caller keeps alive.
+         */
+        template<typename T>
+        T Read(MonoObject* obj, size_t field) const
+        {
+            T value;
+            std::memcpy(&value, static_cast<const uint8_t*>(obj) + m_Offsets[field], sizeof(T));
+            return value;
+        }
+
+        /**
+         * @brief Reads one string field of an object the caller keeps alive.
+         * @return nullopt if the field holds null, or wasn't resolved as FieldType::String.
+         */
+        std::optional<std::string> ReadString(MonoObject* obj, size_t field) const;
+
+    private:
+        struct Target
+        {
+            uint8_t* m_Base;
+            size_t m_Stride;
+        };
+
+        size_t ReadHandles(std::span<const uint32_t> handles, std::span<const Target> targets) const;
+        bool ReadObject(MonoObject* obj, std::span<const Target> targets, size_t row) const;
+        void ClearRow(std::span<const Target> targets, size_t row) const;
+    };
+}
\ No newline at end of file
@@ -20,6 +20,19 @@ namespace cse
     // For handling MonoScriptRuntime objects from CreateObjectInstance
     void HandleMSR(MonoObject* msr);
 
+    /**
+     * Find the InternalManager (GlobalManager) object of a single domain.
+     * @param error Receives why there is none instead of it being printed.
+     * @return The manager object, or nullptr if the domain doesn't host a CitizenFX runtime (yet).
+     */
+    MonoObject* FindInternalManager(MonoDomain* domain, const char** error = nullptr);
+
+    /**
+     * Enumerate all live domains without attaching to any of them.
+     * Cheap enough to call on every refresh to detect domain creation/unload.
+     */
+    std::vector<MonoDomain*> EnumerateDomains();
+
     /**
      * Find all internal MonoScriptRuntime managers and their domains.
      * @return A vector of pairs, each containing a MonoScriptRuntime object and its associated MonoDomain.
@@ -0,0 +1,10 @@
+#pragma once
+#include <cse/commands.hpp>
+
+namespace cse
+{
+    /**
+     * @brief Registers every IPC command the executor answers, together with its scheduling policy.
+     */
+    void RegisterCommands(CommandRegistry& registry);
+}
\ No newline at end of file
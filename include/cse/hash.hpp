@@ -0,0 +1,50 @@
+#pragma once
+#include <array>
+#include <cstdint>
+#include <cstring>
+#include <span>
+#include <string>
+#include <string_view>
+#include <optional>
+
+namespace cse
+{
+    using Hash256 = std::array<uint8_t, 32>;
+
+    // for unordered containers, the digest is already uniformly distributed
+    struct Hash256Hasher
+    {
+        size_t operator()(const Hash256& hash) const
+        {
+            size_t value;
+            std::memcpy(&value, hash.data(), sizeof(value));
+            return value;
+        }
+    };
+
+    /**
+     * @brief Incremental SHA-256, used to identify payloads by content.
+     */
+    class Sha256
+    {
+    private:
+        uint32_t m_State[8];
+        uint8_t m_Buffer[64];
+        size_t m_BufferSize = 0;
+        uint64_t m_Length = 0;
+
+    public:
+        Sha256();
+
+        void Update(std::span<const uint8_t> data);
+        Hash256 Finish();
+
+        static Hash256 Of(std::span<const uint8_t> data);
+
+    private:
+        void Transform(const uint8_t* block);
+    };
+
+    std::string ToHex(const Hash256& hash);
+    std::optional<Hash256> HashFromHex(std::string_view hex);
+}
\ No newline at end of file
@@ -0,0 +1,70 @@
+#pragma once
+#include <cse/mono.hpp>
+#include <cstdint>
+#include <map>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace cse
+{
+    enum class EnumerationKind
+    {
+        Assemblies,
+        Types,
+        Methods,
+    };
+
+    std::optional<EnumerationKind> EnumerationKindFromName(std::string_view name);
+
+    // where the next page starts, indices into the domain's assemblies (load order) and their TypeDef/MethodDef rows
+    struct EnumerationCursor
+    {
+        uint32_t m_Assembly = 0;
+        uint32_t m_Type = 0;
+        uint32_t m_Method = 0;
+    };
+
+    struct EnumeratedItem
+    {
+        uint32_t m_Assembly = 0;
+
+        // assemblies: the image name, otherwise the type
+        std::string m_Namespace;
+        std::string m_Name;
+
+        // methods only
+        std::string m_Method;
+
+        uint32_t m_Token = 0;
+        uint32_t m_Flags = 0;
+
+        // types of an assembly, methods of a type
+        uint32_t m_Count = 0;
+    };
+
+    struct EnumerationPage
+    {
+        std::vector<EnumeratedItem> m_Items;
+
+        // names of the assemblies the items refer to, by index
+        std::map<uint32_t, std::string> m_Assemblies;
+
+        // nullopt once everything was visited
+        std::optional<EnumerationCursor> m_Next;
+
+        // metadata rows looked at, matching or not
+        size_t m_Scanned = 0;
+    };
+
+    /**
+     * @brief Reads one page of a domain's assemblies, types or methods starting at cursor.
+     * Rows are decoded straight from the images' metadata tables, no classes are loaded and nothing beyond the page is kept.
+     * A page ends after limit items or once limit * 64 rows were scanned, so sparse prefix filters still answer quickly.
+     * @param prefix Namespace prefix types and methods have to match, empty for all.
+     * @return nullopt if the domain's assemblies can't be listed.
+     */
+    std::optional<EnumerationPage> EnumerateDomain(MonoDomain* domain, EnumerationKind kind, std::string_view prefix,
+        EnumerationCursor cursor, size_t limit);
+}
\ No newline at end of file
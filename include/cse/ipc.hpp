@@ -2,6 +2,7 @@
 #include <functional>
 #include <thread>
 #include <atomic>
+#include <chrono>
 #include <memory>
 #include <nlohmann/json.hpp>
 
@@ -9,8 +10,30 @@ namespace cse
 {
     inline auto IPC_PIPE_NAME = L"\\\\.\\pipe\\my_ipc_pipe";
 
-    // request -> response
-    using IpcCallback = std::function<nlohmann::json(const nlohmann::json&)>;
+    /**
+     * Frame layout: uint32 header followed by the body.
+     * The low 30 bits of the header are the body length, the top bits are flags.
+     * Replies use the same encoding as the request they answer.
+     */
+    constexpr uint32_t IPC_FRAME_LENGTH_MASK = 0x3FFFFFFF;
+
+    // body is a uint32 uncompressed length followed by an LZ4 block
+    constexpr uint32_t IPC_FRAME_LZ4 = 0x80000000;
+
+    // body is MessagePack instead of JSON text, lets binary fields (assemblies) travel without base64
+    constexpr uint32_t IPC_FRAME_MSGPACK = 0x40000000;
+
+    // replies smaller than this are never compressed
+    constexpr size_t IPC_COMPRESS_THRESHOLD = 1024;
+
+    // how long Shutdown waits for client threads still answering a command
+    constexpr std::chrono::milliseconds IPC_SHUTDOWN_GRACE{ 5000 };
+
+    // request, client id -> response
+    using IpcCallback = std::function<nlohmann::json(const nlohmann::json&, uint64_t)>;
+
+    // client disconnected
+    using IpcDisconnectCallback = std::function<void(uint64_t)>;
 
     class IpcManager
     {
@@ -23,6 +46,7 @@ namespace cse
 
     public:
         void Initialize(IpcCallback callback, const wchar_t* pipeName = IPC_PIPE_NAME);
+        void OnDisconnect(IpcDisconnectCallback callback);
         void Shutdown();
     };
 }
\ No newline at end of file
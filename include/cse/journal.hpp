@@ -0,0 +1,137 @@
+#pragma once
+#include <cse/hash.hpp>
+#include <cse/watchdog.hpp>
+#include <cstdint>
+#include <filesystem>
+#include <limits>
+#include <memory>
+#include <optional>
+#include <string>
+#include <vector>
+
+namespace cse
+{
+    struct JournalEntry
+    {
+        // position in the journal, assigned on append
+        uint64_t m_Index = 0;
+
+        // unix microseconds when the load started
+        uint64_t m_Timestamp = 0;
+
+        // 0 if the load was rejected before an id was assigned
+        uint64_t m_Execution = 0;
+
+        // SHA-256 of the decoded image, zero if it never got decoded
+        Hash256 m_Hash{};
+
+        // truncated to 23 and 15 bytes when stored, queries by resource match the full name's id and the stored prefix
+        std::string m_Resource;
+        std::string m_Script;
+
+        ExecutionOutcome m_Outcome = ExecutionOutcome::Failed;
+
+        // failed before the script's constructor ran (decode, validation)
+        bool m_Rejected = false;
+        bool m_HasPdb = false;
+
+        uint32_t m_ImageSize = 0;
+
+        // copying the image into the domain, the constructor run, and the whole load
+        double m_MarshalMs = 0;
+        double m_RunMs = 0;
+        double m_TotalMs = 0;
+
+        // used heap after the constructor minus before it
+        int64_t m_HeapDelta = 0;
+    };
+
+    struct JournalQuery
+    {
+        // unix microseconds, inclusive
+        uint64_t m_From = 0;
+        uint64_t m_To = std::numeric_limits<uint64_t>::max();
+
+        std::optional<std::string> m_Resource;
+        std::optional<ExecutionOutcome> m_Outcome;
+
+        // index to continue from, 0 starts at the oldest (or newest) record
+        uint64_t m_Cursor = 0;
+        size_t m_Limit = 100;
+        bool m_NewestFirst = false;
+    };
+
+    struct JournalPage
+    {
+        std::vector<JournalEntry> m_Entries;
+
+        // pass back to continue, meaningless once done
+        uint64_t m_Cursor = 0;
+        bool m_Done = false;
+
+        // records read, segments whose summary ruled the query out aren't counted
+        uint64_t m_Scanned = 0;
+    };
+
+    struct JournalStats
+    {
+        std::filesystem::path m_Directory;
+        bool m_Enabled = false;
+        size_t m_Segments = 0;
+        size_t m_MaxSegments = 0;
+
+        // index of the next record, also the number of records ever appended
+        uint64_t m_Next = 0;
+        uint64_t m_Oldest = 0;
+        uint64_t m_Bytes = 0;
+        uint64_t m_Dropped = 0;
+    };
+
+    /**
+     * @brief Append-only journal with one fixed-size binary record per execution.
+     *
+     * Records live in memory-mapped segment files of SEGMENT_RECORDS each under <directory>/journal-<first index>.bin.
+     * Appending reserves an index with one atomic increment, writes the record in place and commits it by storing
+     * its sequence last, so concurrent loads never wait on each other. Each segment header summarizes its records
+     * (time range, resource and outcome bits), queries skip segments it rules out and only touch the pages they read.
+     * The oldest segments are deleted once there are more than the configured maximum.
+     */
+    class ExecutionJournal
+    {
+    private:
+        struct Impl;
+        std::unique_ptr<Impl> m_Impl;
+
+    public:
+        static constexpr uint64_t SEGMENT_RECORDS = 1 << 16;
+
+        // records a query reads before it returns a cursor to continue from
+        static constexpr uint64_t MAX_SCAN = 1 << 20;
+
+        static ExecutionJournal& GetInstance();
+
+        /**
+         * @brief Opens (or creates) the journal in a directory, the default is %TEMP%\cse_journal.
+         * Called lazily with the default on first use.
+         */
+        bool Open(const std::filesystem::path& directory);
+
+        void SetEnabled(bool enabled);
+        void SetMaxSegments(size_t segments);
+
+        /**
+         * @brief Appends entry with the next index, dropped if the journal is disabled or can't be opened.
+         */
+        void Append(const JournalEntry& entry);
+
+        JournalPage Query(const JournalQuery& query);
+
+        JournalStats GetStats();
+
+        void Flush();
+
+    private:
+        ExecutionJournal();
+        ~ExecutionJournal();
+    };
+}
\ No newline at end of file
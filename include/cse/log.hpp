@@ -0,0 +1,185 @@
+#pragma once
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <string_view>
+#include <functional>
+#include <type_traits>
+#include <tuple>
+
+/**
+ * Lowest level compiled in, calls below it are discarded at compile time.
+ * 0 = trace, 1 = debug, 2 = info, 3 = warn, 4 = error
+ */
+#ifndef CSE_LOG_MIN_LEVEL
+#ifdef NDEBUG
+#define CSE_LOG_MIN_LEVEL 2
+#else
+#define CSE_LOG_MIN_LEVEL 0
+#endif
+#endif
+
+namespace cse
+{
+    enum class LogLevel : uint8_t
+    {
+        Trace = 0,
+        Debug,
+        Info,
+        Warn,
+        Error,
+    };
+
+    const char* LogLevelName(LogLevel level);
+
+    namespace logging
+    {
+        /**
+         * Call sites only copy the format pointer and raw argument bytes into a per-thread ring,
+         * the logger thread formats them later. Strings are copied since their storage may be gone by then.
+         */
+
+        template <typename T>
+        struct Arg
+        {
+            static_assert(std::is_trivially_copyable_v<T>, "log arguments must be scalars or strings");
+
+            static size_t Size(const T&) { return sizeof(T); }
+
+            static void Encode(uint8_t*& out, const T& value)
+            {
+                std::memcpy(out, &value, sizeof(T));
+                out += sizeof(T);
+            }
+
+            static T Decode(const uint8_t*& in)
+            {
+                T value;
+                std::memcpy(&value, in, sizeof(T));
+                in += sizeof(T);
+                return value;
+            }
+        };
+
+        struct StringArg
+        {
+            static size_t Size(std::string_view value) { return sizeof(uint32_t) + value.size() + 1; }
+
+            static void Encode(uint8_t*& out, std::string_view value)
+            {
+                uint32_t length = static_cast<uint32_t>(value.size());
+                std::memcpy(out, &length, sizeof(length));
+                out += sizeof(length);
+                std::memcpy(out, value.data(), length);
+                out += length;
+                *out++ = 0;
+            }
+
+            // decoded as a C string for printf's %s
+            static const char* Decode(const uint8_t*& in)
+            {
+                uint32_t length;
+                std::memcpy(&length, in, sizeof(length));
+                in += sizeof(length);
+                const char* value = reinterpret_cast<const char*>(in);
+                in += length + 1;
+                return value;
+            }
+        };
+
+        template <> struct Arg<const char*> : StringArg
+        {
+            static size_t Size(const char* value) { return StringArg::Size(value ? value : "(null)"); }
+            static void Encode(uint8_t*& out, const char* value) { StringArg::Encode(out, value ? value : "(null)"); }
+        };
+
+        template <> struct Arg<char*> : Arg<const char*> {};
+        template <> struct Arg<std::string> : StringArg {};
+        template <> struct Arg<std::string_view> : StringArg {};
+
+        using Formatter = void (*)(const char* fmt, const uint8_t* payload, std::string& out);
+
+        void FormatPrintf(std::string& out, const char* fmt, ...);
+
+        template <typename... Args>
+        void Format(const char* fmt, const uint8_t* payload, std::string& out)
+        {
+            const uint8_t* in = payload;
+
+            // braced init guarantees left to right decoding
+            std::tuple<decltype(Arg<Args>::Decode(in))...> values{ Arg<Args>::Decode(in)... };
+            std::apply([&](auto... decoded) { FormatPrintf(out, fmt, decoded...); }, values);
+        }
+
+        /**
+         * @brief Reserves space for a record in the calling thread's ring.
+         * @return Pointer to payloadSize writable bytes, or nullptr if the ring is full (the record is dropped).
+         */
+        uint8_t* Reserve(LogLevel level, const char* fmt, Formatter formatter, size_t payloadSize);
+        void Commit();
+
+        bool IsEnabled(LogLevel level);
+
+        template <LogLevel Level, typename... Args>
+        inline void Write(const char* fmt, const Args&... args)
+        {
+            if constexpr (static_cast<int>(Level) < CSE_LOG_MIN_LEVEL)
+            {
+                return;
+            }
+            else
+            {
+                if (!IsEnabled(Level))
+                    return;
+
+                size_t size = (size_t(0) + ... + Arg<std::decay_t<Args>>::Size(args));
+
+                uint8_t* out = Reserve(Level, fmt, &Format<std::decay_t<Args>...>, size);
+                if (!out)
+                    return;
+
+                (Arg<std::decay_t<Args>>::Encode(out, args), ...);
+                Commit();
+            }
+        }
+    }
+
+    /**
+     * Deferred printf-style logging. fmt must be a string literal (only its pointer is stored),
+     * std::string arguments are accepted for %s.
+     */
+    template <typename... Args> inline void log_trace(const char* fmt, const Args&... args) { logging::Write<LogLevel::Trace>(fmt, args...); }
+    template <typename... Args> inline void log_debug(const char* fmt, const Args&... args) { logging::Write<LogLevel::Debug>(fmt, args...); }
+    template <typename... Args> inline void log_info(const char* fmt, const Args&... args) { logging::Write<LogLevel::Info>(fmt, args...); }
+    template <typename... Args> inline void log_warn(const char* fmt, const Args&... args) { logging::Write<LogLevel::Warn>(fmt, args...); }
+    template <typename... Args> inline void log_error(const char* fmt, const Args&... args) { logging::Write<LogLevel::Error>(fmt, args...); }
+
+    // enqueues an already formatted line, used by println
+    void log_text(LogLevel level, std::string_view text);
+
+    // runtime threshold on top of CSE_LOG_MIN_LEVEL
+    void set_log_level(LogLevel level);
+    LogLevel get_log_level();
+
+    void set_log_console(bool enabled);
+    bool set_log_file(const std::string& path);
+
+    // subscribers run on the logger thread and must not add or remove subscribers themselves
+    using LogSubscriber = std::function<void(LogLevel level, std::string_view line)>;
+    uint64_t add_log_subscriber(LogSubscriber subscriber);
+    void remove_log_subscriber(uint64_t id);
+
+    struct LogStats
+    {
+        uint64_t m_Written = 0;
+        uint64_t m_Dropped = 0;
+        size_t m_Rings = 0;
+    };
+
+    LogStats get_log_stats();
+
+    void start_logger();
+
+    // drains every ring and stops the logger thread
+    void stop_logger();
+}
\ No newline at end of file
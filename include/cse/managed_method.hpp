@@ -0,0 +1,239 @@
+#pragma once
+#include <cse/mono.hpp>
+#include <cstdint>
+#include <expected>
+#include <span>
+#include <string>
+#include <string_view>
+#include <tuple>
+#include <type_traits>
+
+namespace cse
+{
+    struct ManagedException
+    {
+        // full type name, e.g. "System.InvalidOperationException", empty if the call never reached managed code
+        std::string m_Type;
+
+        // Exception.ToString(), message and stack trace
+        std::string m_Message;
+    };
+
+    /**
+     * @brief Converts a thrown managed exception. Requires an attached thread.
+     */
+    ManagedException DescribeException(MonoObject* exception);
+
+    // "Namespace.Class", just "Class" in the global namespace
+    std::string ClassFullName(MonoClass* klass);
+
+    // "Namespace.Class::Method", the one spelling profiler reports and warm-up's hot_methods share
+    std::string MethodFullName(MonoMethod* method);
+
+    namespace marshal
+    {
+        // how a C++ argument or return type crosses into an unmanaged thunk, primitives and Mono pointers go as they are
+        template<typename T>
+        struct Traits
+        {
+            static_assert(std::is_arithmetic_v<T> || std::is_enum_v<T> || std::is_pointer_v<T>, "no marshaling defined for this type");
+
+            using Native = T;
+            static Native To(MonoDomain*, T value) { return value; }
+            static T From(Native value) { return value; }
+        };
+
+        // MonoBoolean
+        template<>
+        struct Traits<bool>
+        {
+            using Native = uint8_t;
+            static Native To(MonoDomain*, bool value) { return value ? 1 : 0; }
+            static bool From(Native value) { return value != 0; }
+        };
+
+        // System.String, arguments only
+        template<>
+        struct Traits<std::string_view>
+        {
+            using Native = MonoString*;
+            static Native To(MonoDomain* domain, std::string_view value);
+            static bool Converted(Native value) { return value != nullptr; }
+        };
+
+        // System.String, return values only
+        template<>
+        struct Traits<std::string>
+        {
+            using Native = MonoString*;
+            static std::string From(Native value);
+        };
+
+        // byte[], copied into a new managed array
+        template<>
+        struct Traits<std::span<const uint8_t>>
+        {
+            using Native = MonoArray*;
+            static Native To(MonoDomain* domain, std::span<const uint8_t> value);
+            static bool Converted(Native value) { return value != nullptr; }
+        };
+
+        // false if a conversion that allocates failed, values passed as they are can't fail
+        template<typename T>
+        bool Converted(typename Traits<T>::Native value)
+        {
+            if constexpr (requires { Traits<T>::Converted(value); })
+            {
+                return Traits<T>::Converted(value);
+            }
+            else
+            {
+                return true;
+            }
+        }
+
+        template<typename T>
+        struct Return
+        {
+            using Native = typename Traits<T>::Native;
+        };
+
+        template<>
+        struct Return<void>
+        {
+            using Native = void;
+        };
+    }
+
+    template<typename Signature>
+    class ManagedMethod;
+
+    /**
+     * @brief Managed method called through its unmanaged thunk (mono_method_get_unmanaged_thunk).
+     *
+     * The thunk is resolved once and called like a native function pointer, arguments are converted
+     * according to their C++ types at compile time instead of being boxed into a void* array as with runtime_invoke.
+     * Calls require a thread attached to the method's domain (see MonoScope).
+     */
+    template<typename R, typename... Args>
+    class ManagedMethod<R(Args...)>
+    {
+    private:
+        using NativeReturn = typename marshal::Return<R>::Native;
+        using StaticThunk = NativeReturn (*)(typename marshal::Traits<Args>::Native..., MonoObject** exc);
+        using InstanceThunk = NativeReturn (*)(MonoObject* self, typename marshal::Traits<Args>::Native..., MonoObject** exc);
+
+        MonoDomain* m_Domain = nullptr;
+        void* m_Thunk = nullptr;
+
+        // the thunks differ by the leading self, calling one as the other corrupts the arguments
+        bool m_Static = false;
+
+    public:
+        ManagedMethod() = default;
+
+        /**
+         * @brief Wraps a resolved method. Requires a thread attached to the domain, the thunk is compiled here.
+         */
+        ManagedMethod(MonoDomain* domain, MonoMethod* method)
+            : m_Domain(domain),
+              m_Thunk(method && MonoMethods::GetInstance().supports(MonoFeature::UnmanagedThunks) ? MonoMethods::GetInstance().method_get_unmanaged_thunk(method) : nullptr),
+              m_Static(method && (MonoMethods::GetInstance().method_get_flags(method, nullptr) & METHOD_ATTRIBUTE_STATIC))
+        {
+        }
+
+        /**
+         * @brief Looks the method up by name and parameter count.
+         */
+        static ManagedMethod Resolve(MonoDomain* domain, MonoClass* klass, const char* name)
+        {
+            static auto& methods = MonoMethods::GetInstance();
+            return ManagedMethod(domain, klass ? methods.class_get_method_from_name(klass, name, sizeof...(Args)) : nullptr);
+        }
+
+        bool IsValid() const { return m_Thunk != nullptr; }
+        bool IsStatic() const { return m_Static; }
+
+        /**
+         * @brief Calls a static method, fails without calling anything if the method is an instance method.
+         */
+        std::expected<R, ManagedException> operator()(Args... args) const
+        {
+            if (m_Thunk && !m_Static)
+            {
+                return std::unexpected(ManagedException{ {}, "instance method called without an instance" });
+            }
+
+            return Complete(args..., [&](MonoObject** exc, auto... native)
+            {
+                return reinterpret_cast<StaticThunk>(m_Thunk)(native..., exc);
+            });
+        }
+
+        /**
+         * @brief Calls an instance method on self, fails without calling anything if the method is static.
+         */
+        std::expected<R, ManagedException> Invoke(MonoObject* self, Args... args) const
+        {
+            if (m_Thunk && m_Static)
+            {
+                return std::unexpected(ManagedException{ {}, "static method called with an instance" });
+            }
+
+            return Complete(args..., [&](MonoObject** exc, auto... native)
+            {
+                return reinterpret_cast<InstanceThunk>(m_Thunk)(self, native..., exc);
+            });
+        }
+
+    private:
+        template<typename Call>
+        std::expected<R, ManagedException> Complete(Args... args, Call&& thunk) const
+        {
+            if (!m_Thunk)
+            {
+                if (!MonoMethods::GetInstance().supports(MonoFeature::UnmanagedThunks))
+                {
+                    return std::unexpected(ManagedException{ {}, "unsupported: this Mono build has no mono_method_get_unmanaged_thunk" });
+                }
+
+                return std::unexpected(ManagedException{ {}, "method not resolved" });
+            }
+
+            // converted up front, a failed allocation (string_new, array_new) is reported instead of passing null on
+            std::tuple<typename marshal::Traits<Args>::Native...> native{ marshal::Traits<Args>::To(m_Domain, args)... };
+            bool converted = std::apply([](const auto&... values) { return (marshal::Converted<Args>(values) && ...); }, native);
+            if (!converted)
+            {
+                return std::unexpected(ManagedException{ {}, "failed to marshal arguments" });
+            }
+
+            auto call = [&](MonoObject** exc)
+            {
+                return std::apply([&](auto... values) { return thunk(exc, values...); }, native);
+            };
+
+            MonoObject* exc = nullptr;
+            if constexpr (std::is_void_v<R>)
+            {
+                call(&exc);
+                if (exc)
+                {
+                    return std::unexpected(DescribeException(exc));
+                }
+
+                return {};
+            }
+            else
+            {
+                NativeReturn value = call(&exc);
+                if (exc)
+                {
+                    return std::unexpected(DescribeException(exc));
+                }
+
+                return marshal::Traits<R>::From(value);
+            }
+        }
+    };
+}
\ No newline at end of file
@@ -0,0 +1,49 @@
+#pragma once
+#include <cstdint>
+#include <filesystem>
+#include <memory>
+#include <span>
+
+namespace cse
+{
+    /**
+     * @brief File mapped into memory, unmapped and closed on destruction.
+     */
+    class MappedFile
+    {
+    private:
+        void* m_File = nullptr;
+        void* m_Mapping = nullptr;
+        uint8_t* m_View = nullptr;
+        size_t m_Size = 0;
+
+    public:
+        /**
+         * @brief Maps an existing file read-only, other handles may keep writing to it.
+         * An empty file gives an empty mapping.
+         * @return nullptr if the file can't be opened or mapped.
+         */
+        static std::unique_ptr<MappedFile> OpenRead(const std::filesystem::path& path);
+
+        /**
+         * @brief Maps a file read-write, creating it or growing it to at least size bytes.
+         * With size 0 an empty file gives an empty mapping.
+         */
+        static std::unique_ptr<MappedFile> OpenWrite(const std::filesystem::path& path, size_t size);
+
+        MappedFile(const MappedFile&) = delete;
+        MappedFile& operator=(const MappedFile&) = delete;
+        ~MappedFile();
+
+        std::span<uint8_t> GetData() const { return { m_View, m_Size }; }
+        size_t GetSize() const { return m_Size; }
+
+        // writes dirty pages back, the OS does it eventually anyway
+        void Flush(size_t offset = 0, size_t length = 0);
+
+    private:
+        MappedFile() = default;
+
+        static std::unique_ptr<MappedFile> Open(const std::filesystem::path& path, bool write, size_t size);
+    };
+}
\ No newline at end of file
@@ -0,0 +1,74 @@
+#pragma once
+#include <cstdint>
+#include <optional>
+#include <span>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace cse
+{
+    struct AssemblyVersion
+    {
+        uint16_t m_Major = 0;
+        uint16_t m_Minor = 0;
+        uint16_t m_Build = 0;
+        uint16_t m_Revision = 0;
+
+        std::string ToString() const;
+    };
+
+    struct AssemblyReference
+    {
+        std::string_view m_Name;
+        AssemblyVersion m_Version;
+        std::string_view m_Culture;
+        std::span<const uint8_t> m_PublicKeyOrToken;
+    };
+
+    struct TypeDefinition
+    {
+        std::string_view m_Namespace;
+        std::string_view m_Name;
+        uint32_t m_Flags;
+    };
+
+    // COR20 header flags
+    constexpr uint32_t CLI_FLAG_ILONLY = 0x00000001;
+    constexpr uint32_t CLI_FLAG_32BIT_REQUIRED = 0x00000002;
+    constexpr uint32_t CLI_FLAG_32BIT_PREFERRED = 0x00020000;
+
+    /**
+     * @brief What the CLI metadata of an image says about it.
+     * Strings and blobs point into the parsed image, which has to outlive this.
+     */
+    struct AssemblyMetadata
+    {
+        uint16_t m_Machine = 0;
+        bool m_Pe32Plus = false;
+        uint32_t m_CliFlags = 0;
+        uint32_t m_EntryPointToken = 0;
+        std::string_view m_RuntimeVersion;
+
+        std::string_view m_Name;
+        AssemblyVersion m_Version;
+        std::string_view m_Culture;
+        std::span<const uint8_t> m_PublicKey;
+
+        std::vector<AssemblyReference> m_References;
+
+        // the <Module> pseudo type is left out
+        std::vector<TypeDefinition> m_Types;
+    };
+
+    /**
+     * @brief Parses the PE/CLI headers and the Assembly, AssemblyRef and TypeDef tables (ECMA-335 II.24, II.25) without copying.
+     * @param error Receives a static description when nullopt is returned.
+     */
+    std::optional<AssemblyMetadata> ReadAssemblyMetadata(std::span<const uint8_t> image, const char** error = nullptr);
+
+    /**
+     * @brief Whether a parsed image can be loaded from bytes by the game's 64-bit Mono: IL only and not x86 only.
+     */
+    bool IsLoadableAssembly(const AssemblyMetadata& metadata, const char** error = nullptr);
+}
\ No newline at end of file
@@ -1,5 +1,6 @@
 #pragma once
 #include <memory>
+#include <cstdint>
 #include <cse/console.hpp>
 
 namespace cse
@@ -14,6 +15,91 @@ namespace cse
     using MonoType = void;
     using MonoField = void;
     using MonoArray = void;
+    using MonoMethodSignature = void;
+    using MonoAssemblyName = void;
+    using MonoCounter = void;
+    using MonoThread = void;
+    using MonoTableInfo = void;
+    using MonoMethodDesc = void;
+    using MonoProfiler = void;
+    using MonoProfilerHandle = void;
+    using MonoProfilerCallContext = void;
+
+    // metadata table ids and method flags, from mono/metadata/blob.h and tabledefs.h
+    constexpr int MONO_TABLE_TYPEDEF = 2;
+    constexpr int MONO_TABLE_METHOD = 6;
+    constexpr uint32_t MONO_TOKEN_TYPE_DEF = 0x02000000;
+    constexpr uint32_t MONO_TOKEN_METHOD_DEF = 0x06000000;
+    constexpr uint32_t METHOD_ATTRIBUTE_STATIC = 0x0010;
+    constexpr uint32_t METHOD_ATTRIBUTE_ABSTRACT = 0x0400;
+    constexpr uint32_t METHOD_ATTRIBUTE_PINVOKE_IMPL = 0x2000;
+    constexpr uint32_t METHOD_IMPL_ATTRIBUTE_CODE_TYPE_MASK = 0x0003;
+    constexpr uint32_t METHOD_IMPL_ATTRIBUTE_RUNTIME = 0x0003;
+    constexpr uint32_t METHOD_IMPL_ATTRIBUTE_INTERNAL_CALL = 0x1000;
+
+    // TypeDef and MethodDef columns, from mono/metadata/row-indexes.h
+    constexpr int MONO_TYPEDEF_FLAGS = 0;
+    constexpr int MONO_TYPEDEF_NAME = 1;
+    constexpr int MONO_TYPEDEF_NAMESPACE = 2;
+    constexpr int MONO_TYPEDEF_METHOD_LIST = 5;
+    constexpr int MONO_TYPEDEF_SIZE = 6;
+    constexpr int MONO_METHOD_FLAGS = 2;
+    constexpr int MONO_METHOD_NAME = 3;
+    constexpr int MONO_METHOD_SIZE = 6;
+
+    // counter value types, from mono/utils/mono-counters.h
+    constexpr int MONO_COUNTER_INT = 0;
+    constexpr int MONO_COUNTER_UINT = 1;
+    constexpr int MONO_COUNTER_WORD = 2;
+    constexpr int MONO_COUNTER_LONG = 3;
+    constexpr int MONO_COUNTER_ULONG = 4;
+    constexpr int MONO_COUNTER_DOUBLE = 5;
+    constexpr int MONO_COUNTER_TIME_INTERVAL = 7;
+    constexpr int MONO_COUNTER_TYPE_MASK = 0xf;
+
+    // field element types and attributes, from mono/metadata/blob.h and tabledefs.h
+    constexpr int MONO_TYPE_BOOLEAN = 0x02;
+    constexpr int MONO_TYPE_CHAR = 0x03;
+    constexpr int MONO_TYPE_I1 = 0x04;
+    constexpr int MONO_TYPE_U1 = 0x05;
+    constexpr int MONO_TYPE_I2 = 0x06;
+    constexpr int MONO_TYPE_U2 = 0x07;
+    constexpr int MONO_TYPE_I4 = 0x08;
+    constexpr int MONO_TYPE_U4 = 0x09;
+    constexpr int MONO_TYPE_I8 = 0x0a;
+    constexpr int MONO_TYPE_U8 = 0x0b;
+    constexpr int MONO_TYPE_R4 = 0x0c;
+    constexpr int MONO_TYPE_R8 = 0x0d;
+    constexpr int MONO_TYPE_STRING = 0x0e;
+    constexpr int MONO_TYPE_I = 0x18;
+    constexpr int MONO_TYPE_U = 0x19;
+    constexpr uint32_t FIELD_ATTRIBUTE_STATIC = 0x0010;
+
+    // MonoProfilerCallInstrumentationFlags, from mono/metadata/profiler.h
+    constexpr int MONO_PROFILER_CALL_INSTRUMENTATION_NONE = 0;
+    constexpr int MONO_PROFILER_CALL_INSTRUMENTATION_ENTER = 1 << 1;
+    constexpr int MONO_PROFILER_CALL_INSTRUMENTATION_LEAVE = 1 << 3;
+    constexpr int MONO_PROFILER_CALL_INSTRUMENTATION_TAIL_CALL = 1 << 5;
+    constexpr int MONO_PROFILER_CALL_INSTRUMENTATION_EXCEPTION_LEAVE = 1 << 6;
+
+    // exports some Mono builds don't have, only the features using them require them
+    enum class MonoFeature
+    {
+        // mono_profiler_*, the method profiler
+        Profiler,
+
+        // mono_counters_*, JIT figures of the usage tracker
+        Counters,
+
+        // mono_thread_stop, aborting scripts past their deadline
+        ThreadAbort,
+
+        // mono_method_get_unmanaged_thunk, ManagedMethod calls
+        UnmanagedThunks,
+
+        // mono_signature_is_generic, JIT warm-up
+        GenericSignatures,
+    };
 
     class MonoMethods
     {
@@ -24,17 +110,29 @@ namespace cse
     public:
         static MonoMethods& GetInstance();
 
+        /**
+         * @brief Whether every export the feature needs was found. The wrappers of missing ones must not be called.
+         */
+        bool supports(MonoFeature feature) const;
+
     public:
     // strings
         MonoString* string_new(MonoDomain* domain, const char* str);
+        MonoString* string_new_len(MonoDomain* domain, const char* text, uint32_t length);
         char* string_to_utf8(MonoString* str);
+        uint16_t* string_chars(MonoString* str);
+        int string_length(MonoString* str);
 
     // memory
         void free(void* ptr);
+        uint32_t gchandle_new(MonoObject* obj, int pinned);
+        void gchandle_free(uint32_t gchandle);
+        MonoObject* gchandle_get_target(uint32_t gchandle);
 
     // arrays
         MonoArray* array_new(MonoDomain* domain, MonoClass* eclass, uintptr_t n);
         void* array_addr_with_size(void* array, int size, uintptr_t idx);
+        uintptr_t array_length(MonoArray* array);
 
 
     // domain and threading
@@ -45,20 +143,33 @@ namespace cse
 
         MonoDomain* domain_get();
         void domain_set(MonoDomain* domain);
+        MonoThread* thread_current();
+        void thread_stop(MonoThread* thread);
 
     // method invocation
         MonoObject* runtime_invoke(MonoMethod* method, MonoObject* obj, void** params, MonoObject** exc);
+        void* method_get_unmanaged_thunk(MonoMethod* method);
+        void add_internal_call(const char* name, const void* method);
 
     // object and class inspection
         MonoClass* object_get_class(MonoObject* obj);
+        MonoObject* object_new(MonoDomain* domain, MonoClass* klass);
+        uint32_t object_get_size(MonoObject* obj);
+        MonoObject* object_isinst(MonoObject* obj, MonoClass* klass);
         const char* class_get_name(MonoClass* klass);
         const char* class_get_namespace(MonoClass* klass);
+        MonoClass* class_get_nesting_type(MonoClass* klass);
+        MonoImage* class_get_image(MonoClass* klass);
         MonoMethod* class_get_method_from_name(MonoClass* klass, const char* name, int param_count);
+        MonoMethodDesc* method_desc_new(const char* name, int include_namespace);
+        MonoMethod* method_desc_search_in_class(MonoMethodDesc* desc, MonoClass* klass);
+        void method_desc_free(MonoMethodDesc* desc);
         MonoClass* class_from_name(MonoImage* image, const char* name_space, const char* name);
         MonoField* class_get_field_from_name(MonoClass* klass, const char* name);
         void* class_vtable(MonoDomain* domain, MonoClass* klass);
 
         MonoClass* get_byte_class();
+        MonoImage* get_corlib();
         MonoString* object_to_string(MonoObject* obj, MonoObject** exc);
 
         void print_exception(MonoObject* exc);
@@ -66,15 +177,59 @@ namespace cse
     // field access
         void field_static_get_value(void* vtable, MonoField* field, void** value);
         MonoObject* field_get_value_object(MonoDomain* domain, MonoField* field, MonoObject* obj);
+        uint32_t field_get_offset(MonoField* field);
+        uint32_t field_get_flags(MonoField* field);
+        MonoType* field_get_type(MonoField* field);
+        int type_get_type(MonoType* type);
+        bool type_is_reference(MonoType* type);
 
     // compilation
         void* compile_method(MonoMethod* method);
 
+    // gc and runtime counters
+        int64_t gc_get_used_size();
+        int64_t gc_get_heap_size();
+        int gc_collection_count(int generation);
+        int gc_max_generation();
+        void counters_foreach(int (*cb)(MonoCounter* counter, void* user_data), void* user_data);
+        int counters_sample(MonoCounter* counter, void* buffer, int buffer_size);
+        const char* counter_get_name(MonoCounter* counter);
+        int counter_get_type(MonoCounter* counter);
+
+    // metadata and methods
+        int image_get_table_rows(MonoImage* image, int table_id);
+        const MonoTableInfo* image_get_table_info(MonoImage* image, int table_id);
+        void metadata_decode_row(const MonoTableInfo* t, int idx, uint32_t* res, int res_size);
+        const char* metadata_string_heap(MonoImage* image, uint32_t index);
+        MonoMethod* get_method(MonoImage* image, uint32_t token, MonoClass* klass);
+        uint32_t method_get_flags(MonoMethod* method, uint32_t* iflags);
+        const char* method_get_name(MonoMethod* method);
+        MonoClass* method_get_class(MonoMethod* method);
+        MonoMethodSignature* method_signature(MonoMethod* method);
+        bool signature_is_generic(MonoMethodSignature* sig);
+
     // assembly and image
         MonoAssembly* domain_open_assembly(MonoDomain* domain, const char* name);
         MonoImage* assembly_get_image(MonoAssembly* assembly);
+        MonoAssembly* reflection_assembly_get_assembly(MonoObject* refassembly);
+        const char* image_get_name(MonoImage* image);
+        MonoAssemblyName* assembly_name_new(const char* name);
+        void assembly_name_free(MonoAssemblyName* aname);
+        MonoAssembly* assembly_loaded(MonoAssemblyName* aname);
 
         const char* domain_get_friendly_name(MonoDomain* domain);
+        int32_t domain_get_id(MonoDomain* domain);
+
+    // profiler
+        MonoProfilerHandle* profiler_create(MonoProfiler* prof);
+        void profiler_set_call_instrumentation_filter_callback(MonoProfilerHandle* handle, int (*cb)(MonoProfiler* prof, MonoMethod* method));
+        void profiler_set_method_enter_callback(MonoProfilerHandle* handle, void (*cb)(MonoProfiler* prof, MonoMethod* method, MonoProfilerCallContext* context));
+        void profiler_set_method_leave_callback(MonoProfilerHandle* handle, void (*cb)(MonoProfiler* prof, MonoMethod* method, MonoProfilerCallContext* context));
+        void profiler_set_method_tail_call_callback(MonoProfilerHandle* handle, void (*cb)(MonoProfiler* prof, MonoMethod* method, MonoMethod* target));
+        void profiler_set_method_exception_leave_callback(MonoProfilerHandle* handle, void (*cb)(MonoProfiler* prof, MonoMethod* method, MonoObject* exception));
+        void profiler_set_image_loaded_callback(MonoProfilerHandle* handle, void (*cb)(MonoProfiler* prof, MonoImage* image));
+        bool profiler_enable_allocations();
+        void profiler_set_gc_allocation_callback(MonoProfilerHandle* handle, void (*cb)(MonoProfiler* prof, MonoObject* obj));
 
     private:
         MonoMethods();
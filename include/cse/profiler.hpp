@@ -0,0 +1,90 @@
+#pragma once
+#include <cse/mono.hpp>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace cse
+{
+    struct ProfiledMethod
+    {
+        // Namespace.Class::Method
+        std::string m_Name;
+
+        uint64_t m_Calls = 0;
+
+        // recursive calls are only counted once
+        double m_InclusiveMs = 0.0;
+        double m_ExclusiveMs = 0.0;
+
+        // zero unless the runtime delivers allocation events
+        uint64_t m_Allocations = 0;
+        uint64_t m_AllocatedBytes = 0;
+    };
+
+    struct ProfileReport
+    {
+        bool m_Running = false;
+        bool m_Allocations = false;
+
+        // threads that called instrumented methods since the last reset
+        size_t m_Threads = 0;
+
+        // methods compiled with instrumentation
+        size_t m_Instrumented = 0;
+
+        // by exclusive time, longest first
+        std::vector<ProfiledMethod> m_Methods;
+
+        // "outer;inner;innermost <exclusive microseconds>", one line per distinct stack, for flamegraph.pl and speedscope
+        std::vector<std::string> m_Folded;
+    };
+
+    /**
+     * @brief Method level profiler for executed scripts, built on the Mono profiler API.
+     *
+     * Only methods of images loaded through the executor are compiled with enter/leave calls, the filter is consulted when
+     * a method is JIT compiled, so profiling has to be started before the code of interest first runs.
+     * Calls are aggregated per thread into call trees and method totals without leaving the calling thread.
+     * Stopping removes every callback including the filter, methods compiled while profiling keep a check of the runtime's
+     * own that finds none. Methods compiled while profiling is off, JitWarmup's precompiles among them, stay uninstrumented
+     * for the life of their domain, start profiling before the script loads (or turn warm-up off) to see them.
+     */
+    class ScriptProfiler
+    {
+    private:
+        struct Impl;
+        std::unique_ptr<Impl> m_Impl;
+
+    public:
+        // frames deeper than this are charged to the deepest tracked one
+        static constexpr size_t MAX_DEPTH = 128;
+
+        static ScriptProfiler& GetInstance();
+
+        /**
+         * @brief Installs the callbacks, the profiler is registered with the runtime on the first start.
+         * @param allocations Asks the runtime for allocation events, which it may refuse once started.
+         * @return false if the runtime has no profiler API (MonoFeature::Profiler).
+         */
+        bool Start(bool allocations);
+        void Stop();
+
+        /**
+         * @brief Drops everything collected so far, profiling continues if it was running.
+         */
+        void Reset();
+
+        /**
+         * @brief Marks an image as executor loaded, its methods compiled from now on are instrumented.
+         */
+        void TrackImage(MonoImage* image);
+
+        ProfileReport Report(size_t limit);
+
+    private:
+        ScriptProfiler();
+        ~ScriptProfiler();
+    };
+}
\ No newline at end of file
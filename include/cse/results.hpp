@@ -0,0 +1,91 @@
+#pragma once
+#include <cse/mono.hpp>
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <string>
+#include <vector>
+
+namespace cse
+{
+    struct ResultRecord
+    {
+        uint64_t m_Sequence;
+
+        // microseconds since the execution started
+        uint64_t m_Timestamp;
+
+        std::string m_Key;
+        std::vector<uint8_t> m_Payload;
+    };
+
+    struct ResultBatch
+    {
+        std::vector<ResultRecord> m_Records;
+
+        // pass back to continue after the last record
+        uint64_t m_Cursor = 0;
+
+        // bytes overwritten before this reader got to them
+        uint64_t m_Skipped = 0;
+    };
+
+    struct ResultChannelInfo
+    {
+        uint64_t m_Execution;
+        std::string m_Resource;
+        std::string m_Assembly;
+
+        uint64_t m_Emitted;
+        // records too large for the buffer
+        uint64_t m_Dropped;
+        uint64_t m_Written;
+    };
+
+    /**
+     * @brief Structured output of executed scripts.
+     *
+     * Managed code calls the internal call Cse.CseHost.Emit(string key, byte[] payload) (see CseHost.cs),
+     * the record lands in a lock-free ring owned by the execution that loaded the calling code.
+     * Readers are non-destructive and keep their own cursor, old records are overwritten once a ring is full.
+     */
+    class ResultChannels
+    {
+    private:
+        struct Impl;
+        std::unique_ptr<Impl> m_Impl;
+
+    public:
+        // bytes per execution, allocated on the first Emit
+        static constexpr size_t CHANNEL_CAPACITY = 1 << 20;
+
+        // executions whose results are kept, the oldest channel is released first
+        static constexpr size_t MAX_CHANNELS = 32;
+
+        static ResultChannels& GetInstance();
+
+        /**
+         * @brief Registers the internal calls. Has to happen before any script using CseHost is compiled.
+         * Pins the module, internal calls can't be unregistered.
+         */
+        void Install();
+
+        /**
+         * @brief Starts the channel of an execution, Emit calls from the domain go there until its next execution.
+         */
+        void Open(uint64_t execution, MonoDomain* domain, const std::string& resource, const std::string& assembly);
+
+        /**
+         * @brief Copies committed records starting at cursor, waiting up to wait for the first one.
+         * @return nullopt if the execution is unknown or its channel was released.
+         */
+        std::optional<ResultBatch> Read(uint64_t execution, uint64_t cursor, size_t maxBytes, std::chrono::milliseconds wait = {});
+
+        std::vector<ResultChannelInfo> List();
+
+    private:
+        ResultChannels();
+        ~ResultChannels();
+    };
+}
\ No newline at end of file
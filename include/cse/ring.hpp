@@ -0,0 +1,225 @@
+#pragma once
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <vector>
+
+namespace cse
+{
+    /**
+     * @brief Lock-free ring of variable sized records for any number of writers, readers keep their own cursor.
+     *
+     * A writer reserves its record with one compare-exchange on the ring position, fills it in place and commits it
+     * by storing its position last. Records never wrap around the end, a filler pads the rest of the lap instead.
+     * Old records are overwritten once the ring is full, a reader notices by the position one lap ahead being reserved.
+     */
+    template<size_t Capacity>
+    class RecordRing
+    {
+        static_assert((Capacity & (Capacity - 1)) == 0, "ring capacity must be a power of two");
+
+    public:
+        // whole records including the header, larger ones are refused
+        static constexpr size_t MAX_RECORD = Capacity / 4;
+
+    private:
+        struct Header
+        {
+            // ring position + 1 once the record is complete, written last
+            uint64_t m_Commit;
+
+            // whole record including this header, 8 byte aligned
+            uint32_t m_Size;
+            uint32_t m_Filler;
+        };
+        static_assert(sizeof(Header) == 16);
+
+        std::once_flag m_Allocated;
+        std::unique_ptr<uint64_t[]> m_Buffer;
+
+        // next free ring position, only ever grows, the offset into the buffer is position % Capacity
+        std::atomic<uint64_t> m_Reserved{ 0 };
+
+        std::mutex m_WaitMutex;
+        std::condition_variable m_Appended;
+        std::atomic<uint32_t> m_Waiters{ 0 };
+
+    public:
+        // the buffer is allocated by the first Append, or earlier by calling this
+        void Allocate()
+        {
+            std::call_once(m_Allocated, [this]() { m_Buffer = std::make_unique<uint64_t[]>(Capacity / sizeof(uint64_t)); });
+        }
+
+        // bytes ever reserved including headers and fillers
+        uint64_t GetWritten() const
+        {
+            return m_Reserved.load(std::memory_order_relaxed);
+        }
+
+        /**
+         * @brief Reserves a record with length bytes after its header, write(uint8_t* body) fills them.
+         * Never blocks once the buffer exists.
+         * @return false if the record is larger than MAX_RECORD.
+         */
+        template<typename Write>
+        bool Append(size_t length, Write&& write)
+        {
+            uint64_t size = (sizeof(Header) + length + 7) & ~uint64_t(7);
+            if (size > MAX_RECORD)
+            {
+                return false;
+            }
+
+            Allocate();
+
+            // records that don't fit before the end of the ring start over at the next lap
+            uint64_t position = m_Reserved.load(std::memory_order_relaxed);
+            uint64_t start;
+            do
+            {
+                uint64_t left = Capacity - (position & (Capacity - 1));
+                start = left < size ? position + left : position;
+            } while (!m_Reserved.compare_exchange_weak(position, start + size, std::memory_order_acq_rel, std::memory_order_relaxed));
+
+            // gaps too short for a header are skipped by readers without one
+            if (start != position && start - position >= sizeof(Header))
+            {
+                auto* filler = reinterpret_cast<Header*>(At(position));
+                filler->m_Size = static_cast<uint32_t>(start - position);
+                filler->m_Filler = 1;
+                Commit(At(position)).store(position + 1, std::memory_order_release);
+            }
+
+            uint8_t* record = At(start);
+            auto* header = reinterpret_cast<Header*>(record);
+            header->m_Size = static_cast<uint32_t>(size);
+            header->m_Filler = 0;
+            write(record + sizeof(Header));
+
+            Commit(record).store(start + 1, std::memory_order_release);
+
+            // pairs with the increment in Wait, either the waiter sees the reservation or this sees the waiter
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            if (m_Waiters.load(std::memory_order_relaxed))
+            {
+                std::lock_guard lock(m_WaitMutex);
+                m_Appended.notify_all();
+            }
+
+            return true;
+        }
+
+        /**
+         * @brief Blocks until something was reserved at or after cursor, or timeout passed.
+         */
+        void Wait(uint64_t cursor, std::chrono::milliseconds timeout)
+        {
+            if (timeout <= std::chrono::milliseconds::zero() || m_Reserved.load(std::memory_order_acquire) > cursor)
+            {
+                return;
+            }
+
+            m_Waiters.fetch_add(1, std::memory_order_seq_cst);
+            {
+                std::unique_lock lock(m_WaitMutex);
+                m_Appended.wait_for(lock, timeout, [&]() { return m_Reserved.load(std::memory_order_seq_cst) > cursor; });
+            }
+            m_Waiters.fetch_sub(1, std::memory_order_relaxed);
+        }
+
+        /**
+         * @brief Copies committed records starting at cursor until about maxBytes of them are taken.
+         * copy(const uint8_t* body, size_t length) returns std::optional<T>, nullopt skips the record. length is the
+         * reserved body, rounded up. A writer one lap ahead may be overwriting the body while it is copied, the copy
+         * is thrown away then and may not trust what it read.
+         * @return bytes overwritten before the reader got to them.
+         */
+        template<typename T, typename Copy>
+        uint64_t Read(uint64_t& cursor, size_t maxBytes, std::vector<T>& out, Copy&& copy)
+        {
+            uint64_t skipped = 0;
+            size_t bytes = 0;
+
+            while (true)
+            {
+                uint64_t reserved = m_Reserved.load(std::memory_order_acquire);
+                if (cursor >= reserved)
+                    break;
+
+                // lapped, continue at the oldest lap start still in the ring, lap starts are always record starts
+                if (reserved - cursor > Capacity)
+                {
+                    uint64_t resume = (reserved - Capacity + Capacity - 1) & ~(uint64_t(Capacity) - 1);
+                    skipped += resume - cursor;
+                    cursor = resume;
+                    continue;
+                }
+
+                uint64_t left = Capacity - (cursor & (Capacity - 1));
+                if (left < sizeof(Header))
+                {
+                    cursor += left;
+                    continue;
+                }
+
+                uint8_t* record = At(cursor);
+                if (Commit(record).load(std::memory_order_acquire) != cursor + 1)
+                    break;
+
+                Header header;
+                std::memcpy(&header, record, sizeof(header));
+
+                bool consistent = header.m_Size >= sizeof(Header) && header.m_Size <= left && header.m_Size % 8 == 0;
+
+                std::optional<T> item;
+                if (consistent && !header.m_Filler)
+                {
+                    item = copy(static_cast<const uint8_t*>(record + sizeof(Header)), size_t(header.m_Size - sizeof(Header)));
+                }
+
+                // torn by a writer one lap ahead, the lap check at the top skips past it
+                if (Overwritten(cursor))
+                    continue;
+
+                if (!consistent)
+                    break;
+
+                if (item)
+                {
+                    if (!out.empty() && bytes + header.m_Size > maxBytes)
+                        break;
+
+                    out.push_back(std::move(*item));
+                    bytes += header.m_Size;
+                }
+
+                cursor += header.m_Size;
+            }
+
+            return skipped;
+        }
+
+    private:
+        uint8_t* At(uint64_t position)
+        {
+            return reinterpret_cast<uint8_t*>(m_Buffer.get()) + (position & (Capacity - 1));
+        }
+
+        static std::atomic_ref<uint64_t> Commit(uint8_t* record)
+        {
+            return std::atomic_ref<uint64_t>(reinterpret_cast<Header*>(record)->m_Commit);
+        }
+
+        // a record is intact as long as no writer has reserved the ring position one lap after it
+        bool Overwritten(uint64_t position) const
+        {
+            return m_Reserved.load(std::memory_order_acquire) > position + Capacity;
+        }
+    };
+}
\ No newline at end of file
@@ -0,0 +1,89 @@
+#pragma once
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+#include <functional>
+
+namespace cse
+{
+    enum class PriorityClass : uint8_t
+    {
+        // listings and other cheap calls, always served first and have a worker of their own
+        Interactive = 0,
+
+        // script executions
+        Execution,
+
+        // benchmarks and other long CPU bound work
+        Bulk,
+
+        Count
+    };
+
+    const char* PriorityClassName(PriorityClass priority);
+
+    struct SchedulerClassStats
+    {
+        PriorityClass m_Class;
+        size_t m_Depth = 0;
+        uint64_t m_Submitted = 0;
+        uint64_t m_Completed = 0;
+
+        // time between Submit and a worker picking the task up
+        double m_WaitAvgMs = 0;
+        double m_WaitP50Ms = 0;
+        double m_WaitP99Ms = 0;
+        double m_WaitMaxMs = 0;
+    };
+
+    struct SchedulerClientStats
+    {
+        uint64_t m_ClientId;
+        uint32_t m_Weight;
+        size_t m_Depth;
+    };
+
+    struct SchedulerStats
+    {
+        size_t m_Workers = 0;
+        size_t m_Busy = 0;
+        std::vector<SchedulerClassStats> m_Classes;
+        std::vector<SchedulerClientStats> m_Clients;
+    };
+
+    /**
+     * @brief Central work queue for everything that doesn't run on an IPC client thread.
+     *
+     * Classes are served in priority order (with a small allowance for lower classes so they can't starve).
+     * Within a class, clients share the workers by weighted fair queuing, so one client streaming executions
+     * can't push another client's requests to the back. Tasks with the same serial key never run concurrently.
+     */
+    class Scheduler
+    {
+    private:
+        struct Impl;
+        std::unique_ptr<Impl> m_Impl;
+
+    public:
+        static Scheduler& GetInstance();
+
+        /**
+         * @param serialKey Tasks sharing a non-empty key run one at a time, in submission order per client.
+         * @return false if the scheduler is shutting down, the task won't run.
+         */
+        bool Submit(std::function<void()> task, PriorityClass priority, uint64_t clientId, const std::string& serialKey = {});
+
+        // relative share of a client within each class, default 1
+        void SetClientWeight(uint64_t clientId, uint32_t weight);
+        void RemoveClient(uint64_t clientId);
+
+        SchedulerStats GetStats();
+
+        void Shutdown();
+
+    private:
+        Scheduler();
+        ~Scheduler();
+    };
+}
\ No newline at end of file
@@ -0,0 +1,127 @@
+#pragma once
+#include <cse/hash.hpp>
+#include <cse/compression.hpp>
+#include <cse/mapped_file.hpp>
+#include <cstdint>
+#include <filesystem>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <vector>
+#include <unordered_map>
+
+namespace cse
+{
+    struct StoreEntry
+    {
+        Hash256 m_Hash;
+        std::string m_Name;
+        uint64_t m_Size = 0;
+
+        // bytes on disk, image and pdb together
+        uint64_t m_StoredSize = 0;
+        uint64_t m_PdbSize = 0;
+        bool m_HasPdb = false;
+
+        // unix seconds
+        int64_t m_Created = 0;
+        int64_t m_LastUsed = 0;
+        uint32_t m_UseCount = 0;
+
+        // most recent first
+        std::vector<std::string> m_Resources;
+    };
+
+    /**
+     * @brief A stored blob, the payload points into the mapping it keeps alive.
+     */
+    struct StoredPayload
+    {
+        std::shared_ptr<MappedFile> m_File;
+        Payload m_Payload;
+    };
+
+    struct StoreStats
+    {
+        std::filesystem::path m_Directory;
+        size_t m_Entries = 0;
+        uint64_t m_Bytes = 0;
+        uint64_t m_Budget = 0;
+        uint64_t m_Evicted = 0;
+    };
+
+    /**
+     * @brief On-disk store of executed assemblies (and their PDBs), keyed by SHA-256 of the raw image.
+     *
+     * Blobs are PackBlob files under <directory>/blobs, optionally LZ4 compressed. The index is a fixed array of
+     * records in a memory-mapped file, so it survives restarts without being parsed or rewritten.
+     * Least recently used entries are evicted once the stored bytes exceed the budget.
+     */
+    class AssemblyStore
+    {
+    private:
+        struct Record;
+
+        std::mutex m_Mutex;
+        std::filesystem::path m_Directory;
+        std::unique_ptr<MappedFile> m_Index;
+        std::unordered_map<Hash256, uint32_t, Hash256Hasher> m_Slots;
+
+        uint64_t m_Bytes = 0;
+        uint64_t m_Budget = 512ull * 1024 * 1024;
+        uint64_t m_Evicted = 0;
+        Codec m_Codec = Codec::Lz4;
+
+    public:
+        static AssemblyStore& GetInstance();
+
+        /**
+         * @brief Opens (or creates) the store in a directory, the default is %TEMP%\cse_store.
+         * Called lazily with the default on first use.
+         */
+        bool Open(const std::filesystem::path& directory);
+
+        bool Contains(const Hash256& hash);
+
+        /**
+         * @brief Stores an image (and pdb) under its hash, or only records the use if it is already stored.
+         */
+        bool Put(const Hash256& hash, const std::string& name, std::span<const uint8_t> image, std::optional<std::span<const uint8_t>> pdb, const std::string& resource);
+
+        /**
+         * @brief Maps the stored image, nullopt if unknown or the blob is gone.
+         */
+        std::optional<StoredPayload> GetImage(const Hash256& hash);
+        std::optional<StoredPayload> GetPdb(const Hash256& hash);
+
+        // bumps last used / use count and remembers the resource
+        void Touch(const Hash256& hash, const std::string& resource);
+
+        std::optional<StoreEntry> Find(const Hash256& hash);
+        std::vector<StoreEntry> List();
+        bool Remove(const Hash256& hash);
+
+        void SetBudget(uint64_t bytes);
+        void SetCodec(Codec codec);
+        StoreStats GetStats();
+
+        void Flush();
+
+    private:
+        AssemblyStore() = default;
+        ~AssemblyStore() = default;
+
+        // require m_Mutex
+        bool OpenLocked(const std::filesystem::path& directory);
+        bool EnsureOpen();
+        Record* GetRecords();
+        uint32_t GetCapacity();
+        std::filesystem::path BlobPath(const Hash256& hash, bool pdb) const;
+        std::optional<StoredPayload> MapBlob(const Hash256& hash, bool pdb);
+        void TouchSlot(uint32_t slot, const std::string& resource);
+        void RemoveSlot(uint32_t slot);
+        void Evict(uint64_t incoming);
+        static StoreEntry ToEntry(const Record& record);
+    };
+}
\ No newline at end of file
@@ -0,0 +1,131 @@
+#pragma once
+#include <cse/mono.hpp>
+#include <atomic>
+#include <cstdint>
+#include <deque>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace cse
+{
+    // process wide GC and JIT counters at one point in time
+    struct RuntimeSample
+    {
+        int64_t m_HeapUsed = 0;
+        int64_t m_HeapSize = 0;
+
+        uint64_t m_MinorCollections = 0;
+        uint64_t m_MajorCollections = 0;
+
+        // -1 if the runtime doesn't expose the counter
+        int64_t m_MethodsCompiled = -1;
+        double m_JitMs = -1;
+    };
+
+    // an execution being measured, from Begin to Record
+    struct UsageWindow
+    {
+        RuntimeSample m_Before;
+
+        // executions begun up to and including this one
+        uint64_t m_Begun = 0;
+
+        // another measured execution was already running when this one began
+        bool m_Overlapped = false;
+    };
+
+    struct ExecutionUsage
+    {
+        uint64_t m_Execution;
+        std::string m_Resource;
+        std::string m_Assembly;
+        bool m_Success = false;
+
+        // used heap after the load minus before it, negative if a collection ran in between
+        int64_t m_HeapDelta = 0;
+        int64_t m_HeapAfter = 0;
+
+        uint64_t m_MinorCollections = 0;
+        uint64_t m_MajorCollections = 0;
+
+        int64_t m_MethodsCompiled = -1;
+        double m_JitMs = -1;
+
+        double m_ElapsedMs = 0;
+
+        // another measured execution ran during this one, the deltas include its work
+        bool m_Shared = false;
+    };
+
+    struct ResourceUsage
+    {
+        std::string m_Resource;
+        uint64_t m_Executions = 0;
+
+        int64_t m_HeapDelta = 0;
+        int64_t m_PeakHeapDelta = 0;
+
+        uint64_t m_MinorCollections = 0;
+        uint64_t m_MajorCollections = 0;
+
+        uint64_t m_MethodsCompiled = 0;
+        double m_JitMs = 0;
+
+        double m_ElapsedMs = 0;
+
+        // executions counted with shared deltas, the totals are approximate unless this is 0
+        uint64_t m_SharedExecutions = 0;
+    };
+
+    /**
+     * @brief Attributes managed heap growth, collections and JIT work to the execution that caused them.
+     * The executor samples the runtime right before and after CreateAssemblyInternal, the difference is the execution's.
+     * Counters are process wide, whatever else runs during the load (game ticks, concurrent loads) is counted as well.
+     * Measured executions that overlap (fan-out, loads into different domains) are marked shared rather than serialized.
+     */
+    class UsageTracker
+    {
+    private:
+        static constexpr size_t MAX_EXECUTIONS = 256;
+
+        std::mutex m_Mutex;
+        std::deque<ExecutionUsage> m_Executions;
+        std::unordered_map<std::string, ResourceUsage> m_Resources;
+
+        // resolved on the first sample, counters are registered when the runtime starts
+        std::once_flag m_CountersResolved;
+        MonoCounter* m_MethodsCounter = nullptr;
+        MonoCounter* m_JitTimeCounter = nullptr;
+
+        std::atomic<uint32_t> m_InFlight{ 0 };
+        std::atomic<uint64_t> m_Begun{ 0 };
+
+    public:
+        static UsageTracker& GetInstance();
+
+        RuntimeSample Sample();
+
+        /**
+         * @brief Samples the runtime before an execution and counts it as in flight until its Record.
+         */
+        UsageWindow Begin();
+
+        void Record(uint64_t execution, const std::string& resource, const std::string& assembly, bool success,
+            const UsageWindow& window, const RuntimeSample& after, double elapsedMs);
+
+        std::optional<ExecutionUsage> Find(uint64_t execution);
+
+        // executions with an id above since, oldest first
+        std::vector<ExecutionUsage> GetExecutions(uint64_t since = 0);
+
+        std::vector<ResourceUsage> GetResources();
+
+    private:
+        UsageTracker() = default;
+
+        void ResolveCounters();
+    };
+}
\ No newline at end of file
@@ -0,0 +1,19 @@
+#pragma once
+#include <cstdint>
+#include <span>
+#include <string>
+
+namespace cse
+{
+    // UTF-16 as Mono strings and the capture pipes hold it, unpaired surrogates become U+FFFD
+
+    size_t Utf8Length(std::span<const uint16_t> text);
+
+    /**
+     * @brief Writes Utf8Length(text) bytes to out.
+     * @return one past the last byte written.
+     */
+    uint8_t* EncodeUtf8(std::span<const uint16_t> text, uint8_t* out);
+
+    void AppendUtf8(std::string& out, std::span<const uint16_t> text);
+}
\ No newline at end of file
@@ -0,0 +1,73 @@
+#pragma once
+#include <cse/mono.hpp>
+#include <cstdint>
+#include <chrono>
+#include <mutex>
+#include <deque>
+#include <string>
+#include <vector>
+
+namespace cse
+{
+    struct WarmupOptions
+    {
+        bool m_Enabled = false;
+
+        // compile time allowed per assembly, whatever is left is JIT compiled on first call as before
+        std::chrono::milliseconds m_Budget{ 250 };
+
+        // "Namespace.Class::Method" (as profiler_report names them) compiled before the rest of the image, e.g. the methods a script's first tick touches
+        std::vector<std::string> m_HotMethods;
+    };
+
+    struct WarmupReport
+    {
+        uint64_t m_Sequence;
+        std::string m_Assembly;
+        std::string m_Resource;
+
+        size_t m_Methods = 0;
+        size_t m_Compiled = 0;
+        size_t m_Failed = 0;
+
+        // abstract, generic, extern and runtime implemented methods have nothing to compile
+        size_t m_Skipped = 0;
+
+        double m_JitMs = 0;
+        bool m_BudgetExhausted = false;
+    };
+
+    /**
+     * @brief Compiles a freshly loaded assembly's methods ahead of their first call.
+     * Runs on the scheduler's bulk workers, one assembly at a time, so first-tick JIT cost moves off the game thread.
+     * Methods are instrumented for ScriptProfiler only if it is running when they compile, warm-up included.
+     */
+    class JitWarmup
+    {
+    private:
+        static constexpr size_t MAX_REPORTS = 64;
+
+        std::mutex m_Mutex;
+        WarmupOptions m_Options;
+        std::deque<WarmupReport> m_Reports;
+        uint64_t m_NextSequence = 1;
+
+    public:
+        static JitWarmup& GetInstance();
+
+        void SetOptions(WarmupOptions options);
+        WarmupOptions GetOptions();
+
+        /**
+         * @brief Queues a warm-up of the assembly if warm-up is enabled. Call while attached to the domain.
+         */
+        void Schedule(MonoDomain* domain, MonoAssembly* assembly, const std::string& resource);
+
+        std::vector<WarmupReport> GetReports(uint64_t since = 0);
+
+    private:
+        JitWarmup() = default;
+
+        void Run(MonoDomain* domain, int32_t domainId, MonoImage* image, const std::string& resource, const WarmupOptions& options);
+    };
+}
\ No newline at end of file
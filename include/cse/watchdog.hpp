@@ -0,0 +1,100 @@
+#pragma once
+#include <cse/mono.hpp>
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <optional>
+
+namespace cse
+{
+    enum class ExecutionOutcome
+    {
+        Completed,
+        Failed,
+
+        // the deadline passed before the script returned, it was aborted or abandoned
+        TimedOut,
+    };
+
+    const char* ExecutionOutcomeName(ExecutionOutcome outcome);
+
+    struct WatchdogOptions
+    {
+        // 0 runs executions on the calling thread without a deadline
+        std::chrono::milliseconds m_Deadline{ 30000 };
+
+        // time an aborted script gets to unwind before its runner is given up on
+        std::chrono::milliseconds m_Grace{ 5000 };
+    };
+
+    struct WatchdogStats
+    {
+        uint64_t m_Runs = 0;
+        uint64_t m_TimedOut = 0;
+
+        // returned after the abort
+        uint64_t m_Aborted = 0;
+
+        // still running after the grace period, their runners are never reused
+        uint64_t m_Abandoned = 0;
+
+        // abandoned runs that still haven't returned
+        uint64_t m_Stuck = 0;
+
+        size_t m_IdleRunners = 0;
+    };
+
+    /**
+     * @brief Runs script code on runner threads with a deadline.
+     *
+     * The caller waits until the run returns or its deadline passes and gets TimedOut in the latter case, it is never held longer.
+     * The watchdog thread then aborts the runner's managed thread (mono_thread_stop, if the runtime has it) and, if it still
+     * hasn't returned after the grace period, abandons it. Runners that hit a deadline are retired, later runs get fresh ones.
+     */
+    class ExecutionWatchdog
+    {
+    private:
+        struct Impl;
+        std::unique_ptr<Impl> m_Impl;
+
+    public:
+        static ExecutionWatchdog& GetInstance();
+
+        void SetOptions(WatchdogOptions options);
+        WatchdogOptions GetOptions();
+
+        WatchdogStats GetStats();
+
+        /**
+         * @brief Runs task on a runner attached to domain.
+         * Everything task uses has to be captured by value, an abandoned task outlives the call.
+         * @param deadline Overrides the configured deadline, 0 runs the task on the calling thread.
+         */
+        ExecutionOutcome Run(MonoDomain* domain, uint64_t execution, std::function<void()> task, std::optional<std::chrono::milliseconds> deadline = std::nullopt);
+
+        /**
+         * @brief Deadline for runs started on this thread while the scope lives, e.g. one a request asked for.
+         */
+        class DeadlineScope
+        {
+        private:
+            std::optional<std::chrono::milliseconds> m_Previous;
+
+        public:
+            explicit DeadlineScope(std::optional<std::chrono::milliseconds> deadline);
+            ~DeadlineScope();
+
+            DeadlineScope(const DeadlineScope&) = delete;
+            DeadlineScope& operator=(const DeadlineScope&) = delete;
+
+            static std::optional<std::chrono::milliseconds> Current();
+        };
+
+        void Shutdown();
+
+    private:
+        ExecutionWatchdog();
+        ~ExecutionWatchdog();
+    };
+}
\ No newline at end of file
@@ -0,0 +1,85 @@
+#pragma once
+#include <cse/hash.hpp>
+#include <cstdint>
+#include <chrono>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace cse
+{
+    struct WatchRule
+    {
+        std::string m_Directory;
+
+        // matched against the file name, * and ? wildcards, case insensitive
+        std::string m_Pattern = "*.dll";
+
+        std::string m_Resource;
+        bool m_Recursive = false;
+
+        // a file is only picked up once it stopped changing for this long, bursts from one build collapse into one run
+        std::chrono::milliseconds m_Debounce{ 300 };
+    };
+
+    struct WatchResult
+    {
+        // increasing, clients pass the last one they saw to only get newer results
+        uint64_t m_Sequence;
+        uint64_t m_RuleId;
+        std::string m_Path;
+        std::string m_Resource;
+        Hash256 m_Hash;
+        bool m_Success;
+        std::string m_Error;
+
+        // from the debounced change to the end of the execution
+        double m_ElapsedMs;
+    };
+
+    struct WatchRuleInfo
+    {
+        uint64_t m_Id;
+        WatchRule m_Rule;
+        uint64_t m_Changes;
+        uint64_t m_Executions;
+        uint64_t m_Skipped;
+
+        // the watch stopped on an error (e.g. the directory was deleted), m_Error is the Windows error code
+        bool m_Failed;
+        uint32_t m_Error;
+    };
+
+    /**
+     * @brief Watches script directories and re-executes assemblies whose content changed.
+     * Executions go through the execute_in_resource command, so they are scheduled like IPC requests.
+     */
+    class ScriptWatcher
+    {
+    private:
+        struct Impl;
+        std::unique_ptr<Impl> m_Impl;
+
+    public:
+        static ScriptWatcher& GetInstance();
+
+        /**
+         * @return Id of the rule, 0 if the directory can't be watched.
+         */
+        uint64_t AddRule(const WatchRule& rule);
+        bool RemoveRule(uint64_t id);
+
+        std::vector<WatchRuleInfo> GetRules();
+
+        /**
+         * @brief Results newer than the given sequence, at most the last 64 are kept.
+         */
+        std::vector<WatchResult> GetResults(uint64_t since = 0);
+
+        void Shutdown();
+
+    private:
+        ScriptWatcher();
+        ~ScriptWatcher();
+    };
+}
\ No newline at end of file
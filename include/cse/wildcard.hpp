@@ -0,0 +1,50 @@
+#pragma once
+#include <functional>
+#include <string_view>
+
+namespace cse
+{
+    /**
+     * @brief Glob match over the whole name: * is any run of characters (none included), ? is any one character.
+     * A mismatch backtracks to the last *, so the cost stays linear in practice.
+     * @param equal Compares a pattern character with a name character, exact by default.
+     */
+    template<typename Char, typename Equal = std::equal_to<Char>>
+    bool MatchWildcard(std::basic_string_view<Char> pattern, std::basic_string_view<Char> name, Equal equal = {})
+    {
+        constexpr auto npos = std::basic_string_view<Char>::npos;
+
+        size_t p = 0, n = 0;
+        size_t star = npos, resume = 0;
+
+        while (n < name.size())
+        {
+            if (p < pattern.size() && (pattern[p] == Char('?') || equal(pattern[p], name[n])))
+            {
+                p++;
+                n++;
+            }
+            else if (p < pattern.size() && pattern[p] == Char('*'))
+            {
+                star = p++;
+                resume = n;
+            }
+            else if (star != npos)
+            {
+                p = star + 1;
+                n = ++resume;
+            }
+            else
+            {
+                return false;
+            }
+        }
+
+        while (p < pattern.size() && pattern[p] == Char('*'))
+        {
+            p++;
+        }
+
+        return p == pattern.size();
+    }
+}
\ No newline at end of file
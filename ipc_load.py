@@ -0,0 +1,676 @@
+import argparse
+import base64
+import hashlib
+import json
+import os
+import random
+import socket
+import struct
+import sys
+import threading
+import time
+
+from embed_payloads import lz4_compress
+
+try:
+    import msgpack
+except ImportError:
+    msgpack = None
+
+# Load generator and session recorder for the executor's IPC server (see ipc.cpp).
+# Frames are a little-endian uint32 header (length in the low 30 bits, IPC_FRAME_* flags on top) and the body,
+# an LZ4 body starts with its uint32 raw length. Connections carry any number of request/reply pairs in sequence.
+#
+# Endpoints are "pipe:NAME" (a Windows named pipe, \\.\pipe\NAME), "unix:PATH" or "tcp:HOST:PORT".
+# The executor itself only listens on pipe:my_ipc_pipe, the socket endpoints are for the recorder and for
+# "serve", a stand-in host that answers every request, so the tool can be exercised away from Windows.
+
+FRAME_LENGTH_MASK = 0x3FFFFFFF
+FRAME_LZ4 = 0x80000000
+FRAME_MSGPACK = 0x40000000
+
+# replies below this aren't compressed, same as IPC_COMPRESS_THRESHOLD
+COMPRESS_THRESHOLD = 1024
+
+DEFAULT_ENDPOINT = "pipe:my_ipc_pipe"
+
+
+def lz4_decompress(block, raw_length):
+    out = bytearray()
+    pos = 0
+
+    while pos < len(block):
+        token = block[pos]
+        pos += 1
+
+        lit_len = token >> 4
+        if lit_len == 15:
+            while True:
+                extra = block[pos]
+                pos += 1
+                lit_len += extra
+                if extra != 255:
+                    break
+
+        out += block[pos:pos + lit_len]
+        pos += lit_len
+        if pos >= len(block):
+            break
+
+        offset = struct.unpack_from("<H", block, pos)[0]
+        pos += 2
+        if offset == 0 or offset > len(out):
+            raise ValueError("invalid LZ4 match offset")
+
+        match_len = token & 15
+        if match_len == 15:
+            while True:
+                extra = block[pos]
+                pos += 1
+                match_len += extra
+                if extra != 255:
+                    break
+        match_len += 4
+
+        # matches may overlap their own output
+        start = len(out) - offset
+        for i in range(match_len):
+            out.append(out[start + i])
+
+    if len(out) != raw_length:
+        raise ValueError(f"LZ4 block decoded to {len(out)} bytes, expected {raw_length}")
+    return bytes(out)
+
+
+def encode(message, flags):
+    if flags & FRAME_MSGPACK:
+        if msgpack is None:
+            raise RuntimeError("MessagePack frames need the msgpack module")
+        body = msgpack.packb(message, use_bin_type=True)
+    else:
+        body = json.dumps(message, separators=(",", ":")).encode()
+
+    if (flags & FRAME_LZ4) and len(body) >= COMPRESS_THRESHOLD:
+        body = struct.pack("<I", len(body)) + lz4_compress(body)
+    else:
+        flags &= ~FRAME_LZ4
+
+    return flags, body
+
+
+def decode(flags, body):
+    if not body:
+        return {}
+
+    if flags & FRAME_LZ4:
+        (raw_length,) = struct.unpack_from("<I", body)
+        body = lz4_decompress(body[4:], raw_length)
+
+    if flags & FRAME_MSGPACK:
+        if msgpack is None:
+            raise RuntimeError("MessagePack frames need the msgpack module")
+        return msgpack.unpackb(body, raw=False)
+    return json.loads(body)
+
+
+class Connection:
+    def __init__(self, read, write, close):
+        self.read = read
+        self.write = write
+        self.close = close
+
+    def read_exact(self, size):
+        data = bytearray()
+        while len(data) < size:
+            chunk = self.read(size - len(data))
+            if not chunk:
+                return None
+            data += chunk
+        return bytes(data)
+
+    def read_frame(self):
+        header = self.read_exact(4)
+        if header is None:
+            return None
+
+        (header,) = struct.unpack("<I", header)
+        body = self.read_exact(header & FRAME_LENGTH_MASK)
+        if body is None:
+            return None
+        return header & ~FRAME_LENGTH_MASK, body
+
+    def write_frame(self, flags, body):
+        self.write(struct.pack("<I", len(body) | flags) + body)
+
+
+def socket_connection(sock):
+    return Connection(sock.recv, sock.sendall, sock.close)
+
+
+def parse_endpoint(endpoint):
+    kind, _, address = endpoint.partition(":")
+    if kind == "pipe":
+        return kind, "\\\\.\\pipe\\" + address
+    if kind == "unix":
+        return kind, address
+    if kind == "tcp":
+        host, _, port = address.rpartition(":")
+        return kind, (host or "127.0.0.1", int(port))
+    raise ValueError(f"unknown endpoint: {endpoint}")
+
+
+def connect(endpoint):
+    kind, address = parse_endpoint(endpoint)
+    if kind == "pipe":
+        f = open(address, "r+b", buffering=0)
+        return Connection(f.read, f.write, f.close)
+
+    sock = socket.socket(socket.AF_UNIX if kind == "unix" else socket.AF_INET, socket.SOCK_STREAM)
+    sock.connect(address)
+    if kind == "tcp":
+        sock.setsockopt(socket.IPPROTO_TCP, socket.TCP_NODELAY, 1)
+    return socket_connection(sock)
+
+
+def listen(endpoint, handler):
+    """Accepts connections forever, each is handed to handler(connection, client_id) on its own thread."""
+    kind, address = parse_endpoint(endpoint)
+    client_ids = iter(range(1, 1 << 62))
+
+    def spawn(connection):
+        threading.Thread(target=handler, args=(connection, next(client_ids)), daemon=True).start()
+
+    if kind == "pipe":
+        import _winapi
+
+        while True:
+            pipe = _winapi.CreateNamedPipe(
+                address,
+                _winapi.PIPE_ACCESS_DUPLEX,
+                _winapi.PIPE_TYPE_BYTE | _winapi.PIPE_READMODE_BYTE | _winapi.PIPE_WAIT,
+                _winapi.PIPE_UNLIMITED_INSTANCES,
+                65536, 65536, 0, _winapi.NULL)
+            _winapi.ConnectNamedPipe(pipe, False)
+
+            def read(size, pipe=pipe):
+                try:
+                    data, _ = _winapi.ReadFile(pipe, size)
+                    return data
+                except OSError:
+                    return b""
+
+            def write(data, pipe=pipe):
+                while data:
+                    written, _ = _winapi.WriteFile(pipe, data)
+                    data = data[written:]
+
+            spawn(Connection(read, write, lambda pipe=pipe: _winapi.CloseHandle(pipe)))
+
+    if kind == "unix":
+        if os.path.exists(address):
+            os.unlink(address)
+        server = socket.socket(socket.AF_UNIX, socket.SOCK_STREAM)
+    else:
+        server = socket.socket(socket.AF_INET, socket.SOCK_STREAM)
+        server.setsockopt(socket.SOL_SOCKET, socket.SO_REUSEADDR, 1)
+
+    server.bind(address)
+    server.listen(128)
+    while True:
+        sock, _ = server.accept()
+        if kind == "tcp":
+            sock.setsockopt(socket.IPPROTO_TCP, socket.TCP_NODELAY, 1)
+        spawn(socket_connection(sock))
+
+
+def is_error(reply):
+    return not isinstance(reply, dict) or "error" in reply or reply.get("success") is False
+
+
+class Stats:
+    def __init__(self):
+        self.lock = threading.Lock()
+        self.latencies = {}
+        self.errors = {}
+        self.sent = 0
+        self.received = 0
+
+    def add(self, cmd, latency, error, sent, received):
+        with self.lock:
+            self.latencies.setdefault(cmd, []).append(latency)
+            if error:
+                self.errors[cmd] = self.errors.get(cmd, 0) + 1
+            self.sent += sent
+            self.received += received
+
+    def report(self, elapsed):
+        def percentile(values, p):
+            return values[min(len(values) - 1, int(len(values) * p))]
+
+        total = sum(len(v) for v in self.latencies.values())
+        print(f"{total} requests in {elapsed:.2f} s, {total / elapsed:.1f} req/s, "
+              f"{self.sent / elapsed / 1024:.1f} KiB/s out, {self.received / elapsed / 1024:.1f} KiB/s in")
+
+        print(f"{'cmd':<32}{'count':>8}{'errors':>8}{'p50 ms':>10}{'p90 ms':>10}{'p99 ms':>10}{'max ms':>10}")
+        everything = []
+        for cmd, values in sorted(self.latencies.items()):
+            values.sort()
+            everything += values
+            print(f"{cmd:<32}{len(values):>8}{self.errors.get(cmd, 0):>8}"
+                  f"{percentile(values, 0.5):>10.2f}{percentile(values, 0.9):>10.2f}"
+                  f"{percentile(values, 0.99):>10.2f}{values[-1]:>10.2f}")
+
+        if len(self.latencies) > 1:
+            everything.sort()
+            print(f"{'all':<32}{len(everything):>8}{sum(self.errors.values()):>8}"
+                  f"{percentile(everything, 0.5):>10.2f}{percentile(everything, 0.9):>10.2f}"
+                  f"{percentile(everything, 0.99):>10.2f}{everything[-1]:>10.2f}")
+
+
+def load_workload(path):
+    # [{ "request": {...}, "weight"?: 1, "payload"?: { field: size } }], payload fields get random bytes of that size,
+    # sent as binary in MessagePack frames and base64 in JSON ones
+    if path is None:
+        return [{"request": {"cmd": "scheduler_stats"}, "weight": 1}]
+
+    with open(path) as f:
+        workload = json.load(f)
+    if isinstance(workload, dict):
+        workload = [workload]
+    return workload
+
+
+def build_request(entry, flags):
+    request = dict(entry["request"])
+    for field, size in entry.get("payload", {}).items():
+        data = random.randbytes(size)
+        request[field] = data if flags & FRAME_MSGPACK else base64.b64encode(data).decode()
+    return request
+
+
+def weak_checksum(block):
+    # WeakChecksum in delta.cpp: byte sum in the low 16 bits, sum weighted by distance from the end on top
+    a = sum(block)
+    b = sum((len(block) - i) * byte for i, byte in enumerate(block))
+    return ((a & 0xFFFF) | (b << 16)) & 0xFFFFFFFF
+
+
+def strong_checksum(block):
+    # StrongChecksum: the first 8 bytes of the SHA-256, little-endian
+    return struct.unpack_from("<Q", hashlib.sha256(block).digest())[0]
+
+
+def compute_delta(weak, strong, base_size, block_size, target):
+    """Expresses target as copies of the base's signed blocks plus literals, in execute_delta's ops format."""
+    ops = []
+
+    def emit_literal(start, end):
+        if start == end:
+            return
+        if not ops or "copy" in ops[-1]:
+            ops.append({"data": bytearray()})
+        ops[-1]["data"] += target[start:end]
+
+    def emit_copy(block):
+        if ops and "copy" in ops[-1] and ops[-1]["copy"] + ops[-1]["count"] == block:
+            ops[-1]["count"] += 1
+            return
+        ops.append({"copy": block, "count": 1})
+
+    # only full blocks take part in the rolling search, the short tail block is matched at the very end
+    full_blocks = base_size // block_size
+    index = {}
+    for i in range(min(full_blocks, len(weak))):
+        index.setdefault(weak[i], []).append(i)
+
+    anchor = position = 0
+    a = b = 0
+    rolling = False
+
+    while position + block_size <= len(target):
+        if not rolling:
+            checksum = weak_checksum(target[position:position + block_size])
+            a, b = checksum & 0xFFFF, checksum >> 16
+            rolling = True
+
+        match = None
+        candidates = index.get((a & 0xFFFF) | ((b << 16) & 0xFFFFFFFF))
+        if candidates:
+            checksum = strong_checksum(target[position:position + block_size])
+            match = next((i for i in candidates if strong[i] == checksum), None)
+
+        if match is not None:
+            emit_literal(anchor, position)
+            emit_copy(match)
+            position += block_size
+            anchor = position
+            rolling = False
+            continue
+
+        if position + block_size == len(target):
+            break
+
+        out, new = target[position], target[position + block_size]
+        a = (a - out + new) & 0xFFFFFFFF
+        b = (b - block_size * out + a) & 0xFFFFFFFF
+        position += 1
+
+    tail_size = base_size % block_size
+    if tail_size and full_blocks < len(weak) and len(target) - anchor >= tail_size:
+        tail = target[len(target) - tail_size:]
+        if weak_checksum(tail) == weak[full_blocks] and strong_checksum(tail) == strong[full_blocks]:
+            emit_literal(anchor, len(target) - tail_size)
+            emit_copy(full_blocks)
+            return ops
+
+    emit_literal(anchor, len(target))
+    return ops
+
+
+def run(args):
+    workload = load_workload(args.workload)
+    weights = [entry.get("weight", 1) for entry in workload]
+
+    flags = (FRAME_MSGPACK if args.msgpack else 0) | (FRAME_LZ4 if args.lz4 else 0)
+
+    # requests are built up front so encoding them isn't part of the measurement
+    frames = []
+    for entry in workload:
+        variants = []
+        for _ in range(max(1, args.variants)):
+            variants.append(encode(build_request(entry, flags), flags))
+        frames.append((entry["request"].get("cmd", "?"), variants))
+
+    stats = Stats()
+    remaining = [args.requests]
+    remaining_lock = threading.Lock()
+    deadline = time.perf_counter() + args.duration if args.duration else None
+    failures = []
+
+    def take():
+        if deadline is not None:
+            return time.perf_counter() < deadline
+        with remaining_lock:
+            if remaining[0] <= 0:
+                return False
+            remaining[0] -= 1
+            return True
+
+    def client():
+        try:
+            connection = connect(args.endpoint)
+        except OSError as e:
+            failures.append(str(e))
+            return
+
+        try:
+            while take():
+                cmd, variants = random.choices(frames, weights)[0]
+                frame_flags, body = random.choice(variants)
+
+                start = time.perf_counter()
+                connection.write_frame(frame_flags, body)
+                reply = connection.read_frame()
+                latency = (time.perf_counter() - start) * 1000.0
+
+                if reply is None:
+                    stats.add(cmd, latency, True, len(body) + 4, 0)
+                    failures.append("connection closed by server")
+                    return
+
+                stats.add(cmd, latency, is_error(decode(*reply)), len(body) + 4, len(reply[1]) + 4)
+                if args.think_ms:
+                    time.sleep(args.think_ms / 1000.0)
+        finally:
+            connection.close()
+
+    start = time.perf_counter()
+    threads = [threading.Thread(target=client) for _ in range(args.clients)]
+    for thread in threads:
+        thread.start()
+    for thread in threads:
+        thread.join()
+
+    elapsed = time.perf_counter() - start
+    for failure in sorted(set(failures)):
+        print(f"client failed: {failure} ({failures.count(failure)}x)", file=sys.stderr)
+    if stats.latencies:
+        stats.report(elapsed)
+
+
+def record(args):
+    # one JSON line per request: { t, client, flags, body (base64), latency_ms, reply_size }
+    log = open(args.output, "w")
+    log_lock = threading.Lock()
+    origin = time.perf_counter()
+
+    def handler(downstream, client_id):
+        try:
+            upstream = connect(args.endpoint)
+        except OSError as e:
+            print(f"[{client_id}] failed to connect upstream: {e}", file=sys.stderr)
+            downstream.close()
+            return
+
+        try:
+            while True:
+                frame = downstream.read_frame()
+                if frame is None:
+                    break
+
+                start = time.perf_counter()
+                upstream.write_frame(*frame)
+                reply = upstream.read_frame()
+                latency = (time.perf_counter() - start) * 1000.0
+
+                entry = {
+                    "t": round(start - origin, 6),
+                    "client": client_id,
+                    "flags": frame[0],
+                    "body": base64.b64encode(frame[1]).decode(),
+                    "latency_ms": round(latency, 3),
+                    "reply_size": len(reply[1]) if reply else None,
+                }
+                with log_lock:
+                    log.write(json.dumps(entry) + "\n")
+                    log.flush()
+
+                if reply is None:
+                    break
+                downstream.write_frame(*reply)
+        finally:
+            upstream.close()
+            downstream.close()
+
+    print(f"Recording {args.listen} -> {args.endpoint} into {args.output}")
+    try:
+        listen(args.listen, handler)
+    except KeyboardInterrupt:
+        pass
+    finally:
+        with log_lock:
+            log.close()
+
+
+def replay(args):
+    sessions = {}
+    with open(args.input) as f:
+        for line in f:
+            if line.strip():
+                entry = json.loads(line)
+                sessions.setdefault(entry["client"], []).append(entry)
+
+    # timing is relative to the first recorded request, not to when the recorder started
+    first = min((entries[0]["t"] for entries in sessions.values()), default=0.0)
+    stats = Stats()
+    failures = []
+
+    def client(entries):
+        try:
+            connection = connect(args.endpoint)
+        except OSError as e:
+            failures.append(str(e))
+            return
+
+        try:
+            for entry in entries:
+                flags = entry["flags"]
+                body = base64.b64decode(entry["body"])
+                cmd = decode(flags, body).get("cmd", "?")
+
+                if not args.fast:
+                    delay = origin + (entry["t"] - first) / args.speed - time.perf_counter()
+                    if delay > 0:
+                        time.sleep(delay)
+
+                start = time.perf_counter()
+                connection.write_frame(flags, body)
+                reply = connection.read_frame()
+                latency = (time.perf_counter() - start) * 1000.0
+
+                if reply is None:
+                    stats.add(cmd, latency, True, len(body) + 4, 0)
+                    failures.append("connection closed by server")
+                    return
+                stats.add(cmd, latency, is_error(decode(*reply)), len(body) + 4, len(reply[1]) + 4)
+        finally:
+            connection.close()
+
+    print(f"Replaying {sum(len(v) for v in sessions.values())} requests over {len(sessions)} connections "
+          f"({'as fast as possible' if args.fast else f'{args.speed}x recorded timing'})")
+
+    origin = time.perf_counter()
+    threads = [threading.Thread(target=client, args=(entries,)) for entries in sessions.values()]
+    for thread in threads:
+        thread.start()
+    for thread in threads:
+        thread.join()
+
+    elapsed = time.perf_counter() - origin
+    for failure in sorted(set(failures)):
+        print(f"client failed: {failure} ({failures.count(failure)}x)", file=sys.stderr)
+    if stats.latencies:
+        stats.report(elapsed)
+
+
+def delta(args):
+    # fetches the base's block signatures, matches the new build against them and sends only what changed
+    flags = FRAME_MSGPACK if args.msgpack else 0
+    with open(args.image, "rb") as f:
+        target = f.read()
+
+    connection = connect(args.endpoint)
+
+    def call(request):
+        connection.write_frame(*encode(request, flags))
+        reply = connection.read_frame()
+        if reply is None:
+            raise RuntimeError("connection closed by server")
+        return decode(*reply)
+
+    try:
+        signatures = call({"cmd": "get_signatures", "hash": args.base, "blockSize": args.block_size})
+        if is_error(signatures):
+            print(f"get_signatures failed: {signatures.get('error')}", file=sys.stderr)
+            return
+
+        ops = compute_delta(signatures["weak"], signatures["strong"], signatures["size"], signatures["blockSize"], target)
+        literal = sum(len(op["data"]) for op in ops if "data" in op)
+        for op in ops:
+            if "data" in op:
+                op["data"] = bytes(op["data"]) if flags & FRAME_MSGPACK else base64.b64encode(op["data"]).decode()
+
+        request = {"cmd": "execute_delta", "resource": args.resource, "base": args.base,
+                   "hash": hashlib.sha256(target).hexdigest(), "blockSize": signatures["blockSize"], "ops": ops}
+        if args.name:
+            request["name"] = args.name
+
+        print(f"{len(target)} byte image, {literal} bytes sent as literals in {len(ops)} ops")
+        print(json.dumps(call(request), indent=2))
+    finally:
+        connection.close()
+
+
+def serve(args):
+    # stand-in host: answers every request in its own encoding after a fixed delay, closes on unparseable frames
+    def handler(connection, client_id):
+        try:
+            while True:
+                frame = connection.read_frame()
+                if frame is None:
+                    break
+
+                try:
+                    request = decode(*frame)
+                except (ValueError, RuntimeError) as e:
+                    print(f"[{client_id}] bad frame: {e}", file=sys.stderr)
+                    break
+
+                if args.delay_ms:
+                    time.sleep(args.delay_ms / 1000.0)
+
+                reply = {"success": True, "cmd": request.get("cmd"), "client": client_id}
+                if args.reply_size:
+                    reply["padding"] = "x" * args.reply_size
+                connection.write_frame(*encode(reply, frame[0]))
+        finally:
+            connection.close()
+
+    print(f"Serving on {args.listen}")
+    try:
+        listen(args.listen, handler)
+    except KeyboardInterrupt:
+        pass
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Load generator, session recorder and stand-in host for the IPC server")
+    commands = parser.add_subparsers(dest="command", required=True)
+
+    p = commands.add_parser("run", help="send a weighted workload from concurrent clients")
+    p.add_argument("--endpoint", default=DEFAULT_ENDPOINT)
+    p.add_argument("--workload", help="JSON file, defaults to scheduler_stats")
+    p.add_argument("--clients", type=int, default=4)
+    p.add_argument("--requests", type=int, default=1000, help="total across clients, ignored with --duration")
+    p.add_argument("--duration", type=float, help="seconds to run for")
+    p.add_argument("--think-ms", type=float, default=0.0, help="pause between a reply and the next request")
+    p.add_argument("--variants", type=int, default=1, help="distinct payloads generated per workload entry")
+    p.add_argument("--msgpack", action="store_true", help="send MessagePack frames")
+    p.add_argument("--lz4", action="store_true", help="LZ4 compress frames of 1 KiB and more")
+    p.set_defaults(func=run)
+
+    p = commands.add_parser("record", help="proxy clients to the server and log their requests")
+    p.add_argument("--endpoint", default=DEFAULT_ENDPOINT, help="server to forward to")
+    p.add_argument("--listen", required=True, help="endpoint clients connect to instead")
+    p.add_argument("--output", required=True)
+    p.set_defaults(func=record)
+
+    p = commands.add_parser("replay", help="send a recorded session again")
+    p.add_argument("--endpoint", default=DEFAULT_ENDPOINT)
+    p.add_argument("--input", required=True)
+    p.add_argument("--speed", type=float, default=1.0, help="timing scale, 2 replays twice as fast")
+    p.add_argument("--fast", action="store_true", help="ignore recorded timing")
+    p.set_defaults(func=replay)
+
+    p = commands.add_parser("delta", help="execute a new build as a delta against an image the executor holds")
+    p.add_argument("--endpoint", default=DEFAULT_ENDPOINT)
+    p.add_argument("--resource", required=True)
+    p.add_argument("--base", required=True, help="hash of the image the executor already has")
+    p.add_argument("--block-size", type=int, default=2048)
+    p.add_argument("--name", help="name the rebuilt image is stored under")
+    p.add_argument("--msgpack", action="store_true", help="send literals as binary in MessagePack frames")
+    p.add_argument("image")
+    p.set_defaults(func=delta)
+
+    p = commands.add_parser("serve", help="stand-in host that answers every request")
+    p.add_argument("--listen", required=True)
+    p.add_argument("--delay-ms", type=float, default=0.0)
+    p.add_argument("--reply-size", type=int, default=0, help="padding added to each reply")
+    p.set_defaults(func=serve)
+
+    args = parser.parse_args()
+    args.func(args)
+
+
+if __name__ == "__main__":
+    main()
\ No newline at end of file
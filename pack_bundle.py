@@ -0,0 +1,57 @@
+import argparse
+import hashlib
+import os
+import struct
+
+from embed_payloads import CODEC_LZ4, pack_blob
+
+# Packs a script and its libraries into one bundle for execute_bundle (see BundleHeader in bundle.hpp).
+# Load order isn't decided here, the executor sorts the entries by their assembly references.
+
+BUNDLE_MAGIC = 0x42455343
+BUNDLE_VERSION = 1
+HEADER_SIZE = 16
+ENTRY_SIZE = 128
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Packs assemblies (and the .pdb next to each) into a bundle")
+    parser.add_argument("--output", required=True)
+    parser.add_argument("--lz4", action="store_true", help="LZ4 compress the entries")
+    parser.add_argument("assemblies", nargs="+")
+    args = parser.parse_args()
+
+    index = []
+    body = bytearray()
+    base = HEADER_SIZE + ENTRY_SIZE * len(args.assemblies)
+
+    def append(data):
+        blob, codec = pack_blob(data, args.lz4)
+        offset = base + len(body)
+        body.extend(blob)
+        return offset, len(blob), codec
+
+    for path in args.assemblies:
+        with open(path, "rb") as f:
+            image = f.read()
+
+        offset, length, codec = append(image)
+
+        pdb_offset, pdb_length = 0, 0
+        pdb_path = os.path.splitext(path)[0] + ".pdb"
+        if os.path.exists(pdb_path):
+            with open(pdb_path, "rb") as f:
+                pdb_offset, pdb_length, _ = append(f.read())
+
+        name = os.path.splitext(os.path.basename(path))[0].encode()[:63]
+        index.append(struct.pack("<32sQQQQ64s", hashlib.sha256(image).digest(), offset, length, pdb_offset, pdb_length, name))
+        print(f"Added {path}: {len(image)} bytes, {length} stored ({'lz4' if codec == CODEC_LZ4 else 'none'}){', with pdb' if pdb_length else ''}")
+
+    with open(args.output, "wb") as f:
+        f.write(struct.pack("<IHHQ", BUNDLE_MAGIC, BUNDLE_VERSION, len(index), 0))
+        f.write(b"".join(index))
+        f.write(body)
+
+
+if __name__ == "__main__":
+    main()
\ No newline at end of file
@@ -0,0 +1,103 @@
+#include <cse/blob_cache.hpp>
+
+namespace cse
+{
+    BlobCache& BlobCache::GetInstance()
+    {
+        static BlobCache instance;
+        return instance;
+    }
+
+    Hash256 BlobCache::Put(std::span<const uint8_t> data)
+    {
+        Hash256 hash = Sha256::Of(data);
+        Put(hash, data);
+        return hash;
+    }
+
+    void BlobCache::Put(const Hash256& hash, std::span<const uint8_t> data)
+    {
+        {
+            std::lock_guard lock(m_Mutex);
+            auto it = m_Index.find(hash);
+            if (it != m_Index.end())
+            {
+                m_Entries.splice(m_Entries.begin(), m_Entries, it->second);
+                return;
+            }
+        }
+
+        // compress outside the lock, it's the expensive part
+        auto blob = PackBlob(data, Codec::Lz4);
+
+        std::lock_guard lock(m_Mutex);
+        if (m_Index.contains(hash))
+        {
+            return;
+        }
+
+        m_Bytes += blob.size();
+        m_Entries.push_front(Entry{ hash, std::move(blob) });
+        m_Index[hash] = m_Entries.begin();
+
+        Evict();
+    }
+
+    bool BlobCache::Contains(const Hash256& hash)
+    {
+        std::lock_guard lock(m_Mutex);
+        return m_Index.contains(hash);
+    }
+
+    std::optional<std::vector<uint8_t>> BlobCache::Get(const Hash256& hash)
+    {
+        std::lock_guard lock(m_Mutex);
+
+        auto it = m_Index.find(hash);
+        if (it == m_Index.end())
+        {
+            return std::nullopt;
+        }
+
+        m_Entries.splice(m_Entries.begin(), m_Entries, it->second);
+
+        auto payload = UnpackBlob(it->second->m_Blob);
+        if (!payload.has_value())
+        {
+            return std::nullopt;
+        }
+
+        std::vector<uint8_t> data(payload->m_Size);
+        if (!payload->DecodeInto(data))
+        {
+            return std::nullopt;
+        }
+
+        return data;
+    }
+
+    void BlobCache::SetBudget(size_t bytes)
+    {
+        std::lock_guard lock(m_Mutex);
+        m_Budget = bytes;
+        Evict();
+    }
+
+    size_t BlobCache::GetSize()
+    {
+        std::lock_guard lock(m_Mutex);
+        return m_Bytes;
+    }
+
+    void BlobCache::Evict()
+    {
+        // always keep the newest entry, even if it alone exceeds the budget
+        while (m_Bytes > m_Budget && m_Entries.size() > 1)
+        {
+            auto& entry = m_Entries.back();
+            m_Bytes -= entry.m_Blob.size();
+            m_Index.erase(entry.m_Hash);
+            m_Entries.pop_back();
+        }
+    }
+}
\ No newline at end of file
@@ -0,0 +1,206 @@
+#include <cse/bundle.hpp>
+#include <cstddef>
+#include <cstring>
+#include <unordered_map>
+
+namespace cse
+{
+    const char* BundleEntryStatusName(BundleEntryStatus status)
+    {
+        switch (status)
+        {
+        case BundleEntryStatus::Loaded: return "loaded";
+        case BundleEntryStatus::AlreadyLoaded: return "already_loaded";
+        case BundleEntryStatus::Failed: return "failed";
+        case BundleEntryStatus::Skipped: return "skipped";
+        }
+
+        return "unknown";
+    }
+
+    bool IsBundle(std::span<const uint8_t> data)
+    {
+        uint32_t magic = 0;
+        if (data.size() < sizeof(BundleHeader))
+            return false;
+
+        std::memcpy(&magic, data.data(), sizeof(magic));
+        return magic == BundleHeader::MAGIC;
+    }
+
+    static std::optional<std::vector<BundleEntry>> Fail(const char** error, const char* reason)
+    {
+        if (error)
+        {
+            *error = reason;
+        }
+
+        return std::nullopt;
+    }
+
+    std::optional<std::vector<BundleEntry>> ReadBundle(std::span<const uint8_t> data, const char** error)
+    {
+        if (!IsBundle(data))
+            return Fail(error, "not a bundle");
+
+        BundleHeader header;
+        std::memcpy(&header, data.data(), sizeof(header));
+        if (header.m_Version != BundleHeader::VERSION)
+            return Fail(error, "unsupported bundle version");
+
+        size_t indexEnd = sizeof(BundleHeader) + header.m_Count * sizeof(BundleIndexEntry);
+        if (header.m_Count == 0 || indexEnd > data.size())
+            return Fail(error, "truncated bundle index");
+
+        auto inBounds = [&](uint64_t offset, uint64_t length)
+        {
+            return offset >= indexEnd && offset <= data.size() && length <= data.size() - offset;
+        };
+
+        std::vector<BundleEntry> entries;
+        entries.reserve(header.m_Count);
+
+        for (uint16_t i = 0; i < header.m_Count; ++i)
+        {
+            const uint8_t* raw = data.data() + sizeof(BundleHeader) + i * sizeof(BundleIndexEntry);
+
+            BundleIndexEntry index;
+            std::memcpy(&index, raw, sizeof(index));
+
+            if (!inBounds(index.m_Offset, index.m_Length))
+                return Fail(error, "bundle entry outside of the file");
+
+            auto image = UnpackBlob(data.subspan(index.m_Offset, index.m_Length));
+            if (!image.has_value())
+                return Fail(error, "bundle entry is not a packed blob");
+
+            if (!image->HasValidSize())
+                return Fail(error, "bundle entry size is out of range");
+
+            BundleEntry entry;
+            // the name views the bundle itself, not the aligned copy
+            auto* name = reinterpret_cast<const char*>(raw + offsetof(BundleIndexEntry, m_Name));
+            entry.m_Name = std::string_view(name, strnlen(name, sizeof(index.m_Name)));
+            entry.m_Hash = index.m_Hash;
+            entry.m_Image = *image;
+
+            if (index.m_PdbLength > 0)
+            {
+                if (!inBounds(index.m_PdbOffset, index.m_PdbLength))
+                    return Fail(error, "bundle pdb outside of the file");
+
+                entry.m_Pdb = UnpackBlob(data.subspan(index.m_PdbOffset, index.m_PdbLength));
+                if (!entry.m_Pdb.has_value())
+                    return Fail(error, "bundle pdb is not a packed blob");
+
+                if (!entry.m_Pdb->HasValidSize())
+                    return Fail(error, "bundle pdb size is out of range");
+            }
+
+            entries.push_back(std::move(entry));
+        }
+
+        return entries;
+    }
+
+    std::vector<uint8_t> WriteBundle(std::span<const BundleInput> inputs, Codec codec)
+    {
+        BundleHeader header{};
+        header.m_Magic = BundleHeader::MAGIC;
+        header.m_Version = BundleHeader::VERSION;
+        header.m_Count = static_cast<uint16_t>(inputs.size());
+
+        std::vector<BundleIndexEntry> index(inputs.size());
+        std::vector<uint8_t> body;
+        uint64_t base = sizeof(BundleHeader) + inputs.size() * sizeof(BundleIndexEntry);
+
+        auto append = [&](std::span<const uint8_t> data, uint64_t& offset, uint64_t& length)
+        {
+            auto blob = PackBlob(data, codec);
+            offset = base + body.size();
+            length = blob.size();
+            body.insert(body.end(), blob.begin(), blob.end());
+        };
+
+        for (size_t i = 0; i < inputs.size(); ++i)
+        {
+            const auto& input = inputs[i];
+            auto& entry = index[i];
+
+            entry.m_Hash = Sha256::Of(input.m_Image);
+            std::strncpy(entry.m_Name, input.m_Name.c_str(), sizeof(entry.m_Name) - 1);
+
+            append(input.m_Image, entry.m_Offset, entry.m_Length);
+            if (!input.m_Pdb.empty())
+            {
+                append(input.m_Pdb, entry.m_PdbOffset, entry.m_PdbLength);
+            }
+        }
+
+        std::vector<uint8_t> bundle(base + body.size());
+        std::memcpy(bundle.data(), &header, sizeof(header));
+        if (!index.empty())
+        {
+            std::memcpy(bundle.data() + sizeof(header), index.data(), index.size() * sizeof(BundleIndexEntry));
+        }
+
+        if (!body.empty())
+        {
+            std::memcpy(bundle.data() + base, body.data(), body.size());
+        }
+
+        return bundle;
+    }
+
+    std::optional<std::vector<size_t>> OrderByReferences(std::span<const AssemblyMetadata> assemblies)
+    {
+        std::unordered_map<std::string_view, size_t> byName;
+        for (size_t i = 0; i < assemblies.size(); ++i)
+        {
+            byName.emplace(assemblies[i].m_Name, i);
+        }
+
+        // Kahn's algorithm, always taking the lowest ready index so the input order breaks ties
+        std::vector<size_t> pending(assemblies.size(), 0);
+        std::vector<std::vector<size_t>> dependents(assemblies.size());
+
+        for (size_t i = 0; i < assemblies.size(); ++i)
+        {
+            for (const auto& reference : assemblies[i].m_References)
+            {
+                auto it = byName.find(reference.m_Name);
+                if (it != byName.end() && it->second != i)
+                {
+                    pending[i]++;
+                    dependents[it->second].push_back(i);
+                }
+            }
+        }
+
+        std::vector<size_t> order;
+        order.reserve(assemblies.size());
+
+        std::vector<bool> done(assemblies.size(), false);
+        while (order.size() < assemblies.size())
+        {
+            size_t index = 0;
+            while (index < assemblies.size() && (done[index] || pending[index] != 0))
+            {
+                index++;
+            }
+
+            if (index == assemblies.size())
+                return std::nullopt;
+
+            done[index] = true;
+            order.push_back(index);
+
+            for (size_t dependent : dependents[index])
+            {
+                pending[dependent]--;
+            }
+        }
+
+        return order;
+    }
+}
\ No newline at end of file
@@ -0,0 +1,511 @@
+#include <cse/capture.hpp>
+#include <cse/flow.hpp>
+#include <cse/managed_method.hpp>
+#include <cse/log.hpp>
+#include <cse/ring.hpp>
+#include <cse/utf8.hpp>
+#include <algorithm>
+#include <atomic>
+#include <cstring>
+#include <mutex>
+#include <thread>
+#include <Windows.h>
+
+namespace cse
+{
+    namespace
+    {
+        // bytes per ReadFile, one chunk never holds more
+        constexpr size_t CHUNK_BYTES = 4096;
+
+        // pipe buffer, writers block once the drain thread falls this far behind
+        constexpr DWORD PIPE_BYTES = 64 * 1024;
+
+        // System.IO.FileAccess.Write
+        constexpr int32_t FILE_ACCESS_WRITE = 2;
+
+        struct ChunkHeader
+        {
+            // UTF-16 bytes after the header
+            uint32_t m_Length;
+            uint32_t m_Stream;
+
+            uint64_t m_Sequence;
+            uint64_t m_Timestamp;
+            uint64_t m_Execution;
+
+            // id of the hook that drained it, indexes the resource names
+            uint32_t m_Hook;
+            uint32_t m_Reserved;
+        };
+        static_assert(sizeof(ChunkHeader) == 40);
+
+        struct Pipe
+        {
+            HANDLE m_Read = nullptr;
+            HANDLE m_Write = nullptr;
+            std::thread m_Drain;
+        };
+
+        struct DomainHook
+        {
+            // the pointer is reused by later domains, the id isn't
+            MonoDomain* m_Domain = nullptr;
+            int32_t m_DomainId = -1;
+            std::string m_Resource;
+            uint32_t m_Id = 0;
+
+            std::atomic<uint64_t> m_Execution{ 0 };
+
+            Pipe m_Pipes[2];
+
+            // writers the domain had before, handed back when capture is turned off
+            uint32_t m_OriginalOut = 0;
+            uint32_t m_OriginalError = 0;
+        };
+
+        MonoMethod* FindMethod(MonoClass* klass, const char* description)
+        {
+            static auto& methods = MonoMethods::GetInstance();
+
+            MonoMethodDesc* desc = methods.method_desc_new(description, 1);
+            if (!desc)
+            {
+                return nullptr;
+            }
+
+            MonoMethod* method = klass ? methods.method_desc_search_in_class(desc, klass) : nullptr;
+            methods.method_desc_free(desc);
+            return method;
+        }
+    }
+
+    const char* OutputStreamName(OutputStream stream)
+    {
+        switch (stream)
+        {
+        case OutputStream::Out: return "out";
+        case OutputStream::Error: return "error";
+        }
+
+        return "unknown";
+    }
+
+    struct OutputCapture::Impl
+    {
+        std::mutex m_Mutex;
+        bool m_Enabled = false;
+
+        RecordRing<RING_CAPACITY> m_Ring;
+        std::optional<std::chrono::steady_clock::time_point> m_Started;
+        std::atomic<uint64_t> m_Sequence{ 0 };
+        std::atomic<uint64_t> m_Chunks{ 0 };
+        std::atomic<uint64_t> m_Bytes{ 0 };
+
+        // hooked domains, removed when turned off or when their domain is unloaded
+        std::vector<std::unique_ptr<DomainHook>> m_Hooks;
+
+        // resource names by hook id, kept for the chunks still in the ring
+        std::vector<std::string> m_Resources;
+
+        DomainHook* Find(int32_t domainId)
+        {
+            for (auto& hook : m_Hooks)
+            {
+                if (hook->m_DomainId == domainId)
+                {
+                    return hook.get();
+                }
+            }
+
+            return nullptr;
+        }
+
+        void Append(const DomainHook& hook, OutputStream stream, const uint8_t* text, size_t length)
+        {
+            m_Ring.Append(sizeof(ChunkHeader) + length, [&](uint8_t* body)
+            {
+                auto* header = reinterpret_cast<ChunkHeader*>(body);
+                header->m_Length = static_cast<uint32_t>(length);
+                header->m_Stream = static_cast<uint32_t>(stream);
+                header->m_Sequence = m_Sequence.fetch_add(1, std::memory_order_relaxed);
+                header->m_Timestamp = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - *m_Started).count();
+                header->m_Execution = hook.m_Execution.load(std::memory_order_relaxed);
+                header->m_Hook = hook.m_Id;
+                std::memcpy(body + sizeof(ChunkHeader), text, length);
+            });
+
+            m_Chunks.fetch_add(1, std::memory_order_relaxed);
+            m_Bytes.fetch_add(length, std::memory_order_relaxed);
+        }
+
+        void Drain(DomainHook* hook, HANDLE pipe, OutputStream stream)
+        {
+            uint8_t buffer[CHUNK_BYTES];
+            size_t carried = 0;
+            DWORD read = 0;
+
+            while (ReadFile(pipe, buffer + carried, static_cast<DWORD>(sizeof(buffer) - carried), &read, nullptr) && read)
+            {
+                size_t total = carried + read;
+
+                // whole UTF-16 units only, and a trailing high surrogate waits for its pair
+                size_t complete = total & ~size_t(1);
+                if (complete >= 2)
+                {
+                    uint16_t last;
+                    std::memcpy(&last, buffer + complete - 2, sizeof(last));
+                    if (last >= 0xD800 && last <= 0xDBFF && complete < sizeof(buffer))
+                    {
+                        complete -= 2;
+                    }
+                }
+
+                if (complete > 0)
+                {
+                    Append(*hook, stream, buffer, complete);
+                }
+
+                carried = total - complete;
+                std::memmove(buffer, buffer + complete, carried);
+            }
+        }
+
+        // Console writers replaced with StreamWriter(new FileStream(pipe, FileAccess.Write, false), new UnicodeEncoding(false, false))
+        bool Hook(DomainHook& hook)
+        {
+            static auto& methods = MonoMethods::GetInstance();
+            static MonoImage* corlib = methods.get_corlib();
+            static MonoClass* consoleClass = methods.class_from_name(corlib, "System", "Console");
+            static MonoClass* fileStreamClass = methods.class_from_name(corlib, "System.IO", "FileStream");
+            static MonoClass* streamWriterClass = methods.class_from_name(corlib, "System.IO", "StreamWriter");
+            static MonoClass* encodingClass = methods.class_from_name(corlib, "System.Text", "UnicodeEncoding");
+
+            static MonoMethod* fileStreamCtor = FindMethod(fileStreamClass, ":.ctor(intptr,System.IO.FileAccess,bool)");
+            static MonoMethod* streamWriterCtor = FindMethod(streamWriterClass, ":.ctor(System.IO.Stream,System.Text.Encoding)");
+            static MonoMethod* encodingCtor = FindMethod(encodingClass, ":.ctor(bool,bool)");
+
+            if (!fileStreamCtor || !streamWriterCtor || !encodingCtor)
+            {
+                log_error("[Capture] Failed to resolve the writer constructors");
+                return false;
+            }
+
+            MonoDomain* domain = hook.m_Domain;
+
+            // thunks are per domain
+            auto getOut = ManagedMethod<MonoObject*()>::Resolve(domain, consoleClass, "get_Out");
+            auto getError = ManagedMethod<MonoObject*()>::Resolve(domain, consoleClass, "get_Error");
+            auto setOut = ManagedMethod<void(MonoObject*)>::Resolve(domain, consoleClass, "SetOut");
+            auto setError = ManagedMethod<void(MonoObject*)>::Resolve(domain, consoleClass, "SetError");
+            auto setAutoFlush = ManagedMethod<void(bool)>::Resolve(domain, streamWriterClass, "set_AutoFlush");
+            ManagedMethod<void(intptr_t, int32_t, bool)> newFileStream(domain, fileStreamCtor);
+            ManagedMethod<void(MonoObject*, MonoObject*)> newStreamWriter(domain, streamWriterCtor);
+            ManagedMethod<void(bool, bool)> newEncoding(domain, encodingCtor);
+
+            auto createWriter = [&](HANDLE pipe) -> MonoObject*
+            {
+                MonoObject* encoding = methods.object_new(domain, encodingClass);
+                MonoObject* stream = methods.object_new(domain, fileStreamClass);
+                MonoObject* writer = methods.object_new(domain, streamWriterClass);
+                if (!encoding || !stream || !writer)
+                {
+                    return nullptr;
+                }
+
+                // little endian, no BOM
+                if (!newEncoding.Invoke(encoding, false, false) ||
+                    !newFileStream.Invoke(stream, reinterpret_cast<intptr_t>(pipe), FILE_ACCESS_WRITE, false) ||
+                    !newStreamWriter.Invoke(writer, stream, encoding) ||
+                    !setAutoFlush.Invoke(writer, true))
+                {
+                    return nullptr;
+                }
+
+                return writer;
+            };
+
+            for (auto& pipe : hook.m_Pipes)
+            {
+                if (!CreatePipe(&pipe.m_Read, &pipe.m_Write, nullptr, PIPE_BYTES))
+                {
+                    log_error("[Capture] CreatePipe failed: %lu", GetLastError());
+                    ClosePipes(hook);
+                    return false;
+                }
+            }
+
+            auto originalOut = getOut();
+            auto originalError = getError();
+            MonoObject* out = createWriter(hook.m_Pipes[0].m_Write);
+            MonoObject* error = createWriter(hook.m_Pipes[1].m_Write);
+            if (!originalOut || !originalError || !out || !error)
+            {
+                log_error("[Capture] Failed to create the capturing writers in %s", hook.m_Resource);
+                ClosePipes(hook);
+                return false;
+            }
+
+            hook.m_OriginalOut = *originalOut ? methods.gchandle_new(*originalOut, 0) : 0;
+            hook.m_OriginalError = *originalError ? methods.gchandle_new(*originalError, 0) : 0;
+
+            for (size_t i = 0; i < std::size(hook.m_Pipes); ++i)
+            {
+                hook.m_Pipes[i].m_Drain = std::thread([this, hook = &hook, pipe = hook.m_Pipes[i].m_Read, i]()
+                {
+                    Drain(hook, pipe, static_cast<OutputStream>(i));
+                });
+            }
+
+            if (!setOut(out) || !setError(error))
+            {
+                log_error("[Capture] Failed to replace the console writers in %s", hook.m_Resource);
+                Unhook(hook);
+                return false;
+            }
+
+            log_info("[Capture] Capturing console output of %s", hook.m_Resource);
+            return true;
+        }
+
+        // gives the domain its writers back if it is still loaded, the pipes are closed either way
+        void Unhook(DomainHook& hook)
+        {
+            static auto& methods = MonoMethods::GetInstance();
+            static MonoClass* consoleClass = methods.class_from_name(methods.get_corlib(), "System", "Console");
+
+            auto domains = EnumerateDomains();
+            bool loaded = std::ranges::find(domains, hook.m_Domain) != domains.end() && methods.domain_get_id(hook.m_Domain) == hook.m_DomainId;
+
+            if (loaded)
+            {
+                MonoScope scope(hook.m_Domain);
+                auto setOut = ManagedMethod<void(MonoObject*)>::Resolve(hook.m_Domain, consoleClass, "SetOut");
+                auto setError = ManagedMethod<void(MonoObject*)>::Resolve(hook.m_Domain, consoleClass, "SetError");
+
+                if (hook.m_OriginalOut)
+                {
+                    setOut(methods.gchandle_get_target(hook.m_OriginalOut));
+                    methods.gchandle_free(hook.m_OriginalOut);
+                }
+
+                if (hook.m_OriginalError)
+                {
+                    setError(methods.gchandle_get_target(hook.m_OriginalError));
+                    methods.gchandle_free(hook.m_OriginalError);
+                }
+            }
+            else
+            {
+                // the handle slots outlive the domain, only their targets went with it
+                for (uint32_t handle : { hook.m_OriginalOut, hook.m_OriginalError })
+                {
+                    if (handle)
+                    {
+                        methods.gchandle_free(handle);
+                    }
+                }
+            }
+
+            hook.m_OriginalOut = 0;
+            hook.m_OriginalError = 0;
+
+            ClosePipes(hook);
+        }
+
+        // the managed streams don't own the write ends, closing them here ends the drain threads
+        static void ClosePipes(DomainHook& hook)
+        {
+            for (auto& pipe : hook.m_Pipes)
+            {
+                if (pipe.m_Write)
+                {
+                    CloseHandle(pipe.m_Write);
+                    pipe.m_Write = nullptr;
+                }
+
+                if (pipe.m_Drain.joinable())
+                {
+                    pipe.m_Drain.join();
+                }
+
+                if (pipe.m_Read)
+                {
+                    CloseHandle(pipe.m_Read);
+                    pipe.m_Read = nullptr;
+                }
+            }
+        }
+    };
+
+    OutputCapture& OutputCapture::GetInstance()
+    {
+        static OutputCapture instance;
+        return instance;
+    }
+
+    OutputCapture::OutputCapture()
+        : m_Impl(std::make_unique<Impl>())
+    {
+    }
+
+    OutputCapture::~OutputCapture() = default;
+
+    void OutputCapture::SetEnabled(bool enabled)
+    {
+        std::lock_guard lock(m_Impl->m_Mutex);
+        if (enabled == m_Impl->m_Enabled)
+        {
+            return;
+        }
+
+        m_Impl->m_Enabled = enabled;
+        if (enabled)
+        {
+            if (!m_Impl->m_Started)
+            {
+                m_Impl->m_Ring.Allocate();
+                m_Impl->m_Started = std::chrono::steady_clock::now();
+            }
+
+            return;
+        }
+
+        for (auto& hook : m_Impl->m_Hooks)
+        {
+            m_Impl->Unhook(*hook);
+        }
+
+        m_Impl->m_Hooks.clear();
+    }
+
+    bool OutputCapture::IsEnabled()
+    {
+        std::lock_guard lock(m_Impl->m_Mutex);
+        return m_Impl->m_Enabled;
+    }
+
+    void OutputCapture::Attach(MonoDomain* domain, uint64_t execution, const std::string& resource)
+    {
+        std::lock_guard lock(m_Impl->m_Mutex);
+        if (!m_Impl->m_Enabled)
+        {
+            return;
+        }
+
+        static auto& methods = MonoMethods::GetInstance();
+
+        int32_t domainId = methods.domain_get_id(domain);
+        if (DomainHook* hook = m_Impl->Find(domainId))
+        {
+            hook->m_Execution.store(execution, std::memory_order_relaxed);
+            return;
+        }
+
+        auto hook = std::make_unique<DomainHook>();
+        hook->m_Domain = domain;
+        hook->m_DomainId = domainId;
+        hook->m_Resource = resource;
+        hook->m_Id = static_cast<uint32_t>(m_Impl->m_Resources.size());
+
+        // set before hooking, output written while the writers are swapped already belongs to this execution
+        hook->m_Execution.store(execution, std::memory_order_relaxed);
+
+        // a failed hook is tried again on the next execution
+        if (m_Impl->Hook(*hook))
+        {
+            m_Impl->m_Resources.push_back(resource);
+            m_Impl->m_Hooks.push_back(std::move(hook));
+        }
+    }
+
+    void OutputCapture::Detach(int32_t domainId)
+    {
+        std::lock_guard lock(m_Impl->m_Mutex);
+
+        auto it = std::ranges::find_if(m_Impl->m_Hooks, [&](const auto& hook) { return hook->m_DomainId == domainId; });
+        if (it == m_Impl->m_Hooks.end())
+        {
+            return;
+        }
+
+        m_Impl->Unhook(**it);
+        m_Impl->m_Hooks.erase(it);
+    }
+
+    CaptureBatch OutputCapture::Read(uint64_t cursor, size_t maxBytes, const CaptureFilter& filter, std::chrono::milliseconds wait)
+    {
+        auto& ring = m_Impl->m_Ring;
+
+        CaptureBatch batch;
+        batch.m_Cursor = cursor;
+
+        {
+            std::lock_guard lock(m_Impl->m_Mutex);
+            if (!m_Impl->m_Started)
+            {
+                return batch;
+            }
+        }
+
+        ring.Wait(cursor, wait);
+
+        // copied so the ring is read without holding the lock
+        std::vector<std::string> resources;
+        {
+            std::lock_guard lock(m_Impl->m_Mutex);
+            resources = m_Impl->m_Resources;
+        }
+
+        batch.m_Skipped += ring.Read(cursor, maxBytes, batch.m_Chunks, [&](const uint8_t* body, size_t length) -> std::optional<CapturedChunk>
+        {
+            ChunkHeader header;
+            std::memcpy(&header, body, sizeof(header));
+
+            if (sizeof(ChunkHeader) + uint64_t(header.m_Length) > length || header.m_Hook >= resources.size())
+            {
+                return std::nullopt;
+            }
+
+            if (filter.m_Execution && header.m_Execution != filter.m_Execution)
+            {
+                return std::nullopt;
+            }
+
+            const std::string& resource = resources[header.m_Hook];
+            if (!filter.m_Resource.empty() && resource != filter.m_Resource)
+            {
+                return std::nullopt;
+            }
+
+            CapturedChunk chunk;
+            chunk.m_Sequence = header.m_Sequence;
+            chunk.m_Timestamp = header.m_Timestamp;
+            chunk.m_Execution = header.m_Execution;
+            chunk.m_Resource = resource;
+            chunk.m_Stream = static_cast<OutputStream>(header.m_Stream);
+
+            // the chunk may be unaligned for uint16_t, copy the units out first
+            std::vector<uint16_t> units(header.m_Length / sizeof(uint16_t));
+            std::memcpy(units.data(), body + sizeof(ChunkHeader), units.size() * sizeof(uint16_t));
+            AppendUtf8(chunk.m_Text, units);
+            return chunk;
+        });
+
+        batch.m_Cursor = cursor;
+        return batch;
+    }
+
+    CaptureStats OutputCapture::GetStats()
+    {
+        std::lock_guard lock(m_Impl->m_Mutex);
+
+        CaptureStats stats;
+        stats.m_Enabled = m_Impl->m_Enabled;
+        stats.m_Domains = m_Impl->m_Hooks.size();
+        stats.m_Chunks = m_Impl->m_Chunks.load(std::memory_order_relaxed);
+        stats.m_Bytes = m_Impl->m_Bytes.load(std::memory_order_relaxed);
+        stats.m_Written = m_Impl->m_Ring.GetWritten();
+        return stats;
+    }
+}
\ No newline at end of file
@@ -0,0 +1,268 @@
+#include <cse/commands.hpp>
+#include <cse/console.hpp>
+#include <unordered_map>
+#include <map>
+#include <mutex>
+#include <condition_variable>
+#include <future>
+
+namespace cse
+{
+    struct CommandRegistry::Impl
+    {
+        struct Command
+        {
+            std::string m_Name;
+            CommandPolicy m_Policy;
+            CommandHandler m_Handler;
+
+            uint32_t m_Running = 0;
+        };
+
+        enum class TaskState : uint8_t
+        {
+            Queued,
+            Running,
+            Withdrawn,
+        };
+
+        std::unordered_map<uint32_t, Command> m_Commands;
+
+        std::mutex m_Mutex;
+        std::condition_variable m_SlotReleased;
+
+        // replies of commands still running when their caller timed out, by pending id until polled, oldest dropped first
+        std::map<uint64_t, std::shared_future<nlohmann::json>> m_Pending;
+        uint64_t m_NextPending = 1;
+
+        static inline thread_local uint64_t s_CurrentClient = 0;
+
+        bool AcquireSlot(Command& command, std::chrono::steady_clock::time_point deadline)
+        {
+            if (command.m_Policy.m_MaxConcurrency == 0)
+            {
+                return true;
+            }
+
+            std::unique_lock lock(m_Mutex);
+            auto available = [&] { return command.m_Running < command.m_Policy.m_MaxConcurrency; };
+
+            if (deadline == std::chrono::steady_clock::time_point::max())
+            {
+                m_SlotReleased.wait(lock, available);
+            }
+            else if (!m_SlotReleased.wait_until(lock, deadline, available))
+            {
+                return false;
+            }
+
+            command.m_Running++;
+            return true;
+        }
+
+        void ReleaseSlot(Command& command)
+        {
+            if (command.m_Policy.m_MaxConcurrency == 0)
+            {
+                return;
+            }
+
+            {
+                std::lock_guard lock(m_Mutex);
+                command.m_Running--;
+            }
+
+            m_SlotReleased.notify_all();
+        }
+
+        static nlohmann::json Invoke(const Command& command, const nlohmann::json& request, uint64_t clientId)
+        {
+            uint64_t previousClient = s_CurrentClient;
+            s_CurrentClient = clientId;
+
+            nlohmann::json response;
+            try
+            {
+                response = command.m_Handler(request);
+            }
+            catch (std::exception& e)
+            {
+                println("[IPC] Exception in %s: %s", command.m_Name.c_str(), e.what());
+                response = { { "error", e.what() } };
+            }
+
+            s_CurrentClient = previousClient;
+            return response;
+        }
+    };
+
+    CommandRegistry& CommandRegistry::GetInstance()
+    {
+        static CommandRegistry instance;
+        return instance;
+    }
+
+    CommandRegistry::CommandRegistry()
+        : m_Impl(std::make_unique<Impl>())
+    {
+    }
+
+    CommandRegistry::~CommandRegistry() = default;
+
+    void CommandRegistry::RegisterHandler(CommandId id, CommandPolicy policy, CommandHandler handler)
+    {
+        auto it = m_Impl->m_Commands.find(id.m_Hash);
+        if (it != m_Impl->m_Commands.end())
+        {
+            println("[IPC] Command %.*s collides with %s, ignoring!", (int)id.m_Name.size(), id.m_Name.data(), it->second.m_Name.c_str());
+            return;
+        }
+
+        Impl::Command command;
+        command.m_Name = std::string(id.m_Name);
+        command.m_Policy = policy;
+        command.m_Handler = std::move(handler);
+
+        m_Impl->m_Commands.emplace(id.m_Hash, std::move(command));
+    }
+
+    uint64_t CommandRegistry::CurrentClientId()
+    {
+        return Impl::s_CurrentClient;
+    }
+
+    nlohmann::json CommandRegistry::Dispatch(const nlohmann::json& request, uint64_t clientId)
+    {
+        auto cmdIt = request.find("cmd");
+        if (cmdIt == request.end() || !cmdIt->is_string())
+        {
+            return { { "error", "missing cmd" } };
+        }
+
+        const auto& name = cmdIt->get_ref<const std::string&>();
+
+        auto it = m_Impl->m_Commands.find(HashCommandName(name));
+        if (it == m_Impl->m_Commands.end() || it->second.m_Name != name)
+        {
+            println("[IPC] Unknown command: %s", name.c_str());
+            return { { "error", "unknown command" } };
+        }
+
+        auto& command = it->second;
+        const auto& policy = command.m_Policy;
+
+        auto deadline = std::chrono::steady_clock::time_point::max();
+        if (policy.m_Timeout.count() > 0)
+        {
+            deadline = std::chrono::steady_clock::now() + policy.m_Timeout;
+        }
+
+        if (!m_Impl->AcquireSlot(command, deadline))
+        {
+            return { { "error", "busy" } };
+        }
+
+        if (policy.m_Policy == ExecutionPolicy::Inline)
+        {
+            auto response = Impl::Invoke(command, request, clientId);
+            m_Impl->ReleaseSlot(command);
+            return response;
+        }
+
+        auto state = std::make_shared<std::atomic<Impl::TaskState>>(Impl::TaskState::Queued);
+        auto task = std::make_shared<std::packaged_task<nlohmann::json()>>([this, &command, request, clientId, state]() -> nlohmann::json
+        {
+            // withdrawn by a caller that timed out, its slot is already released
+            auto queued = Impl::TaskState::Queued;
+            if (!state->compare_exchange_strong(queued, Impl::TaskState::Running))
+            {
+                return {};
+            }
+
+            auto response = Impl::Invoke(command, request, clientId);
+            m_Impl->ReleaseSlot(command);
+            return response;
+        });
+
+        auto future = task->get_future();
+
+        static auto& scheduler = Scheduler::GetInstance();
+
+        std::string serialKey;
+        if (policy.m_Policy == ExecutionPolicy::DomainQueue)
+        {
+            // a missing or mistyped key shares one queue, the handler's own decoding reports it
+            auto key = request.find(policy.m_QueueKey);
+            serialKey = DomainQueueKey(key != request.end() && key->is_string() ? key->get_ref<const std::string&>() : std::string_view());
+        }
+
+        bool posted = scheduler.Submit([task] { (*task)(); }, policy.m_Priority, clientId, serialKey);
+
+        if (!posted)
+        {
+            m_Impl->ReleaseSlot(command);
+            return { { "error", "shutting down" } };
+        }
+
+        if (policy.m_Timeout.count() > 0 && future.wait_until(deadline) == std::future_status::timeout)
+        {
+            // still queued, it never runs so a retry can't run it twice
+            auto queued = Impl::TaskState::Queued;
+            if (state->compare_exchange_strong(queued, Impl::TaskState::Withdrawn))
+            {
+                m_Impl->ReleaseSlot(command);
+                println("[IPC] Command %s timed out in the queue, withdrawn", command.m_Name.c_str());
+                return { { "error", "timeout" } };
+            }
+
+            // already running, it can't be stopped and its reply is kept for command_result
+            uint64_t id;
+            {
+                std::lock_guard lock(m_Impl->m_Mutex);
+                id = m_Impl->m_NextPending++;
+                m_Impl->m_Pending.emplace(id, future.share());
+                if (m_Impl->m_Pending.size() > MAX_PENDING)
+                {
+                    m_Impl->m_Pending.erase(m_Impl->m_Pending.begin());
+                }
+            }
+
+            println("[IPC] Command %s is still running after its timeout, pending %llu", command.m_Name.c_str(), (unsigned long long)id);
+            return { { "status", "running" }, { "pending", id } };
+        }
+
+        return future.get();
+    }
+
+    nlohmann::json CommandRegistry::PollPending(uint64_t id)
+    {
+        std::shared_future<nlohmann::json> future;
+        {
+            std::lock_guard lock(m_Impl->m_Mutex);
+            auto it = m_Impl->m_Pending.find(id);
+            if (it == m_Impl->m_Pending.end())
+            {
+                return { { "error", "unknown pending id" } };
+            }
+
+            future = it->second;
+        }
+
+        if (future.wait_for(std::chrono::seconds(0)) != std::future_status::ready)
+        {
+            return { { "status", "running" }, { "pending", id } };
+        }
+
+        {
+            std::lock_guard lock(m_Impl->m_Mutex);
+            m_Impl->m_Pending.erase(id);
+        }
+
+        return future.get();
+    }
+
+    void CommandRegistry::Shutdown()
+    {
+        Scheduler::GetInstance().Shutdown();
+    }
+}
\ No newline at end of file
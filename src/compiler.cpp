@@ -0,0 +1,403 @@
+#include <cse/compiler.hpp>
+#include <cse/log.hpp>
+#include <algorithm>
+#include <cctype>
+#include <cwctype>
+#include <fstream>
+#include <thread>
+#include <Windows.h>
+
+namespace cse
+{
+    namespace
+    {
+        // compiler diagnostics beyond this are cut, a broken snippet can produce thousands of errors
+        constexpr size_t MAX_OUTPUT = 64 * 1024;
+
+        // length prefixed so "ab" + "c" and "a" + "bc" hash differently
+        void HashField(Sha256& hasher, std::string_view value)
+        {
+            uint64_t length = value.size();
+            hasher.Update({ reinterpret_cast<const uint8_t*>(&length), sizeof(length) });
+            hasher.Update({ reinterpret_cast<const uint8_t*>(value.data()), value.size() });
+        }
+
+        // a reference rebuilt in place has to invalidate everything compiled against it
+        void HashReference(Sha256& hasher, const std::string& reference)
+        {
+            HashField(hasher, reference);
+
+            std::error_code ec;
+            uint64_t stamp[2] = { std::filesystem::file_size(reference, ec), 0 };
+            if (!ec)
+            {
+                stamp[1] = static_cast<uint64_t>(std::filesystem::last_write_time(reference, ec).time_since_epoch().count());
+            }
+
+            hasher.Update({ reinterpret_cast<const uint8_t*>(stamp), sizeof(stamp) });
+        }
+
+        std::string Quote(const std::string& argument)
+        {
+            return "\"" + argument + "\"";
+        }
+
+        // what a request may add, switches naming inputs or outputs (/out:, /target:, /pdb:, @file, ...) stay ours
+        constexpr std::string_view ALLOWED_ARGUMENTS[] = {
+            "optimize", "define:", "d:", "warn:", "nowarn:", "warnaserror", "unsafe", "checked",
+            "langversion:", "nullable", "platform:", "deterministic",
+        };
+
+        bool IsAllowedArgument(std::string_view argument)
+        {
+            // every argument is one line of the response file, a line break would start another switch
+            if (argument.size() < 2 || (argument[0] != '/' && argument[0] != '-') || argument.find_first_of("\r\n") != std::string_view::npos)
+            {
+                return false;
+            }
+
+            std::string name(argument.substr(1));
+            std::transform(name.begin(), name.end(), name.begin(), [](unsigned char c) { return static_cast<char>(std::tolower(c)); });
+
+            return std::any_of(std::begin(ALLOWED_ARGUMENTS), std::end(ALLOWED_ARGUMENTS), [&](std::string_view allowed)
+            {
+                if (allowed.ends_with(':'))
+                {
+                    return name.starts_with(allowed);
+                }
+
+                // /unsafe, /unsafe+, /unsafe-, /nullable:enable
+                std::string_view rest = std::string_view(name).substr(std::min(name.size(), allowed.size()));
+                return name.starts_with(allowed) && (rest.empty() || rest == "+" || rest == "-" || rest.starts_with(':') || rest.starts_with("+:") || rest.starts_with("-:"));
+            });
+        }
+
+        // quoted into the response file, a quote or line break would end the path early
+        bool IsValidReference(std::string_view reference)
+        {
+            return !reference.empty() && reference.find_first_of("\"\r\n") == std::string_view::npos;
+        }
+
+        // the .NET Framework csc (C# 5) only writes Windows PDBs, /debug:portable makes it fail
+        bool IsFrameworkCompiler(const std::filesystem::path& compiler)
+        {
+            auto framework = compiler.parent_path().parent_path().filename().wstring();
+            std::transform(framework.begin(), framework.end(), framework.begin(), [](wchar_t c) { return static_cast<wchar_t>(std::towlower(c)); });
+            return framework == L"framework" || framework == L"framework64";
+        }
+
+        std::filesystem::path DefaultCompiler()
+        {
+            wchar_t windows[MAX_PATH] = {};
+            if (!GetWindowsDirectoryW(windows, MAX_PATH))
+            {
+                return {};
+            }
+
+            // csc ships with every .NET Framework 4 install
+            for (const wchar_t* framework : { L"Microsoft.NET\\Framework64\\v4.0.30319\\csc.exe", L"Microsoft.NET\\Framework\\v4.0.30319\\csc.exe" })
+            {
+                auto candidate = std::filesystem::path(windows) / framework;
+                if (std::filesystem::exists(candidate))
+                {
+                    return candidate;
+                }
+            }
+
+            return {};
+        }
+
+        struct ProcessResult
+        {
+            bool m_Started = false;
+            bool m_TimedOut = false;
+            DWORD m_ExitCode = 0;
+            std::string m_Output;
+        };
+
+        // runs commandLine with stdout and stderr captured, killed once timeout passes
+        ProcessResult RunProcess(std::wstring commandLine, const std::filesystem::path& directory, std::chrono::milliseconds timeout)
+        {
+            ProcessResult result;
+
+            SECURITY_ATTRIBUTES attributes = { sizeof(attributes), nullptr, TRUE };
+            HANDLE readPipe = nullptr;
+            HANDLE writePipe = nullptr;
+            if (!CreatePipe(&readPipe, &writePipe, &attributes, 0))
+            {
+                return result;
+            }
+
+            // only the write end goes to the child
+            SetHandleInformation(readPipe, HANDLE_FLAG_INHERIT, 0);
+
+            STARTUPINFOW startup = {};
+            startup.cb = sizeof(startup);
+            startup.dwFlags = STARTF_USESTDHANDLES;
+            startup.hStdOutput = writePipe;
+            startup.hStdError = writePipe;
+            startup.hStdInput = nullptr;
+
+            PROCESS_INFORMATION process = {};
+            std::wstring workingDirectory = directory.wstring();
+            result.m_Started = CreateProcessW(nullptr, commandLine.data(), nullptr, nullptr, TRUE, CREATE_NO_WINDOW,
+                nullptr, workingDirectory.c_str(), &startup, &process) != FALSE;
+
+            // our copy of the write end has to go, otherwise the reader never sees the end of the pipe
+            CloseHandle(writePipe);
+
+            if (!result.m_Started)
+            {
+                CloseHandle(readPipe);
+                return result;
+            }
+
+            // drained on its own thread, a compiler blocked on a full pipe would never exit
+            std::thread reader([&]()
+            {
+                char buffer[4096];
+                DWORD read = 0;
+                while (ReadFile(readPipe, buffer, sizeof(buffer), &read, nullptr) && read)
+                {
+                    if (result.m_Output.size() < MAX_OUTPUT)
+                    {
+                        result.m_Output.append(buffer, std::min<size_t>(read, MAX_OUTPUT - result.m_Output.size()));
+                    }
+                }
+            });
+
+            if (WaitForSingleObject(process.hProcess, static_cast<DWORD>(timeout.count())) != WAIT_OBJECT_0)
+            {
+                result.m_TimedOut = true;
+                TerminateProcess(process.hProcess, 1);
+                WaitForSingleObject(process.hProcess, INFINITE);
+            }
+
+            reader.join();
+
+            GetExitCodeProcess(process.hProcess, &result.m_ExitCode);
+            CloseHandle(process.hThread);
+            CloseHandle(process.hProcess);
+            CloseHandle(readPipe);
+            return result;
+        }
+    }
+
+    SourceCompiler& SourceCompiler::GetInstance()
+    {
+        static SourceCompiler instance;
+        return instance;
+    }
+
+    void SourceCompiler::SetOptions(CompilerOptions options)
+    {
+        std::lock_guard lock(m_Mutex);
+        m_Options = std::move(options);
+    }
+
+    CompilerOptions SourceCompiler::GetOptions()
+    {
+        std::lock_guard lock(m_Mutex);
+        return m_Options;
+    }
+
+    CompilerStats SourceCompiler::GetStats()
+    {
+        std::lock_guard lock(m_Mutex);
+        return m_Stats;
+    }
+
+    CompilerOptions SourceCompiler::ResolvedOptions()
+    {
+        auto options = GetOptions();
+
+        if (options.m_Compiler.empty())
+        {
+            options.m_Compiler = DefaultCompiler();
+        }
+
+        if (options.m_CacheDirectory.empty())
+        {
+            std::error_code ec;
+            options.m_CacheDirectory = std::filesystem::temp_directory_path(ec) / "cse_compiled";
+        }
+
+        return options;
+    }
+
+    CompileResult SourceCompiler::Compile(const CompileRequest& request)
+    {
+        using clock = std::chrono::steady_clock;
+        auto started = clock::now();
+
+        CompileResult result;
+        auto options = ResolvedOptions();
+        if (options.m_Compiler.empty())
+        {
+            result.m_Output = "no compiler configured";
+            return result;
+        }
+
+        for (const auto& argument : request.m_Arguments)
+        {
+            if (!IsAllowedArgument(argument))
+            {
+                result.m_Output = "argument not allowed: " + argument;
+                return result;
+            }
+        }
+
+        std::vector<std::string> references = options.m_References;
+        references.insert(references.end(), request.m_References.begin(), request.m_References.end());
+
+        for (const auto& reference : references)
+        {
+            if (!IsValidReference(reference))
+            {
+                result.m_Output = "invalid reference: " + reference;
+                return result;
+            }
+        }
+
+        // Mono only reads portable PDBs, a Windows PDB from the Framework csc is written but never handed out
+        const bool portablePdb = request.m_Debug && !IsFrameworkCompiler(options.m_Compiler);
+
+        Sha256 hasher;
+        HashField(hasher, options.m_Compiler.string());
+        for (const auto& reference : references)
+        {
+            HashReference(hasher, reference);
+        }
+
+        for (const auto& argument : request.m_Arguments)
+        {
+            HashField(hasher, argument);
+        }
+
+        HashField(hasher, request.m_Debug ? "debug" : "release");
+        HashField(hasher, request.m_Source);
+        result.m_Key = hasher.Finish();
+
+        const auto key = ToHex(result.m_Key);
+        const auto& directory = options.m_CacheDirectory;
+        const auto imagePath = directory / (key + ".dll");
+        const auto pdbPath = directory / (key + ".pdb");
+
+        auto finish = [&]()
+        {
+            result.m_CompileMs = std::chrono::duration<double, std::milli>(clock::now() - started).count();
+
+            std::lock_guard lock(m_Mutex);
+            if (result.m_Cached)
+            {
+                m_Stats.m_Hits++;
+            }
+            else if (result.m_Success)
+            {
+                m_Stats.m_Compiled++;
+            }
+            else
+            {
+                m_Stats.m_Failed++;
+            }
+
+            return std::move(result);
+        };
+
+        // the image is only renamed into place once complete, its presence means a finished compilation
+        auto image = MappedFile::OpenRead(imagePath);
+        if (image && image->GetSize() > 0)
+        {
+            result.m_Success = true;
+            result.m_Cached = true;
+            result.m_Image = std::move(image);
+            if (portablePdb)
+            {
+                result.m_Pdb = MappedFile::OpenRead(pdbPath);
+            }
+
+            return finish();
+        }
+
+        std::error_code ec;
+        std::filesystem::create_directories(directory, ec);
+
+        // concurrent compilations of the same key each get their own files, whichever finishes last wins the rename
+        const auto stem = key + "." + std::to_string(GetCurrentThreadId());
+        const auto sourcePath = directory / (stem + ".cs");
+        const auto responsePath = directory / (stem + ".rsp");
+        const auto outputPath = directory / (stem + ".dll");
+        const auto outputPdbPath = directory / (stem + ".pdb");
+
+        {
+            std::ofstream source(sourcePath, std::ios::binary);
+            source.write(request.m_Source.data(), request.m_Source.size());
+        }
+
+        {
+            // a response file keeps long reference lists clear of the command line limit, csc and mcs both read it
+            std::ofstream response(responsePath, std::ios::binary);
+            response << "/nologo\n/target:library\n/out:" << Quote(outputPath.string()) << "\n";
+            if (request.m_Debug)
+            {
+                response << (portablePdb ? "/debug:portable" : "/debug:full") << "\n/pdb:" << Quote(outputPdbPath.string()) << "\n";
+            }
+
+            for (const auto& reference : references)
+            {
+                response << "/reference:" << Quote(reference) << "\n";
+            }
+
+            for (const auto& argument : request.m_Arguments)
+            {
+                response << argument << "\n";
+            }
+
+            response << Quote(sourcePath.string()) << "\n";
+        }
+
+        auto commandLine = L"\"" + options.m_Compiler.wstring() + L"\" @\"" + responsePath.wstring() + L"\"";
+        auto process = RunProcess(std::move(commandLine), directory, options.m_Timeout);
+
+        result.m_Output = std::move(process.m_Output);
+        result.m_ExitCode = static_cast<int>(process.m_ExitCode);
+
+        if (!process.m_Started)
+        {
+            result.m_Output = "failed to start " + options.m_Compiler.string();
+        }
+        else if (process.m_TimedOut)
+        {
+            result.m_Output += "\ncompiler timed out";
+        }
+        else if (process.m_ExitCode == 0 && std::filesystem::exists(outputPath, ec))
+        {
+            if (request.m_Debug)
+            {
+                std::filesystem::rename(outputPdbPath, pdbPath, ec);
+            }
+
+            // fails if another compilation got there first and its image is in use, that one is identical
+            std::filesystem::rename(outputPath, imagePath, ec);
+
+            result.m_Image = MappedFile::OpenRead(imagePath);
+            result.m_Success = result.m_Image && result.m_Image->GetSize() > 0;
+            if (portablePdb)
+            {
+                result.m_Pdb = MappedFile::OpenRead(pdbPath);
+            }
+        }
+
+        for (const auto& path : { sourcePath, responsePath, outputPath, outputPdbPath })
+        {
+            std::filesystem::remove(path, ec);
+        }
+
+        if (!result.m_Success)
+        {
+            log_warn("[Compiler] Compilation %s failed with exit code %d", key, result.m_ExitCode);
+        }
+
+        return finish();
+    }
+}
\ No newline at end of file
@@ -0,0 +1,394 @@
+#include <cse/compression.hpp>
+#include <cstring>
+
+namespace cse
+{
+    namespace lz4
+    {
+        /**
+         * Minimal LZ4 block codec (greedy, single hash table).
+         * Output is a plain LZ4 block so any stock LZ4 implementation can produce/consume it.
+         */
+
+        constexpr size_t MIN_MATCH = 4;
+        constexpr size_t LAST_LITERALS = 5;
+        constexpr size_t MF_LIMIT = 12;
+        constexpr size_t MAX_DISTANCE = 65535;
+        constexpr int HASH_LOG = 16;
+
+        inline uint32_t Read32(const uint8_t* p)
+        {
+            uint32_t v;
+            std::memcpy(&v, p, sizeof(v));
+            return v;
+        }
+
+        inline uint32_t Hash(uint32_t sequence)
+        {
+            return (sequence * 2654435761u) >> (32 - HASH_LOG);
+        }
+
+        inline void WriteLength(std::vector<uint8_t>& out, size_t length)
+        {
+            while (length >= 255)
+            {
+                out.push_back(255);
+                length -= 255;
+            }
+
+            out.push_back(static_cast<uint8_t>(length));
+        }
+
+        void EmitSequence(std::vector<uint8_t>& out, const uint8_t* literals, size_t literalLength, size_t offset, size_t matchLength)
+        {
+            uint8_t token = static_cast<uint8_t>((literalLength >= 15 ? 15 : literalLength) << 4);
+            if (offset)
+            {
+                size_t ml = matchLength - MIN_MATCH;
+                token |= static_cast<uint8_t>(ml >= 15 ? 15 : ml);
+            }
+
+            out.push_back(token);
+            if (literalLength >= 15)
+            {
+                WriteLength(out, literalLength - 15);
+            }
+
+            out.insert(out.end(), literals, literals + literalLength);
+
+            if (!offset)
+            {
+                return;
+            }
+
+            out.push_back(static_cast<uint8_t>(offset & 0xFF));
+            out.push_back(static_cast<uint8_t>(offset >> 8));
+
+            if (matchLength - MIN_MATCH >= 15)
+            {
+                WriteLength(out, matchLength - MIN_MATCH - 15);
+            }
+        }
+
+        std::vector<uint8_t> Compress(std::span<const uint8_t> data)
+        {
+            std::vector<uint8_t> out;
+            out.reserve(data.size() + data.size() / 255 + 16);
+
+            const uint8_t* src = data.data();
+            const size_t size = data.size();
+
+            size_t anchor = 0;
+            if (size > MF_LIMIT)
+            {
+                std::vector<uint32_t> table(size_t(1) << HASH_LOG, 0);
+
+                const size_t matchLimit = size - LAST_LITERALS;
+                const size_t lastMatchStart = size - MF_LIMIT;
+
+                size_t ip = 0;
+                while (ip <= lastMatchStart)
+                {
+                    uint32_t sequence = Read32(src + ip);
+                    uint32_t& slot = table[Hash(sequence)];
+                    size_t ref = slot;
+                    slot = static_cast<uint32_t>(ip);
+
+                    if (ref >= ip || ip - ref > MAX_DISTANCE || Read32(src + ref) != sequence)
+                    {
+                        ++ip;
+                        continue;
+                    }
+
+                    while (ip > anchor && ref > 0 && src[ip - 1] == src[ref - 1])
+                    {
+                        --ip;
+                        --ref;
+                    }
+
+                    size_t length = MIN_MATCH;
+                    while (ip + length < matchLimit && src[ref + length] == src[ip + length])
+                    {
+                        ++length;
+                    }
+
+                    EmitSequence(out, src + anchor, ip - anchor, ip - ref, length);
+
+                    ip += length;
+                    anchor = ip;
+
+                    if (ip - 2 <= lastMatchStart)
+                    {
+                        table[Hash(Read32(src + ip - 2))] = static_cast<uint32_t>(ip - 2);
+                    }
+                }
+            }
+
+            EmitSequence(out, src + anchor, size - anchor, 0, 0);
+            return out;
+        }
+
+        bool Decompress(std::span<const uint8_t> data, std::span<uint8_t> dst)
+        {
+            const uint8_t* src = data.data();
+            const size_t srcSize = data.size();
+            uint8_t* out = dst.data();
+            const size_t dstSize = dst.size();
+
+            size_t ip = 0;
+            size_t op = 0;
+
+            auto readLength = [&](size_t& length) -> bool
+            {
+                uint8_t b;
+                do
+                {
+                    if (ip >= srcSize)
+                        return false;
+
+                    b = src[ip++];
+                    length += b;
+                } while (b == 255);
+
+                return true;
+            };
+
+            while (true)
+            {
+                if (ip >= srcSize)
+                {
+                    return false;
+                }
+
+                uint8_t token = src[ip++];
+
+                size_t literalLength = token >> 4;
+                if (literalLength == 15 && !readLength(literalLength))
+                {
+                    return false;
+                }
+
+                if (literalLength > srcSize - ip || literalLength > dstSize - op)
+                {
+                    return false;
+                }
+
+                std::memcpy(out + op, src + ip, literalLength);
+                ip += literalLength;
+                op += literalLength;
+
+                // the last sequence carries literals only
+                if (ip == srcSize)
+                {
+                    break;
+                }
+
+                if (srcSize - ip < 2)
+                {
+                    return false;
+                }
+
+                size_t offset = src[ip] | (size_t(src[ip + 1]) << 8);
+                ip += 2;
+
+                if (offset == 0 || offset > op)
+                {
+                    return false;
+                }
+
+                size_t matchLength = token & 15;
+                if (matchLength == 15 && !readLength(matchLength))
+                {
+                    return false;
+                }
+
+                matchLength += MIN_MATCH;
+                if (matchLength > dstSize - op)
+                {
+                    return false;
+                }
+
+                uint8_t* match = out + op - offset;
+                if (offset >= matchLength)
+                {
+                    std::memcpy(out + op, match, matchLength);
+                }
+                else
+                {
+                    for (size_t i = 0; i < matchLength; ++i)
+                    {
+                        out[op + i] = match[i];
+                    }
+                }
+
+                op += matchLength;
+            }
+
+            return op == dstSize;
+        }
+    }
+
+    const char* CodecName(Codec codec)
+    {
+        switch (codec)
+        {
+        case Codec::None:
+            return "none";
+        case Codec::Lz4:
+            return "lz4";
+        }
+
+        return "unknown";
+    }
+
+    std::optional<Codec> CodecFromName(std::string_view name)
+    {
+        if (name.empty() || name == "none")
+            return Codec::None;
+
+        if (name == "lz4")
+            return Codec::Lz4;
+
+        return std::nullopt;
+    }
+
+    size_t CompressBound(Codec codec, size_t size)
+    {
+        if (codec == Codec::Lz4)
+        {
+            return size + size / 255 + 16;
+        }
+
+        return size;
+    }
+
+    std::vector<uint8_t> Compress(Codec codec, std::span<const uint8_t> data)
+    {
+        if (codec == Codec::Lz4)
+        {
+            return lz4::Compress(data);
+        }
+
+        return std::vector<uint8_t>(data.begin(), data.end());
+    }
+
+    bool Decompress(Codec codec, std::span<const uint8_t> src, std::span<uint8_t> dst)
+    {
+        switch (codec)
+        {
+        case Codec::None:
+            if (src.size() != dst.size())
+                return false;
+
+            if (!src.empty())
+                std::memcpy(dst.data(), src.data(), src.size());
+
+            return true;
+
+        case Codec::Lz4:
+            return lz4::Decompress(src, dst);
+        }
+
+        return false;
+    }
+
+    bool Payload::DecodeInto(std::span<uint8_t> dst) const
+    {
+        if (dst.size() != m_Size)
+        {
+            return false;
+        }
+
+        if (m_Producer)
+        {
+            return m_Producer(dst);
+        }
+
+        return Decompress(m_Codec, m_Data, dst);
+    }
+
+    bool Payload::HasValidSize() const
+    {
+        if (m_Size > MAX_PAYLOAD_SIZE)
+        {
+            return false;
+        }
+
+        // a producer computes its own size
+        if (m_Producer)
+        {
+            return true;
+        }
+
+        switch (m_Codec)
+        {
+        case Codec::None:
+            return m_Size == m_Data.size();
+
+        // every input byte expands to at most 255 output bytes
+        case Codec::Lz4:
+            return m_Size / 255 <= m_Data.size();
+        }
+
+        return false;
+    }
+
+    std::vector<uint8_t> Payload::Decode() const
+    {
+        if (!HasValidSize())
+        {
+            return {};
+        }
+
+        std::vector<uint8_t> data(m_Size);
+        if (!DecodeInto(data))
+        {
+            return {};
+        }
+
+        return data;
+    }
+
+    std::vector<uint8_t> PackBlob(std::span<const uint8_t> data, Codec codec)
+    {
+        std::vector<uint8_t> compressed = Compress(codec, data);
+
+        // not worth it, keep the raw bytes
+        if (codec != Codec::None && compressed.size() >= data.size())
+        {
+            codec = Codec::None;
+            compressed.assign(data.begin(), data.end());
+        }
+
+        BlobHeader header{};
+        header.m_Magic = BlobHeader::MAGIC;
+        header.m_Codec = static_cast<uint8_t>(codec);
+        header.m_Size = data.size();
+
+        std::vector<uint8_t> blob(sizeof(header) + compressed.size());
+        std::memcpy(blob.data(), &header, sizeof(header));
+        if (!compressed.empty())
+        {
+            std::memcpy(blob.data() + sizeof(header), compressed.data(), compressed.size());
+        }
+
+        return blob;
+    }
+
+    std::optional<Payload> UnpackBlob(std::span<const uint8_t> data)
+    {
+        if (data.size() < sizeof(BlobHeader))
+        {
+            return std::nullopt;
+        }
+
+        BlobHeader header;
+        std::memcpy(&header, data.data(), sizeof(header));
+        if (header.m_Magic != BlobHeader::MAGIC || header.m_Codec > static_cast<uint8_t>(Codec::Lz4))
+        {
+            return std::nullopt;
+        }
+
+        return Payload(data.subspan(sizeof(header)), static_cast<Codec>(header.m_Codec), static_cast<size_t>(header.m_Size));
+    }
+}
\ No newline at end of file
@@ -1,13 +1,19 @@
 #include <cse/console.hpp>
+#include <cse/log.hpp>
 #include <windows.h>
+#include <cstdarg>
+#include <cstdio>
 
 namespace cse
 {
-    static bool s_EnableConsole = false;
-
     auto init_adhesive() -> std::function<void()>
     {
-        return []() {};
+        start_logger();
+
+        return []()
+        {
+            stop_logger();
+        };
     }
 
     auto init_noadhesive() -> std::function<void()>
@@ -17,10 +23,16 @@ namespace cse
         freopen_s(&f, "CONOUT$", "w", stdout);
         freopen_s(&f, "CONIN$", "r", stdin);
         printf("[CSE] Console initialized\n");
-        s_EnableConsole = true;
+
+        set_log_console(true);
+        start_logger();
 
         return [f]()
         {
+            // flush whatever is still queued while stdout is valid
+            stop_logger();
+            set_log_console(false);
+
             if (f)
             {
                 fclose(f);
@@ -45,13 +57,31 @@ namespace cse
 
     void println(const char* fmt, ...)
     {
-        if (!s_EnableConsole)
+        if (!logging::IsEnabled(LogLevel::Info))
             return;
 
+        char buffer[1024];
+
         va_list args;
         va_start(args, fmt);
-        vprintf(fmt, args);
+        int length = vsnprintf(buffer, sizeof(buffer), fmt, args);
         va_end(args);
-        printf("\n");
+
+        if (length < 0)
+            return;
+
+        if (static_cast<size_t>(length) < sizeof(buffer))
+        {
+            log_text(LogLevel::Info, std::string_view(buffer, length));
+            return;
+        }
+
+        std::string text(length + 1, '\0');
+        va_start(args, fmt);
+        vsnprintf(text.data(), text.size(), fmt, args);
+        va_end(args);
+
+        text.resize(length);
+        log_text(LogLevel::Info, text);
     }
 }
\ No newline at end of file
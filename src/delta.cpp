@@ -0,0 +1,131 @@
+#include <cse/delta.hpp>
+#include <cse/hash.hpp>
+#include <algorithm>
+#include <limits>
+
+namespace cse
+{
+    namespace
+    {
+        // [begin, end) of the base a copy covers, nullopt if the offsets overflow or start past the base
+        std::optional<std::pair<size_t, size_t>> CopyRange(const DeltaOp& op, size_t baseSize, size_t blockSize)
+        {
+            uint64_t first = op.m_Block;
+            uint64_t last = first + op.m_Count - 1;
+            if (last > std::numeric_limits<size_t>::max() / blockSize)
+            {
+                return std::nullopt;
+            }
+
+            size_t lastBegin = static_cast<size_t>(last) * blockSize;
+            if (lastBegin >= baseSize)
+            {
+                return std::nullopt;
+            }
+
+            return std::make_pair(static_cast<size_t>(first) * blockSize, lastBegin + std::min(blockSize, baseSize - lastBegin));
+        }
+    }
+
+    uint32_t WeakChecksum(std::span<const uint8_t> block)
+    {
+        uint32_t a = 0;
+        uint32_t b = 0;
+        size_t length = block.size();
+
+        for (size_t i = 0; i < length; ++i)
+        {
+            a += block[i];
+            b += static_cast<uint32_t>(length - i) * block[i];
+        }
+
+        return (a & 0xFFFF) | (b << 16);
+    }
+
+    uint64_t StrongChecksum(std::span<const uint8_t> block)
+    {
+        Hash256 hash = Sha256::Of(block);
+
+        uint64_t value;
+        std::memcpy(&value, hash.data(), sizeof(value));
+        return value;
+    }
+
+    std::vector<BlockSignature> ComputeSignatures(std::span<const uint8_t> data, size_t blockSize)
+    {
+        std::vector<BlockSignature> signatures;
+        if (blockSize == 0)
+        {
+            return signatures;
+        }
+
+        signatures.reserve((data.size() + blockSize - 1) / blockSize);
+        for (size_t offset = 0; offset < data.size(); offset += blockSize)
+        {
+            auto block = data.subspan(offset, std::min(blockSize, data.size() - offset));
+            signatures.push_back({ WeakChecksum(block), StrongChecksum(block) });
+        }
+
+        return signatures;
+    }
+
+    std::optional<size_t> DeltaOutputSize(size_t baseSize, size_t blockSize, std::span<const DeltaOp> ops)
+    {
+        if (blockSize == 0)
+        {
+            return std::nullopt;
+        }
+
+        size_t size = 0;
+        for (const auto& op : ops)
+        {
+            size_t length = op.m_Literal.size();
+            if (op.IsCopy())
+            {
+                auto range = CopyRange(op, baseSize, blockSize);
+                if (!range.has_value())
+                {
+                    return std::nullopt;
+                }
+
+                length = range->second - range->first;
+            }
+
+            if (length > std::numeric_limits<size_t>::max() - size)
+            {
+                return std::nullopt;
+            }
+
+            size += length;
+        }
+
+        return size;
+    }
+
+    bool ApplyDelta(std::span<const uint8_t> base, size_t blockSize, std::span<const DeltaOp> ops, std::span<uint8_t> dst)
+    {
+        auto expected = DeltaOutputSize(base.size(), blockSize, ops);
+        if (!expected.has_value() || *expected != dst.size())
+        {
+            return false;
+        }
+
+        size_t offset = 0;
+        for (const auto& op : ops)
+        {
+            if (!op.IsCopy())
+            {
+                std::copy(op.m_Literal.begin(), op.m_Literal.end(), dst.begin() + offset);
+                offset += op.m_Literal.size();
+                continue;
+            }
+
+            // already validated by DeltaOutputSize
+            auto [begin, end] = *CopyRange(op, base.size(), blockSize);
+            std::copy(base.begin() + begin, base.begin() + end, dst.begin() + offset);
+            offset += end - begin;
+        }
+
+        return true;
+    }
+}
\ No newline at end of file
@@ -6,6 +6,12 @@ DWORD WINAPI MainThread(LPVOID lpParam)
 {
     cse::entrypoint();
 
+    // a pinned module stays loaded anyway, dropping our reference would only pretend otherwise
+    if (cse::is_module_pinned())
+    {
+        ExitThread(0);
+    }
+
     FreeLibraryAndExitThread((HMODULE)lpParam, 0);
     return 0;
 }
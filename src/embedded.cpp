@@ -0,0 +1,197 @@
+#include <cse/embedded.hpp>
+#include <cse/console.hpp>
+#include <windows.h>
+#include <mutex>
+#include <atomic>
+
+// generated at build time by embed_payloads.py
+#include <embedded_manifest.h>
+
+namespace cse
+{
+    struct EmbeddedPayloads::Impl
+    {
+        struct Entry
+        {
+            const EmbeddedManifestEntry* m_Manifest;
+
+            std::once_flag m_Located;
+            std::optional<Payload> m_Stored;
+
+            std::once_flag m_Decoded;
+            std::atomic<bool> m_DecodeDone{ false };
+            std::vector<uint8_t> m_Storage;
+            std::optional<std::span<const uint8_t>> m_Data;
+        };
+
+        std::vector<std::unique_ptr<Entry>> m_Entries;
+
+        Impl()
+        {
+            for (const auto& manifest : CSE_EMBEDDED_MANIFEST)
+            {
+                auto entry = std::make_unique<Entry>();
+                entry->m_Manifest = &manifest;
+                m_Entries.push_back(std::move(entry));
+            }
+        }
+
+        Entry* Find(std::string_view name)
+        {
+            for (auto& entry : m_Entries)
+            {
+                if (name == entry->m_Manifest->m_Name)
+                {
+                    return entry.get();
+                }
+            }
+
+            return nullptr;
+        }
+
+        static HMODULE GetSelfModule()
+        {
+            HMODULE module = nullptr;
+            GetModuleHandleExW(GET_MODULE_HANDLE_EX_FLAG_FROM_ADDRESS | GET_MODULE_HANDLE_EX_FLAG_UNCHANGED_REFCOUNT,
+                reinterpret_cast<LPCWSTR>(&EmbeddedPayloads::GetInstance), &module);
+
+            return module;
+        }
+
+        // the resource lives in our own mapped image, LockResource hands out a pointer into it
+        static void Locate(Entry& entry)
+        {
+            static HMODULE module = GetSelfModule();
+
+            HRSRC resource = FindResourceA(module, entry.m_Manifest->m_ResourceId, RT_RCDATA);
+            HGLOBAL loaded = resource ? LoadResource(module, resource) : nullptr;
+            const void* data = loaded ? LockResource(loaded) : nullptr;
+
+            if (!data)
+            {
+                println("[Embedded] Resource %s is missing", entry.m_Manifest->m_ResourceId);
+                return;
+            }
+
+            auto stored = UnpackBlob(std::span<const uint8_t>(static_cast<const uint8_t*>(data), SizeofResource(module, resource)));
+            if (!stored.has_value() || stored->m_Size != entry.m_Manifest->m_Size)
+            {
+                println("[Embedded] Resource %s is not a valid packed blob", entry.m_Manifest->m_ResourceId);
+                return;
+            }
+
+            // checked once against the manifest before anything uses it, compressed payloads are decoded into a temporary for it
+            bool verified = false;
+            if (stored->m_Codec == Codec::None)
+            {
+                verified = Sha256::Of(stored->m_Data) == entry.m_Manifest->m_Hash;
+            }
+            else
+            {
+                auto decoded = stored->Decode();
+                verified = decoded.size() == stored->m_Size && Sha256::Of(decoded) == entry.m_Manifest->m_Hash;
+            }
+
+            if (!verified)
+            {
+                println("[Embedded] Resource %s does not match its manifest hash", entry.m_Manifest->m_ResourceId);
+                return;
+            }
+
+            entry.m_Stored = *stored;
+        }
+
+        std::optional<Payload> GetStored(Entry& entry)
+        {
+            std::call_once(entry.m_Located, [&] { Locate(entry); });
+            return entry.m_Stored;
+        }
+
+        std::optional<std::span<const uint8_t>> GetData(Entry& entry)
+        {
+            std::call_once(entry.m_Decoded, [&]
+            {
+                auto stored = GetStored(entry);
+                if (stored.has_value())
+                {
+                    if (stored->m_Codec == Codec::None)
+                    {
+                        entry.m_Data = stored->m_Data;
+                    }
+                    else
+                    {
+                        entry.m_Storage.resize(stored->m_Size);
+                        if (stored->DecodeInto(entry.m_Storage))
+                        {
+                            entry.m_Data = std::span<const uint8_t>(entry.m_Storage);
+                        }
+                        else
+                        {
+                            println("[Embedded] Failed to decode %s", entry.m_Manifest->m_Name);
+                            entry.m_Storage.clear();
+                        }
+                    }
+                }
+
+                entry.m_DecodeDone.store(true);
+            });
+
+            return entry.m_Data;
+        }
+    };
+
+    EmbeddedPayloads& EmbeddedPayloads::GetInstance()
+    {
+        static EmbeddedPayloads instance;
+        return instance;
+    }
+
+    EmbeddedPayloads::EmbeddedPayloads()
+        : m_Impl(std::make_unique<Impl>())
+    {
+    }
+
+    EmbeddedPayloads::~EmbeddedPayloads() = default;
+
+    std::optional<std::span<const uint8_t>> EmbeddedPayloads::Get(std::string_view name)
+    {
+        auto* entry = m_Impl->Find(name);
+        if (!entry)
+        {
+            return std::nullopt;
+        }
+
+        return m_Impl->GetData(*entry);
+    }
+
+    std::optional<Payload> EmbeddedPayloads::GetPayload(std::string_view name)
+    {
+        auto* entry = m_Impl->Find(name);
+        if (!entry)
+        {
+            return std::nullopt;
+        }
+
+        return m_Impl->GetStored(*entry);
+    }
+
+    std::vector<EmbeddedPayloadInfo> EmbeddedPayloads::List()
+    {
+        std::vector<EmbeddedPayloadInfo> payloads;
+        for (auto& entry : m_Impl->m_Entries)
+        {
+            auto stored = m_Impl->GetStored(*entry);
+
+            EmbeddedPayloadInfo info;
+            info.m_Name = entry->m_Manifest->m_Name;
+            info.m_Hash = entry->m_Manifest->m_Hash;
+            info.m_Size = entry->m_Manifest->m_Size;
+            info.m_StoredSize = entry->m_Manifest->m_StoredSize;
+            info.m_Codec = stored ? stored->m_Codec : Codec::None;
+            info.m_Decoded = entry->m_DecodeDone.load() && entry->m_Data.has_value();
+            payloads.push_back(info);
+        }
+
+        return payloads;
+    }
+}
\ No newline at end of file
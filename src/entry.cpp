@@ -2,89 +2,52 @@
 #include <cse/mono.hpp>
 #include <cse/flow.hpp>
 #include <cse/console.hpp>
+#include <cse/log.hpp>
 #include <cse/executor.hpp>
 #include <cse/ipc.hpp>
-#include <cse/executed.h>
+#include <cse/commands.hpp>
+#include <cse/handlers.hpp>
+#include <cse/watcher.hpp>
+#include <cse/store.hpp>
+#include <cse/embedded.hpp>
+#include <cse/results.hpp>
+#include <cse/watchdog.hpp>
+#include <cse/capture.hpp>
+#include <cse/journal.hpp>
+#include <cse/profiler.hpp>
+#include <atomic>
 #include <functional>
 #include <Windows.h>
-#include <fstream>
 
 namespace cse
 {
-    std::string random_string(size_t length)
-    {
-        const std::string characters = "abcdefghijklmnopqrstuvwxyzABCDEFGHIJKLMNOPQRSTUVWXYZ0123456789";
-        std::string result;
-        result.reserve(length);
+    static std::atomic<bool> s_Pinned{ false };
 
-        for (size_t i = 0; i < length; ++i)
+    void pin_module(const char* reason)
+    {
+        if (s_Pinned.exchange(true))
         {
-            result += characters[rand() % characters.size()];
+            return;
         }
 
-        return result;
-    }
-
-    nlohmann::json ListResources()
-    {
-        return nlohmann::json::array();
-    }
-
-    nlohmann::json ListResourcesWithRuntimes()
-    {
-        static auto& executor = Executor::GetInstance();
-
-        nlohmann::json result = nlohmann::json::array();
-
-        for (const auto runtime : executor.GetRuntimes())
+        HMODULE module = nullptr;
+        if (!GetModuleHandleExW(GET_MODULE_HANDLE_EX_FLAG_FROM_ADDRESS | GET_MODULE_HANDLE_EX_FLAG_PIN, reinterpret_cast<LPCWSTR>(&pin_module), &module))
         {
-            nlohmann::json item = nlohmann::json::object();
-            item["resource"] = runtime.GetResourceName();
-            result.push_back(item);
+            log_error("[CSE] Failed to pin the module. Error: %x", GetLastError());
+            return;
         }
 
-        return result;
+        log_info("[CSE] Module pinned: %s", reason);
     }
 
-    nlohmann::json CreateRuntime(const std::string& resource)
+    bool is_module_pinned()
     {
-        return nlohmann::json::object();
+        return s_Pinned.load();
     }
 
-    void ExecuteInResource(const std::string& resource, const std::string& scriptFilePath)
+    std::span<const uint8_t> embedded_script()
     {
-        static auto& executor = Executor::GetInstance();
-
-        std::ifstream scriptFile(scriptFilePath, std::ios::binary);
-        if (!scriptFile)
-        {
-            println("[ExecuteInResource] Failed to open script file: %s", scriptFilePath.c_str());
-            return;
-        }
-
-        std::vector<uint8_t> scriptData((std::istreambuf_iterator<char>(scriptFile)), std::istreambuf_iterator<char>());
-        if (scriptData.empty())
-        {
-            println("[ExecuteInResource] Script file is empty: %s", scriptFilePath.c_str());
-            return;
-        }
-
-        for (const cse::RuntimeInfo& runtime : executor.GetRuntimes())
-        {
-            if (runtime.GetResourceName() == resource)
-            {
-                auto randomName = random_string(8);
-                if (executor.Execute(randomName, scriptData, std::nullopt, std::cref(runtime)))
-                {
-                    println("[ExecuteInResource] Successfully executed script in resource: %s", resource.c_str());
-                }
-                else
-                {
-                    println("[ExecuteInResource] Failed to execute script in resource: %s", resource.c_str());
-                }
-                return;
-            }
-        }
+        return EmbeddedPayloads::GetInstance().Get("executed").value_or(std::span<const uint8_t>());
     }
 
     void entrypoint()
@@ -93,56 +56,46 @@ namespace cse
         static auto& mono = MonoMethods::GetInstance();
         static auto& executor = Executor::GetInstance();
 
+        // before any script is compiled, extern methods are bound when they are first JIT compiled
+        ResultChannels::GetInstance().Install();
+
         static auto& ipc = IpcManager::GetInstance();
 
-        static std::vector<uint8_t> scriptData = std::vector<uint8_t>(
-            std::begin(executed), std::end(executed)
-        );
+        static auto& registry = CommandRegistry::GetInstance();
+        RegisterCommands(registry);
 
-        ipc.Initialize([&](const nlohmann::json& request) -> nlohmann::json
+        ipc.OnDisconnect([](uint64_t clientId)
         {
-            println("[IPC] Received request: %s", request.dump().c_str());
+            Scheduler::GetInstance().RemoveClient(clientId);
+        });
 
+        ipc.Initialize([&](const nlohmann::json& request, uint64_t clientId) -> nlohmann::json
+        {
+            // runs on the client's thread, anything escaping it would take the process down
             try
             {
-                auto cmd = request.at("cmd").get<std::string>();
-                println("[IPC] Command: %s", cmd.c_str());
+                // only the command name, dumping whole requests (script bytes included) was the most expensive line here
+                auto cmd = request.find("cmd");
+                log_debug("[IPC] Received %s from client %llu", cmd != request.end() && cmd->is_string() ? cmd->get<std::string>() : std::string("?"),
+                    (unsigned long long)clientId);
 
-                nlohmann::json response = nlohmann::json::object();
-                if (cmd == "list_resources")
-                {
-                    response = ListResources();
-                }
-                else if (cmd == "list_resources_with_runtimes")
-                {
-                    response = ListResourcesWithRuntimes();
-                }
-                else if (cmd == "create_runtime")
-                {
-                    auto resource = request.at("resource").get<std::string>();
-                    response = CreateRuntime(resource);
-                }
-                else if (cmd == "execute_in_resource")
-                {
-                    auto resource = request.at("resource").get<std::string>();
-                    auto scriptFilePath = request.at("scriptFilePath").get<std::string>();
-                    ExecuteInResource(resource, scriptFilePath);
-                }
-
-                return response;
+                return registry.Dispatch(request, clientId);
             }
             catch (std::exception& e)
             {
                 println("[IPC] Exception: %s", e.what());
+                return { { "error", e.what() } };
             }
-
-            return nlohmann::json::object();
         });
         while (!GetAsyncKeyState(VK_END))
         {
             if (GetAsyncKeyState(VK_HOME))
             {
-                executor.Execute("test_script", scriptData);
+                // decoded straight from the resource into the managed array
+                if (auto script = EmbeddedPayloads::GetInstance().GetPayload("executed"))
+                {
+                    executor.Execute("test_script", *script);
+                }
 
                 Sleep(500);
             }
@@ -150,6 +103,17 @@ namespace cse
             Sleep(100);
         }
 
+        // every background thread is joined here, static destructors run under the loader lock when
+        // FreeLibraryAndExitThread unloads us and a thread can't exit while it's held, so they only detach
+        // clients and watchers dispatch through the registry, stop them before its workers
+        ipc.Shutdown();
+        ScriptWatcher::GetInstance().Shutdown();
+        registry.Shutdown();
+        ExecutionWatchdog::GetInstance().Shutdown();
+        ScriptProfiler::GetInstance().Stop();
+        OutputCapture::GetInstance().SetEnabled(false);
+        AssemblyStore::GetInstance().Flush();
+        ExecutionJournal::GetInstance().Flush();
         deinit();
     }
 }
\ No newline at end of file
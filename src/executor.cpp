@@ -1,10 +1,34 @@
 #include <cse/executor.hpp>
+#include <cse/fields.hpp>
 #include <cse/flow.hpp>
+#include <cse/log.hpp>
+#include <cse/warmup.hpp>
+#include <cse/metadata.hpp>
+#include <cse/hash.hpp>
+#include <cse/results.hpp>
+#include <cse/usage.hpp>
+#include <cse/watchdog.hpp>
+#include <cse/capture.hpp>
+#include <cse/profiler.hpp>
+#include <cse/journal.hpp>
+#include <cse/commands.hpp>
+#include <cse/scheduler.hpp>
+#include <condition_variable>
+#include <unordered_set>
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <memory>
+#include <random>
+#include <thread>
 
 namespace cse
 {
     std::string RuntimeInfo::GetResourceName() const
     {
+        if (!m_ResourceName.empty())
+            return m_ResourceName;
+
         if (!m_InternalManager || !m_CreateAssemblyInternal || !m_Domain)
             return {};
 
@@ -14,61 +38,132 @@ namespace cse
             MonoScope scope(m_Domain);
             static MonoMethods& methods = MonoMethods::GetInstance();
 
-            static MonoClass* internalManagerClass = nullptr;
+            // each runtime's domain loads its own InternalManager class, the offset is resolved once per class
+            MonoClass* internalManagerClass = methods.object_get_class(m_InternalManager);
             if (!internalManagerClass)
             {
-                internalManagerClass = methods.object_get_class(m_InternalManager);
-                if (!internalManagerClass)
-                {
-                    println("[CSE] Failed to get InternalManager class!");
-                    return {};
-                }
-            }
-
-            static MonoField* nameField = nullptr;
-            if (!nameField)
-            {
-                nameField = methods.class_get_field_from_name(internalManagerClass, "m_resourceName");
-                if (!nameField)
-                {
-                    println("[CSE] Failed to get InternalManager.m_resourceName field!");
-                    return {};
-                }
+                println("[CSE] Failed to get InternalManager class!");
+                return {};
             }
 
-            MonoObject* nameObj = methods.field_get_value_object(m_Domain, nameField, m_InternalManager);
-            if (!nameObj)
+            static constexpr FieldSpec nameSpec[] = { { "m_resourceName", FieldType::String } };
+            auto layout = FieldLayout::Resolve(internalManagerClass, nameSpec);
+            if (!layout.has_value())
             {
-                println("[CSE] Failed to get InternalManager.m_resourceName value!");
+                println("[CSE] Failed to get InternalManager.m_resourceName field!");
                 return {};
             }
 
-            char* nameStr = methods.string_to_utf8((MonoString*)nameObj);
-            if (!nameStr)
+            auto value = layout->ReadString(m_InternalManager, 0);
+            if (!value.has_value())
             {
-                println("[CSE] Failed to convert InternalManager.m_resourceName to UTF-8!");
+                println("[CSE] Failed to get InternalManager.m_resourceName value!");
                 return {};
             }
 
-            name = std::string(nameStr);
-            methods.free(nameStr);
+            name = std::move(*value);
         }
 
         return name;
     }
 
+    // CreateAssemblyInternal through runtime_invoke, for runtimes without mono_method_get_unmanaged_thunk
+    static std::expected<MonoObject*, ManagedException> InvokeCreateAssembly(MonoDomain* domain, MonoMethod* method, MonoObject* manager,
+        const std::string& scriptName, MonoArray* scriptArray, MonoArray* pdbArray)
+    {
+        static MonoMethods& methods = MonoMethods::GetInstance();
+
+        MonoString* name = methods.string_new(domain, scriptName.c_str());
+        if (!name)
+        {
+            return std::unexpected(ManagedException{ {}, "failed to marshal arguments" });
+        }
+
+        bool isStatic = methods.method_get_flags(method, nullptr) & METHOD_ATTRIBUTE_STATIC;
+
+        MonoObject* exc = nullptr;
+        void* args[] = { name, scriptArray, pdbArray };
+        MonoObject* assembly = methods.runtime_invoke(method, isStatic ? nullptr : manager, args, &exc);
+        if (exc)
+        {
+            return std::unexpected(DescribeException(exc));
+        }
+
+        return assembly;
+    }
+
+    // allocates a managed byte[] and decodes the payload straight into its storage
+    static MonoArray* CreateByteArray(MonoDomain* domain, const Payload& payload)
+    {
+        static MonoMethods& methods = MonoMethods::GetInstance();
+
+        if (!payload.HasValidSize())
+        {
+            println("[CSE] Rejected %s payload claiming %zu bytes from %zu!", CodecName(payload.m_Codec), payload.m_Size, payload.m_Data.size());
+            return nullptr;
+        }
+
+        MonoClass* byteClass = methods.get_byte_class();
+        if (!byteClass)
+        {
+            println("[CSE] Failed to get Mono byte class!");
+            return nullptr;
+        }
+
+        MonoArray* array = methods.array_new(domain, byteClass, payload.m_Size);
+        if (!array)
+        {
+            return nullptr;
+        }
+
+        if (payload.m_Size == 0)
+        {
+            return array;
+        }
+
+        uint8_t* storage = (uint8_t*)methods.array_addr_with_size(array, sizeof(uint8_t), 0);
+        if (!payload.DecodeInto(std::span<uint8_t>(storage, payload.m_Size)))
+        {
+            println("[CSE] Failed to decode %s payload of %zu bytes!", CodecName(payload.m_Codec), payload.m_Size);
+            return nullptr;
+        }
+
+        return array;
+    }
+
+    // structural check so corrupt, native or x86-only images never reach CreateAssemblyInternal
+    static bool ValidateImage(std::span<const uint8_t> image)
+    {
+        const char* error = nullptr;
+        auto metadata = ReadAssemblyMetadata(image, &error);
+        if (!metadata.has_value() || !IsLoadableAssembly(*metadata, &error))
+        {
+            log_warn("[CSE] Rejected script image: %s", error);
+            return false;
+        }
+
+        return true;
+    }
+
+    static thread_local uint64_t s_CurrentExecution = 0;
+    static thread_local uint64_t s_LastExecution = 0;
+    static thread_local ExecutionOutcome s_LastOutcome = ExecutionOutcome::Completed;
+
+    Executor::Executor()
+    {
+        // kept below 2^53 so it survives clients that parse json numbers as doubles
+        std::mt19937_64 engine(std::random_device{}());
+        m_Epoch = std::uniform_int_distribution<uint64_t>(1, (1ull << 53) - 1)(engine);
+    }
+
     Executor& Executor::GetInstance()
     {
         static Executor instance;
         return instance;
     }
 
-    bool Executor::Execute(const std::string& scriptName, const std::vector<uint8_t>& scriptData,
-        std::optional<std::reference_wrapper<std::vector<uint8_t>>> pdbData,
-        std::optional<std::reference_wrapper<const RuntimeInfo>> runtime)
+    std::optional<RuntimeInfo> Executor::SelectRuntime(std::optional<std::reference_wrapper<const RuntimeInfo>> runtime)
     {
-        static MonoMethods& methods = MonoMethods::GetInstance();
-
         RuntimeInfo info;
         if (runtime.has_value())
         {
@@ -76,12 +171,13 @@ namespace cse
         }
         else
         {
+            std::lock_guard lock(m_Mutex);
             FindRuntimes();
 
             if (m_Runtimes.empty())
             {
                 println("[CSE] No runtimes available to execute script!");
-                return false;
+                return std::nullopt;
             }
 
             info = m_Runtimes[0];
@@ -90,142 +186,687 @@ namespace cse
         if (!info.m_Domain || !info.m_InternalManager || !info.m_CreateAssemblyInternal)
         {
             println("[CSE] Invalid runtime info provided!");
+            return std::nullopt;
+        }
+
+        return info;
+    }
+
+    bool Executor::Execute(const std::string& scriptName, const Payload& scriptData,
+        std::optional<Payload> pdbData,
+        std::optional<std::reference_wrapper<const RuntimeInfo>> runtime)
+    {
+        static MonoMethods& methods = MonoMethods::GetInstance();
+
+        s_LastOutcome = ExecutionOutcome::Failed;
+
+        auto info = SelectRuntime(runtime);
+        if (!info.has_value())
+        {
+            return false;
+        }
+
+        // plain images are checked before attaching, encoded ones once they are decoded into the managed array
+        bool directImage = scriptData.m_Codec == Codec::None && !scriptData.m_Producer;
+        if (directImage && !ValidateImage(scriptData.m_Data))
+        {
             return false;
         }
 
-        auto resourceName = info.GetResourceName();
-        auto domainName = methods.domain_get_friendly_name(info.m_Domain);
-        println("[CSE] Executing a script in domain: %s, resource: %s", domainName, resourceName.c_str());
+        auto resourceName = info->GetResourceName();
+        auto domainName = methods.domain_get_friendly_name(info->m_Domain);
+        log_info("[CSE] Executing a script in domain: %s, resource: %s", domainName, resourceName);
+
+        MonoScope scope(info->m_Domain);
+        return Load(*info, resourceName, scriptName, scriptData, directImage, pdbData);
+    }
+
+    std::vector<FanOutResult> Executor::ExecuteFanOut(const std::string& scriptName, const Payload& scriptData,
+        const std::optional<Payload>& pdbData, std::span<const RuntimeInfo> targets, uint64_t clientId, const char** error)
+    {
+        static auto& scheduler = Scheduler::GetInstance();
+        using clock = std::chrono::steady_clock;
 
+        // decoded here once, every target copies the same plain bytes
+        std::vector<uint8_t> decoded;
+        std::span<const uint8_t> image = scriptData.m_Data;
+        if (scriptData.m_Codec != Codec::None || scriptData.m_Producer)
         {
-            MonoScope scope(info.m_Domain);
+            decoded = scriptData.Decode();
+            image = decoded;
+        }
 
-            MonoString* name = methods.string_new(info.m_Domain, scriptName.c_str());
-            if (!name)
+        if (!ValidateImage(image))
+        {
+            if (error)
             {
-                println("[CSE] Failed to create MonoString for script name!");
-                return false;
+                *error = "invalid image";
             }
 
-            MonoClass* byteClass = methods.get_byte_class();
-            if (!byteClass)
+            return {};
+        }
+
+        std::vector<uint8_t> decodedPdb;
+        std::optional<Payload> pdb;
+        if (pdbData.has_value())
+        {
+            // Decode returns nothing for a corrupt payload, loading without the pdb would hide that
+            decodedPdb = pdbData->Decode();
+            if (decodedPdb.size() != pdbData->m_Size)
             {
-                println("[CSE] Failed to get Mono byte class!");
-                return false;
+                println("[CSE] Failed to decode PDB data for %s", scriptName.c_str());
+                if (error)
+                {
+                    *error = "invalid pdb";
+                }
+
+                return {};
             }
 
-            MonoArray* scriptArray = (MonoArray*)methods.array_new(info.m_Domain, byteClass, scriptData.size());
-            if (!scriptArray)
+            pdb = Payload(std::span<const uint8_t>(decodedPdb));
+        }
+
+        const Payload plain(image);
+
+        std::vector<FanOutResult> results(targets.size());
+        for (size_t i = 0; i < targets.size(); ++i)
+        {
+            results[i].m_Resource = targets[i].GetResourceName();
+        }
+
+        // the loads run on scheduler workers, a deadline the caller asked for has to go with them
+        auto deadline = ExecutionWatchdog::DeadlineScope::Current();
+
+        std::mutex mutex;
+        std::condition_variable finished;
+        size_t remaining = targets.size();
+
+        auto done = [&]()
+        {
+            std::lock_guard lock(mutex);
+            if (--remaining == 0)
             {
-                println("[CSE] Failed to create MonoArray for script data!");
-                return false;
+                finished.notify_all();
             }
+        };
+
+        log_info("[CSE] Fanning out %s to %zu runtimes", scriptName, targets.size());
+
+        // through each resource's domain queue, a target never loads while another execution runs in its domain
+        for (size_t i = 0; i < targets.size(); ++i)
+        {
+            bool posted = scheduler.Submit([&, i]()
+            {
+                ExecutionWatchdog::DeadlineScope deadlineScope(deadline);
+
+                const auto& info = targets[i];
+                auto& result = results[i];
+                auto started = clock::now();
+
+                s_LastExecution = 0;
+                {
+                    MonoScope scope(info.m_Domain);
+                    result.m_Success = Load(info, result.m_Resource, scriptName, plain, true, pdb);
+                }
+
+                result.m_Execution = s_LastExecution;
+                result.m_Outcome = result.m_Success ? ExecutionOutcome::Completed : s_LastOutcome;
+                result.m_ElapsedMs = std::chrono::duration<double, std::milli>(clock::now() - started).count();
+                done();
+            }, PriorityClass::Execution, clientId, DomainQueueKey(results[i].m_Resource));
 
-            for (size_t i = 0; i < scriptData.size(); ++i)
+            if (!posted)
             {
-                mono_array_set(scriptArray, uint8_t, i, scriptData[i]);
+                log_warn("[CSE] Scheduler is shutting down, %s is not loaded into %s", scriptName, results[i].m_Resource);
+                done();
             }
+        }
+
+        std::unique_lock lock(mutex);
+        finished.wait(lock, [&]() { return remaining == 0; });
+        return results;
+    }
+
+    bool Executor::Load(const RuntimeInfo& info, const std::string& resourceName, const std::string& scriptName,
+        const Payload& scriptData, bool validated, const std::optional<Payload>& pdbData)
+    {
+        static MonoMethods& methods = MonoMethods::GetInstance();
+        using clock = std::chrono::steady_clock;
+
+        s_LastOutcome = ExecutionOutcome::Failed;
+
+        // every return below is journaled, loads rejected before the constructor ran included
+        JournalEntry journal;
+        journal.m_Timestamp = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::system_clock::now().time_since_epoch()).count();
+        journal.m_Resource = resourceName;
+        journal.m_Script = scriptName;
+        journal.m_ImageSize = static_cast<uint32_t>(scriptData.m_Size);
+        journal.m_HasPdb = pdbData.has_value() && pdbData->m_Size != 0;
+        journal.m_Rejected = true;
+
+        auto loadStarted = clock::now();
+        auto finish = [&](bool success)
+        {
+            journal.m_TotalMs = std::chrono::duration<double, std::milli>(clock::now() - loadStarted).count();
+            ExecutionJournal::GetInstance().Append(journal);
+            return success;
+        };
+
+        MonoArray* scriptArray = CreateByteArray(info.m_Domain, scriptData);
+        if (!scriptArray)
+        {
+            println("[CSE] Failed to create MonoArray for script data!");
+            return finish(false);
+        }
+
+        // the array is referenced from this frame, the conservative scan keeps it in place while it is read
+        std::span<const uint8_t> image((const uint8_t*)methods.array_addr_with_size(scriptArray, sizeof(uint8_t), 0), scriptData.m_Size);
+        journal.m_Hash = Sha256::Of(image);
+
+        if (!validated && !ValidateImage(image))
+        {
+            return finish(false);
+        }
 
-            MonoArray* pdbArray = nullptr;
-            if (pdbData.has_value())
+        MonoArray* pdbArray = CreateByteArray(info.m_Domain, pdbData.value_or(Payload()));
+        if (!pdbArray)
+        {
+            println("[CSE] Failed to create MonoArray for PDB data!");
+            return finish(false);
+        }
+
+        journal.m_MarshalMs = std::chrono::duration<double, std::milli>(clock::now() - loadStarted).count();
+
+        uint64_t execution = m_NextExecution.fetch_add(1, std::memory_order_relaxed);
+        journal.m_Execution = execution;
+        ResultChannels::GetInstance().Open(execution, info.m_Domain, resourceName, scriptName);
+        OutputCapture::GetInstance().Attach(info.m_Domain, execution, resourceName);
+
+        // only the constructor run is measured, marshaling the image above isn't the script's doing
+        static auto& usage = UsageTracker::GetInstance();
+        auto window = usage.Begin();
+        auto started = clock::now();
+
+        // the constructor runs on a watchdog runner, a stuck one outlives this call so the task owns everything it uses.
+        // The arrays are pinned by handle rather than by this frame, which is gone once the deadline passes
+        std::shared_ptr<void> pins(nullptr, [handles = std::array{ methods.gchandle_new(scriptArray, 1), methods.gchandle_new(pdbArray, 1) }](void*)
+        {
+            for (uint32_t handle : handles)
+            {
+                MonoMethods::GetInstance().gchandle_free(handle);
+            }
+        });
+
+        auto assembly = std::make_shared<std::expected<MonoObject*, ManagedException>>(std::unexpected(ManagedException{ {}, "not run" }));
+
+        s_LastExecution = execution;
+        auto outcome = ExecutionWatchdog::GetInstance().Run(info.m_Domain, execution,
+            [pins, assembly, execution, method = info.m_CreateAssembly, domain = info.m_Domain, internal = info.m_CreateAssemblyInternal,
+                manager = info.m_InternalManager, scriptName, scriptArray, pdbArray]()
             {
-                pdbArray = (MonoArray*)methods.array_new(info.m_Domain, byteClass, pdbData->get().size());
-                if (!pdbArray)
+                s_CurrentExecution = execution;
+                if (method.IsValid())
                 {
-                    println("[CSE] Failed to create MonoArray for PDB data!");
-                    return false;
+                    *assembly = method.IsStatic() ? method(scriptName, scriptArray, pdbArray) : method.Invoke(manager, scriptName, scriptArray, pdbArray);
                 }
-
-                for (size_t i = 0; i < pdbData->get().size(); ++i)
+                else
                 {
-                    mono_array_set(pdbArray, uint8_t, i, pdbData->get()[i]);
+                    *assembly = InvokeCreateAssembly(domain, internal, manager, scriptName, scriptArray, pdbArray);
                 }
+
+                s_CurrentExecution = 0;
+            });
+
+        auto after = usage.Sample();
+        journal.m_RunMs = std::chrono::duration<double, std::milli>(clock::now() - started).count();
+        journal.m_HeapDelta = after.m_HeapUsed - window.m_Before.m_HeapUsed;
+        journal.m_Rejected = false;
+
+        usage.Record(execution, resourceName, scriptName, outcome == ExecutionOutcome::Completed && assembly->has_value(), window, after, journal.m_RunMs);
+
+        if (outcome == ExecutionOutcome::TimedOut)
+        {
+            s_LastOutcome = outcome;
+            journal.m_Outcome = outcome;
+            log_error("[CSE] Script %s in %s timed out", scriptName, resourceName);
+            return finish(false);
+        }
+
+        if (!assembly->has_value())
+        {
+            s_LastOutcome = ExecutionOutcome::Failed;
+            println("[CSE] Exception occurred while executing script!");
+            log_error("Mono Exception: %s", assembly->error().m_Message);
+            return finish(false);
+        }
+
+        s_LastOutcome = ExecutionOutcome::Completed;
+        journal.m_Outcome = ExecutionOutcome::Completed;
+
+        // CreateAssemblyInternal returns the loaded System.Reflection.Assembly
+        if (**assembly)
+        {
+            MonoAssembly* loaded = methods.reflection_assembly_get_assembly(**assembly);
+
+            // usually tracked while loading already, this covers loads from before the profiler was first started
+            ScriptProfiler::GetInstance().TrackImage(loaded ? methods.assembly_get_image(loaded) : nullptr);
+            JitWarmup::GetInstance().Schedule(info.m_Domain, loaded, resourceName);
+        }
+
+        log_debug("[CSE] Script executed successfully!");
+        return finish(true);
+    }
+
+    BundleResult Executor::ExecuteBundle(std::span<const BundleEntry> entries,
+        std::optional<std::reference_wrapper<const RuntimeInfo>> runtime)
+    {
+        static MonoMethods& methods = MonoMethods::GetInstance();
+
+        BundleResult result;
+        auto fail = [&](std::string error)
+        {
+            log_warn("[CSE] Bundle rejected: %s", error);
+            result.m_Error = std::move(error);
+            return result;
+        };
+
+        auto info = SelectRuntime(runtime);
+        if (!info.has_value())
+        {
+            return fail("no runtime available");
+        }
+
+        // encoded entries are decoded once, the metadata and the managed array are filled from the same bytes
+        std::vector<std::vector<uint8_t>> decoded;
+        std::vector<std::span<const uint8_t>> images(entries.size());
+        std::vector<AssemblyMetadata> assemblies(entries.size());
+        std::unordered_set<std::string_view> names;
+
+        for (size_t i = 0; i < entries.size(); ++i)
+        {
+            const auto& entry = entries[i];
+            if (entry.m_Image.m_Codec == Codec::None && !entry.m_Image.m_Producer)
+            {
+                images[i] = entry.m_Image.m_Data;
             }
             else
             {
-                pdbArray = (MonoArray*)methods.array_new(info.m_Domain, byteClass, 0);
-                if (!pdbArray)
-                {
-                    println("[CSE] Failed to create empty MonoArray for PDB data!");
-                    return false;
-                }
+                images[i] = decoded.emplace_back(entry.m_Image.Decode());
+            }
+
+            if (Sha256::Of(images[i]) != entry.m_Hash)
+            {
+                return fail("hash mismatch in bundle entry " + std::string(entry.m_Name));
+            }
+
+            const char* error = nullptr;
+            auto metadata = ReadAssemblyMetadata(images[i], &error);
+            if (!metadata.has_value() || !IsLoadableAssembly(*metadata, &error))
+            {
+                return fail("invalid image in bundle entry " + std::string(entry.m_Name) + ": " + error);
+            }
+
+            if (!names.insert(metadata->m_Name).second)
+            {
+                return fail("bundle contains " + std::string(metadata->m_Name) + " twice");
+            }
+
+            assemblies[i] = std::move(*metadata);
+        }
+
+        auto order = OrderByReferences(assemblies);
+        if (!order.has_value())
+        {
+            return fail("bundle entries reference each other in a cycle");
+        }
+
+        for (size_t index : *order)
+        {
+            BundleEntryResult entry;
+            entry.m_Name = assemblies[index].m_Name;
+            entry.m_Version = assemblies[index].m_Version.ToString();
+            entry.m_Hash = entries[index].m_Hash;
+            result.m_Entries.push_back(std::move(entry));
+        }
+
+        auto resourceName = info->GetResourceName();
+        log_info("[CSE] Loading a bundle of %zu assemblies in resource: %s", entries.size(), resourceName);
+
+        // one attach for the whole bundle, dependencies first so their references resolve against the loaded copies
+        MonoScope scope(info->m_Domain);
+
+        for (size_t i = 0; i < order->size(); ++i)
+        {
+            size_t index = (*order)[i];
+            auto& entry = result.m_Entries[i];
+
+            MonoAssemblyName* assemblyName = methods.assembly_name_new(entry.m_Name.c_str());
+            MonoAssembly* loaded = assemblyName ? methods.assembly_loaded(assemblyName) : nullptr;
+            if (assemblyName)
+            {
+                methods.assembly_name_free(assemblyName);
+                methods.free(assemblyName);
+            }
+
+            if (loaded)
+            {
+                log_debug("[CSE] %s is already loaded in resource: %s", entry.m_Name, resourceName);
+                entry.m_Status = BundleEntryStatus::AlreadyLoaded;
+                continue;
             }
 
-            MonoObject* exc = nullptr;
-            void* args[] = { name, scriptArray, pdbArray };
-            methods.runtime_invoke(info.m_CreateAssemblyInternal, info.m_InternalManager, args, &exc);
-            if (exc)
+            if (!Load(*info, resourceName, entry.m_Name, Payload(images[index]), true, entries[index].m_Pdb))
             {
-                println("[CSE] Exception occurred while executing script!");
-                methods.print_exception(exc);
-                return false;
+                entry.m_Status = BundleEntryStatus::Failed;
+                result.m_Error = (s_LastOutcome == ExecutionOutcome::TimedOut ? "timed out loading " : "failed to load ") + entry.m_Name;
+                return result;
             }
 
-            println("[CSE] Script executed successfully!");
-            return true;
+            entry.m_Status = BundleEntryStatus::Loaded;
         }
+
+        result.m_Success = true;
+        return result;
+    }
+
+    uint64_t Executor::CurrentExecutionId()
+    {
+        return s_CurrentExecution;
+    }
+
+    uint64_t Executor::LastExecutionId()
+    {
+        return s_LastExecution;
     }
 
-    const std::vector<RuntimeInfo>& Executor::GetRuntimes()
+    ExecutionOutcome Executor::LastOutcome()
     {
+        return s_LastOutcome;
+    }
+
+    std::vector<RuntimeInfo> Executor::GetRuntimes()
+    {
+        std::lock_guard lock(m_Mutex);
         FindRuntimes();
-        
-        std::vector<RuntimeInfo> validRuntimes;
-        for (const auto& runtime : m_Runtimes)
+        return m_Runtimes;
+    }
+
+    std::vector<RuntimeSnapshot> Executor::Snapshot()
+    {
+        static MonoMethods& methods = MonoMethods::GetInstance();
+
+        std::vector<RuntimeSnapshot> result;
+        for (const auto& runtime : GetRuntimes())
         {
-            auto it = std::find_if(validRuntimes.begin(), validRuntimes.end(), [&](const RuntimeInfo& r)
+            auto& snapshot = result.emplace_back();
+            snapshot.m_Resource = runtime.GetResourceName();
+
+            MonoScope scope(runtime.m_Domain);
+            if (const char* name = methods.domain_get_friendly_name(runtime.m_Domain))
             {
-                return r.GetResourceName() == runtime.GetResourceName();
-            });
+                snapshot.m_Domain = name;
+            }
+
+            if (auto assemblies = LoadedAssemblies(runtime.m_Domain))
+            {
+                snapshot.m_Assemblies = static_cast<int64_t>(assemblies->size());
+            }
+        }
+
+        return result;
+    }
+
+    std::optional<std::vector<MonoAssembly*>> Executor::LoadedAssemblies(MonoDomain* domain)
+    {
+        static MonoMethods& methods = MonoMethods::GetInstance();
+        static MonoClass* appDomainClass = methods.class_from_name(methods.get_corlib(), "System", "AppDomain");
+
+        // thunks are per domain, resolved on every call
+        auto currentDomain = ManagedMethod<MonoObject*()>::Resolve(domain, appDomainClass, "get_CurrentDomain");
+        auto getAssemblies = ManagedMethod<MonoArray*()>::Resolve(domain, appDomainClass, "GetAssemblies");
+
+        auto appDomain = currentDomain();
+        if (!appDomain.has_value() || !*appDomain)
+        {
+            return std::nullopt;
+        }
+
+        auto array = getAssemblies.Invoke(*appDomain);
+        if (!array.has_value() || !*array)
+        {
+            return std::nullopt;
+        }
+
+        // System.Reflection.Assembly objects, only their native assembly is kept
+        std::vector<MonoAssembly*> result;
+        uintptr_t count = methods.array_length(*array);
+        result.reserve(count);
+        for (uintptr_t i = 0; i < count; ++i)
+        {
+            auto* item = *static_cast<MonoObject**>(methods.array_addr_with_size(*array, sizeof(MonoObject*), i));
+            if (MonoAssembly* assembly = item ? methods.reflection_assembly_get_assembly(item) : nullptr)
+            {
+                result.push_back(assembly);
+            }
+        }
+
+        return result;
+    }
+
+    RuntimeChanges Executor::GetChangesSince(uint64_t epoch, uint64_t generation)
+    {
+        std::lock_guard lock(m_Mutex);
+        FindRuntimes();
+
+        RuntimeChanges changes;
+        changes.m_Epoch = m_Epoch;
+        changes.m_Generation = m_Generation;
 
-            if (it != validRuntimes.end())
+        // a generation from another injection means nothing here, even if the number matches
+        if (epoch == m_Epoch && generation == m_Generation)
+        {
+            return changes;
+        }
+
+        bool known = epoch == m_Epoch && generation != 0 && generation < m_Generation && !m_History.empty() && m_History.front().m_Generation <= generation + 1;
+        if (!known)
+        {
+            changes.m_Full = true;
+            for (const auto& runtime : m_Runtimes)
             {
+                changes.m_Added.push_back(runtime.m_ResourceName);
+            }
+
+            return changes;
+        }
+
+        // fold every delta newer than the client's generation, a runtime added and removed in between cancels out
+        for (const auto& delta : m_History)
+        {
+            if (delta.m_Generation <= generation)
                 continue;
+
+            for (const auto& name : delta.m_Removed)
+            {
+                auto it = std::find(changes.m_Added.begin(), changes.m_Added.end(), name);
+                if (it != changes.m_Added.end())
+                    changes.m_Added.erase(it);
+                else
+                    changes.m_Removed.push_back(name);
             }
 
-            if (runtime.m_Domain && runtime.m_InternalManager && runtime.m_CreateAssemblyInternal && runtime.GetResourceName().length() > 0)
+            for (const auto& name : delta.m_Added)
             {
-                println("[CSE] Found valid runtime in resource: %s", runtime.GetResourceName().c_str());
-                validRuntimes.push_back(runtime);
+                auto it = std::find(changes.m_Removed.begin(), changes.m_Removed.end(), name);
+                if (it != changes.m_Removed.end())
+                    changes.m_Removed.erase(it);
+                else
+                    changes.m_Added.push_back(name);
             }
         }
 
-        m_Runtimes = std::move(validRuntimes);
-        return m_Runtimes;
+        return changes;
+    }
+
+    std::optional<RuntimeInfo> Executor::ProbeRuntime(MonoDomain* domain, const char** error)
+    {
+        static MonoMethods& methods = MonoMethods::GetInstance();
+
+        MonoObject* manager = FindInternalManager(domain, error);
+        if (!manager)
+        {
+            return std::nullopt;
+        }
+
+        RuntimeInfo info;
+        info.m_Domain = domain;
+        info.m_DomainId = methods.domain_get_id(domain);
+        info.m_InternalManager = manager;
+
+        {
+            MonoScope scope(domain);
+
+            MonoClass* internalManagerClass = methods.object_get_class(manager);
+            if (!internalManagerClass)
+            {
+                *error = "Failed to get InternalManager class";
+                return std::nullopt;
+            }
+
+            MonoMethod* createAssemblyMethod = methods.class_get_method_from_name(internalManagerClass, "CreateAssemblyInternal", 3);
+            if (!createAssemblyMethod)
+            {
+                *error = "Failed to get InternalManager.CreateAssemblyInternal method";
+                return std::nullopt;
+            }
+
+            info.m_CreateAssemblyInternal = createAssemblyMethod;
+            // without unmanaged thunks the load falls back to runtime_invoke
+            info.m_CreateAssembly = { domain, createAssemblyMethod };
+            if (!info.m_CreateAssembly.IsValid() && methods.supports(MonoFeature::UnmanagedThunks))
+            {
+                *error = "Failed to get a thunk for InternalManager.CreateAssemblyInternal";
+                return std::nullopt;
+            }
+        }
+
+        info.m_ResourceName = info.GetResourceName();
+        if (info.m_ResourceName.empty())
+        {
+            *error = "InternalManager has no resource name";
+            return std::nullopt;
+        }
+
+        return info;
     }
 
     void Executor::FindRuntimes()
     {
-        auto managers = FindAllInternalManagers();
+        static MonoMethods& methods = MonoMethods::GetInstance();
+
+        auto domains = EnumerateDomains();
+        std::unordered_set<MonoDomain*> alive(domains.begin(), domains.end());
 
-        for (const auto& [manager, domain] : managers)
+        GenerationDelta delta{};
+
+        auto removed = std::remove_if(m_Runtimes.begin(), m_Runtimes.end(), [&](const RuntimeInfo& runtime)
         {
-            RuntimeInfo info;
-            info.m_Domain = domain;
-            info.m_InternalManager = manager;
+            return !alive.contains(runtime.m_Domain) || methods.domain_get_id(runtime.m_Domain) != runtime.m_DomainId;
+        });
 
-            static MonoMethods& methods = MonoMethods::GetInstance();
+        for (auto it = removed; it != m_Runtimes.end(); ++it)
+        {
+            println("[CSE] Runtime of resource %s is gone", it->m_ResourceName.c_str());
+            OutputCapture::GetInstance().Detach(it->m_DomainId);
+            FieldLayout::Forget(it->m_DomainId);
+            delta.m_Removed.push_back(it->m_ResourceName);
+        }
+
+        m_Runtimes.erase(removed, m_Runtimes.end());
+
+        std::erase_if(m_Rejected, [&](const auto& rejected)
+        {
+            return !alive.contains(rejected.first);
+        });
+
+        auto now = std::chrono::steady_clock::now();
+
+        for (MonoDomain* domain : domains)
+        {
+            bool known = std::any_of(m_Runtimes.begin(), m_Runtimes.end(), [&](const RuntimeInfo& r)
             {
-                MonoScope scope(domain);
+                return r.m_Domain == domain;
+            });
+
+            if (known)
+            {
+                continue;
+            }
 
-                MonoClass* internalManagerClass = methods.object_get_class(manager);
-                if (!internalManagerClass)
+            // an address can be reused by a later domain, the id can't
+            int32_t id = methods.domain_get_id(domain);
+            auto rejected = m_Rejected.find(domain);
+            if (rejected != m_Rejected.end() && rejected->second.m_Id != id)
+            {
+                m_Rejected.erase(rejected);
+                rejected = m_Rejected.end();
+            }
+
+            if (rejected != m_Rejected.end() && now < rejected->second.m_Retry)
+            {
+                continue;
+            }
+
+            const char* error = "unknown";
+            auto info = ProbeRuntime(domain, &error);
+            if (!info.has_value())
+            {
+                // the manager is created some time after the domain, so a rejected domain is probed again later
+                if (rejected == m_Rejected.end() || rejected->second.m_Reason != error)
                 {
-                    println("[CSE] Failed to get InternalManager class!");
-                    continue;
+                    log_debug("[CSE] Domain %d (%s) is not a runtime: %s", id, methods.domain_get_friendly_name(domain), error);
                 }
 
-                MonoMethod* createAssemblyMethod = methods.class_get_method_from_name(internalManagerClass, "CreateAssemblyInternal", 3);
-                if (!createAssemblyMethod)
+                m_Rejected[domain] = { id, error, now + REPROBE_INTERVAL };
+                continue;
+            }
+
+            bool duplicate = std::any_of(m_Runtimes.begin(), m_Runtimes.end(), [&](const RuntimeInfo& r)
+            {
+                return r.m_ResourceName == info->m_ResourceName;
+            });
+
+            // cached like any other rejection, otherwise the domain would be probed again on every refresh
+            if (duplicate)
+            {
+                static constexpr const char* DUPLICATE_RESOURCE = "duplicate resource";
+                if (rejected == m_Rejected.end() || rejected->second.m_Reason != DUPLICATE_RESOURCE)
                 {
-                    println("[CSE] Failed to get InternalManager.CreateAssemblyInternal method!");
-                    continue;
+                    log_debug("[CSE] Domain %d (%s) is not a runtime: %s", id, methods.domain_get_friendly_name(domain), DUPLICATE_RESOURCE);
                 }
 
-                info.m_CreateAssemblyInternal = createAssemblyMethod;
+                m_Rejected[domain] = { id, DUPLICATE_RESOURCE, now + REPROBE_INTERVAL };
+                continue;
             }
 
-            m_Runtimes.push_back(info);
+            m_Rejected.erase(domain);
+
+            log_debug("[CSE] Found valid runtime in resource: %s", info->m_ResourceName);
+            delta.m_Added.push_back(info->m_ResourceName);
+            m_Runtimes.push_back(std::move(*info));
+        }
+
+        if (delta.m_Added.empty() && delta.m_Removed.empty())
+        {
+            return;
+        }
+
+        delta.m_Generation = ++m_Generation;
+        m_History.push_back(std::move(delta));
+
+        while (m_History.size() > MAX_HISTORY)
+        {
+            m_History.pop_front();
         }
     }
 }
\ No newline at end of file
@@ -0,0 +1,358 @@
+#include <cse/fields.hpp>
+#include <cse/log.hpp>
+#include <cse/utf8.hpp>
+#include <map>
+#include <mutex>
+
+namespace cse
+{
+    namespace
+    {
+        struct ResolvedField
+        {
+            uint32_t m_Offset = 0;
+            int m_ElementType = 0;
+            bool m_Reference = false;
+        };
+
+        // per (domain id, class), field name to offset, a domain's entries are dropped by Forget when it goes away
+        using CacheKey = std::pair<int32_t, MonoClass*>;
+
+        std::mutex s_CacheMutex;
+        std::map<CacheKey, std::map<std::string, ResolvedField, std::less<>>> s_Cache;
+    }
+
+    const char* FieldTypeName(FieldType type)
+    {
+        switch (type)
+        {
+        case FieldType::Bool: return "bool";
+        case FieldType::Char: return "char";
+        case FieldType::Int8: return "sbyte";
+        case FieldType::UInt8: return "byte";
+        case FieldType::Int16: return "short";
+        case FieldType::UInt16: return "ushort";
+        case FieldType::Int32: return "int";
+        case FieldType::UInt32: return "uint";
+        case FieldType::Int64: return "long";
+        case FieldType::UInt64: return "ulong";
+        case FieldType::Single: return "float";
+        case FieldType::Double: return "double";
+        case FieldType::IntPtr: return "IntPtr";
+        case FieldType::String: return "string";
+        case FieldType::Object: return "object";
+        }
+
+        return "unknown";
+    }
+
+    static bool Matches(FieldType type, const ResolvedField& field)
+    {
+        switch (type)
+        {
+        case FieldType::Bool: return field.m_ElementType == MONO_TYPE_BOOLEAN;
+        case FieldType::Char: return field.m_ElementType == MONO_TYPE_CHAR;
+        case FieldType::Int8: return field.m_ElementType == MONO_TYPE_I1;
+        case FieldType::UInt8: return field.m_ElementType == MONO_TYPE_U1;
+        case FieldType::Int16: return field.m_ElementType == MONO_TYPE_I2;
+        case FieldType::UInt16: return field.m_ElementType == MONO_TYPE_U2;
+        case FieldType::Int32: return field.m_ElementType == MONO_TYPE_I4;
+        case FieldType::UInt32: return field.m_ElementType == MONO_TYPE_U4;
+        case FieldType::Int64: return field.m_ElementType == MONO_TYPE_I8;
+        case FieldType::UInt64: return field.m_ElementType == MONO_TYPE_U8;
+        case FieldType::Single: return field.m_ElementType == MONO_TYPE_R4;
+        case FieldType::Double: return field.m_ElementType == MONO_TYPE_R8;
+        case FieldType::IntPtr: return field.m_ElementType == MONO_TYPE_I || field.m_ElementType == MONO_TYPE_U;
+        case FieldType::String: return field.m_ElementType == MONO_TYPE_STRING;
+        case FieldType::Object: return field.m_Reference;
+        }
+
+        return false;
+    }
+
+    static size_t ValueSize(FieldType type)
+    {
+        switch (type)
+        {
+        case FieldType::Bool:
+        case FieldType::Int8:
+        case FieldType::UInt8: return 1;
+        case FieldType::Char:
+        case FieldType::Int16:
+        case FieldType::UInt16: return 2;
+        case FieldType::Int32:
+        case FieldType::UInt32:
+        case FieldType::Single:
+        case FieldType::Object: return 4;
+        case FieldType::Int64:
+        case FieldType::UInt64:
+        case FieldType::Double: return 8;
+        case FieldType::IntPtr: return sizeof(intptr_t);
+        case FieldType::String: return sizeof(std::string);
+        }
+
+        return 0;
+    }
+
+    static std::optional<ResolvedField> ResolveField(MonoClass* klass, std::string_view name)
+    {
+        static auto& methods = MonoMethods::GetInstance();
+
+        // the thread is attached to the class's domain
+        MonoDomain* domain = methods.domain_get();
+        CacheKey cacheKey(domain ? methods.domain_get_id(domain) : -1, klass);
+
+        {
+            std::lock_guard lock(s_CacheMutex);
+            auto& fields = s_Cache[cacheKey];
+            auto it = fields.find(name);
+            if (it != fields.end())
+            {
+                return it->second;
+            }
+        }
+
+        std::string key(name);
+        MonoField* field = methods.class_get_field_from_name(klass, key.c_str());
+        if (!field)
+        {
+            log_error("[Fields] %s.%s has no field %s", methods.class_get_namespace(klass), methods.class_get_name(klass), key);
+            return std::nullopt;
+        }
+
+        if (methods.field_get_flags(field) & FIELD_ATTRIBUTE_STATIC)
+        {
+            log_error("[Fields] %s.%s.%s is static", methods.class_get_namespace(klass), methods.class_get_name(klass), key);
+            return std::nullopt;
+        }
+
+        MonoType* type = methods.field_get_type(field);
+
+        ResolvedField resolved;
+        resolved.m_Offset = methods.field_get_offset(field);
+        resolved.m_ElementType = methods.type_get_type(type);
+        resolved.m_Reference = methods.type_is_reference(type);
+
+        std::lock_guard lock(s_CacheMutex);
+        s_Cache[cacheKey].try_emplace(std::move(key), resolved);
+        return resolved;
+    }
+
+    static void AssignUtf8(std::string& out, MonoString* str)
+    {
+        static auto& methods = MonoMethods::GetInstance();
+
+        out.clear();
+        if (str)
+        {
+            AppendUtf8(out, { methods.string_chars(str), static_cast<size_t>(methods.string_length(str)) });
+        }
+    }
+
+    std::optional<FieldLayout> FieldLayout::Resolve(MonoClass* klass, std::span<const FieldSpec> fields)
+    {
+        static auto& methods = MonoMethods::GetInstance();
+
+        if (!klass)
+        {
+            return std::nullopt;
+        }
+
+        FieldLayout layout;
+        layout.m_Class = klass;
+        layout.m_Offsets.reserve(fields.size());
+        layout.m_Types.reserve(fields.size());
+
+        for (const auto& spec : fields)
+        {
+            auto field = ResolveField(klass, spec.m_Name);
+            if (!field.has_value())
+            {
+                return std::nullopt;
+            }
+
+            if (!Matches(spec.m_Type, *field))
+            {
+                log_error("[Fields] %s.%s.%s can't be read as %s (element type 0x%02x)", methods.class_get_namespace(klass),
+                    methods.class_get_name(klass), spec.m_Name, FieldTypeName(spec.m_Type), field->m_ElementType);
+                return std::nullopt;
+            }
+
+            layout.m_Offsets.push_back(field->m_Offset);
+            layout.m_Types.push_back(spec.m_Type);
+        }
+
+        return layout;
+    }
+
+    void FieldLayout::Forget(int32_t domainId)
+    {
+        std::lock_guard lock(s_CacheMutex);
+        s_Cache.erase(s_Cache.lower_bound(CacheKey(domainId, nullptr)), s_Cache.lower_bound(CacheKey(domainId + 1, nullptr)));
+    }
+
+    size_t FieldLayout::ReadRows(std::span<const uint32_t> handles, void* rows, size_t rowSize, std::span<const size_t> memberOffsets) const
+    {
+        if (memberOffsets.size() != m_Offsets.size())
+        {
+            return 0;
+        }
+
+        std::vector<Target> targets;
+        targets.reserve(memberOffsets.size());
+        for (size_t offset : memberOffsets)
+        {
+            targets.push_back({ static_cast<uint8_t*>(rows) + offset, rowSize });
+        }
+
+        return ReadHandles(handles, targets);
+    }
+
+    size_t FieldLayout::ReadColumns(std::span<const uint32_t> handles, std::span<void* const> columns) const
+    {
+        if (columns.size() != m_Offsets.size())
+        {
+            return 0;
+        }
+
+        std::vector<Target> targets;
+        targets.reserve(columns.size());
+        for (size_t i = 0; i < columns.size(); ++i)
+        {
+            targets.push_back({ static_cast<uint8_t*>(columns[i]), ValueSize(m_Types[i]) });
+        }
+
+        return ReadHandles(handles, targets);
+    }
+
+    bool FieldLayout::ReadRow(MonoObject* obj, void* row, std::span<const size_t> memberOffsets) const
+    {
+        if (memberOffsets.size() != m_Offsets.size())
+        {
+            return false;
+        }
+
+        std::vector<Target> targets;
+        targets.reserve(memberOffsets.size());
+        for (size_t offset : memberOffsets)
+        {
+            targets.push_back({ static_cast<uint8_t*>(row) + offset, 0 });
+        }
+
+        if (!ReadObject(obj, targets, 0))
+        {
+            ClearRow(targets, 0);
+            return false;
+        }
+
+        return true;
+    }
+
+    std::optional<std::string> FieldLayout::ReadString(MonoObject* obj, size_t field) const
+    {
+        // any other field would be dereferenced as a MonoString*
+        if (field >= m_Types.size() || m_Types[field] != FieldType::String)
+        {
+            log_error("[Fields] Field %zu is not a string field", field);
+            return std::nullopt;
+        }
+
+        MonoString* str = Read<MonoString*>(obj, field);
+        if (!str)
+        {
+            return std::nullopt;
+        }
+
+        std::string text;
+        AssignUtf8(text, str);
+        return text;
+    }
+
+    size_t FieldLayout::ReadHandles(std::span<const uint32_t> handles, std::span<const Target> targets) const
+    {
+        static auto& methods = MonoMethods::GetInstance();
+
+        size_t read = 0;
+        for (size_t row = 0; row < handles.size(); ++row)
+        {
+            // resolved right before use and only ever held here, a collection can't move it mid-read
+            MonoObject* obj = handles[row] ? methods.gchandle_get_target(handles[row]) : nullptr;
+            if (ReadObject(obj, targets, row))
+            {
+                read++;
+            }
+            else
+            {
+                ClearRow(targets, row);
+            }
+        }
+
+        return read;
+    }
+
+    bool FieldLayout::ReadObject(MonoObject* obj, std::span<const Target> targets, size_t row) const
+    {
+        static auto& methods = MonoMethods::GetInstance();
+
+        if (!obj)
+        {
+            return false;
+        }
+
+        // subclasses share the base layout
+        if (methods.object_get_class(obj) != m_Class && !methods.object_isinst(obj, m_Class))
+        {
+            return false;
+        }
+
+        const uint8_t* base = static_cast<const uint8_t*>(obj);
+        for (size_t i = 0; i < targets.size(); ++i)
+        {
+            uint8_t* out = targets[i].m_Base + row * targets[i].m_Stride;
+            const uint8_t* in = base + m_Offsets[i];
+
+            switch (m_Types[i])
+            {
+            case FieldType::Bool:
+                *reinterpret_cast<bool*>(out) = *in != 0;
+                break;
+            case FieldType::String:
+            {
+                MonoString* str;
+                std::memcpy(&str, in, sizeof(str));
+                AssignUtf8(*reinterpret_cast<std::string*>(out), str);
+                break;
+            }
+            case FieldType::Object:
+            {
+                MonoObject* ref;
+                std::memcpy(&ref, in, sizeof(ref));
+                uint32_t handle = ref ? methods.gchandle_new(ref, 0) : 0;
+                std::memcpy(out, &handle, sizeof(handle));
+                break;
+            }
+            default:
+                std::memcpy(out, in, ValueSize(m_Types[i]));
+                break;
+            }
+        }
+
+        return true;
+    }
+
+    void FieldLayout::ClearRow(std::span<const Target> targets, size_t row) const
+    {
+        for (size_t i = 0; i < targets.size(); ++i)
+        {
+            uint8_t* out = targets[i].m_Base + row * targets[i].m_Stride;
+            if (m_Types[i] == FieldType::String)
+            {
+                reinterpret_cast<std::string*>(out)->clear();
+            }
+            else
+            {
+                std::memset(out, 0, ValueSize(m_Types[i]));
+            }
+        }
+    }
+}
\ No newline at end of file
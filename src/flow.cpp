@@ -3,64 +3,91 @@
 
 namespace cse
 {
-    std::vector<std::pair<MonoObject*, MonoDomain*>> FindAllInternalManagers()
+    MonoObject* FindInternalManager(MonoDomain* domain, const char** error)
     {
         static auto& mono = MonoMethods::GetInstance();
-        std::vector<std::pair<MonoObject*, MonoDomain*>> managers;
 
-        auto callback = [](MonoDomain* domain, void* user_data)
+        auto fail = [error](const char* reason) -> MonoObject*
         {
-            static auto& mono = MonoMethods::GetInstance();
-            auto& managers = *reinterpret_cast<std::vector<std::pair<MonoObject*, MonoDomain*>>*>(user_data);
-
-            MonoScope scope(domain);
-            MonoAssembly* assembly = mono.domain_open_assembly(domain, "CitizenFX.Core");
-            if (!assembly)
+            if (error)
             {
-                println("[CSE] Failed to open CitizenFX.Core assembly in domain\n");
-                return;
+                *error = reason;
             }
-
-            MonoImage* image = mono.assembly_get_image(assembly);
-            if (!image)
+            else
             {
-                println("[CSE] Failed to get CitizenFX.Core image\n");
-                return;
+                println("[CSE] %s", reason);
             }
 
-            MonoClass* klass = mono.class_from_name(image, "CitizenFX.Core", "InternalManager");
-            if (!klass)
-            {
-                println("[CSE] Failed to find InternalManager class\n");
-                return;
-            }
+            return nullptr;
+        };
 
-            MonoField* field = mono.class_get_field_from_name(klass, "<GlobalManager>k__BackingField");
-            if (!field)
-            {
-                println("[CSE] Failed to find GlobalManager field\n");
-                return;
-            }
+        MonoScope scope(domain);
+        MonoAssembly* assembly = mono.domain_open_assembly(domain, "CitizenFX.Core");
+        if (!assembly)
+        {
+            return fail("Failed to open CitizenFX.Core assembly in domain");
+        }
 
-            void* vtable = mono.class_vtable(domain, klass);
-            if (!vtable)
-            {
-                println("[CSE] Failed to get vtable for InternalManager\n");
-                return;
-            }
+        MonoImage* image = mono.assembly_get_image(assembly);
+        if (!image)
+        {
+            return fail("Failed to get CitizenFX.Core image");
+        }
 
-            void* fieldValue = nullptr;
-            mono.field_static_get_value(vtable, field, &fieldValue);
-            if (!fieldValue)
-            {
-                println("[CSE] GlobalManager field is null\n");
-                return;
-            }
+        MonoClass* klass = mono.class_from_name(image, "CitizenFX.Core", "InternalManager");
+        if (!klass)
+        {
+            return fail("Failed to find InternalManager class");
+        }
+
+        MonoField* field = mono.class_get_field_from_name(klass, "<GlobalManager>k__BackingField");
+        if (!field)
+        {
+            return fail("Failed to find GlobalManager field");
+        }
+
+        void* vtable = mono.class_vtable(domain, klass);
+        if (!vtable)
+        {
+            return fail("Failed to get vtable for InternalManager");
+        }
+
+        void* fieldValue = nullptr;
+        mono.field_static_get_value(vtable, field, &fieldValue);
+        if (!fieldValue)
+        {
+            return fail("GlobalManager field is null");
+        }
+
+        return (MonoObject*)fieldValue;
+    }
 
-            managers.emplace_back((MonoObject*)fieldValue, domain);
+    std::vector<MonoDomain*> EnumerateDomains()
+    {
+        static auto& mono = MonoMethods::GetInstance();
+        std::vector<MonoDomain*> domains;
+
+        auto callback = [](MonoDomain* domain, void* user_data)
+        {
+            reinterpret_cast<std::vector<MonoDomain*>*>(user_data)->push_back(domain);
         };
 
-        mono.domain_foreach(callback, &managers);
+        mono.domain_foreach(callback, &domains);
+
+        return domains;
+    }
+
+    std::vector<std::pair<MonoObject*, MonoDomain*>> FindAllInternalManagers()
+    {
+        std::vector<std::pair<MonoObject*, MonoDomain*>> managers;
+
+        for (MonoDomain* domain : EnumerateDomains())
+        {
+            if (MonoObject* manager = FindInternalManager(domain))
+            {
+                managers.emplace_back(manager, domain);
+            }
+        }
 
         return managers;
     }
@@ -0,0 +1,2535 @@
+#include <cse/handlers.hpp>
+#include <cse/entry.hpp>
+#include <cse/console.hpp>
+#include <cse/log.hpp>
+#include <cse/executor.hpp>
+#include <cse/blob_cache.hpp>
+#include <cse/delta.hpp>
+#include <cse/watcher.hpp>
+#include <cse/store.hpp>
+#include <cse/warmup.hpp>
+#include <cse/metadata.hpp>
+#include <cse/mapped_file.hpp>
+#include <cse/results.hpp>
+#include <cse/compiler.hpp>
+#include <cse/usage.hpp>
+#include <cse/watchdog.hpp>
+#include <cse/introspection.hpp>
+#include <cse/capture.hpp>
+#include <cse/profiler.hpp>
+#include <cse/journal.hpp>
+#include <cse/wildcard.hpp>
+#include <fstream>
+#include <filesystem>
+#include <chrono>
+#include <cstring>
+#include <algorithm>
+#include <stdexcept>
+#include <unordered_map>
+
+namespace cse
+{
+    std::string random_string(size_t length)
+    {
+        const std::string characters = "abcdefghijklmnopqrstuvwxyzABCDEFGHIJKLMNOPQRSTUVWXYZ0123456789";
+        std::string result;
+        result.reserve(length);
+
+        for (size_t i = 0; i < length; ++i)
+        {
+            result += characters[rand() % characters.size()];
+        }
+
+        return result;
+    }
+
+    nlohmann::json ListResources()
+    {
+        return nlohmann::json::array();
+    }
+
+    nlohmann::json ListResourcesWithRuntimes()
+    {
+        static auto& executor = Executor::GetInstance();
+
+        nlohmann::json result = nlohmann::json::array();
+
+        for (const auto& runtime : executor.GetRuntimes())
+        {
+            nlohmann::json item = nlohmann::json::object();
+            item["resource"] = runtime.GetResourceName();
+            result.push_back(item);
+        }
+
+        return result;
+    }
+
+    // conditional variant: the client sends the last epoch and generation it has seen and gets only what changed
+    nlohmann::json ListResourcesWithRuntimes(uint64_t epoch, uint64_t generation)
+    {
+        static auto& executor = Executor::GetInstance();
+
+        auto changes = executor.GetChangesSince(epoch, generation);
+
+        nlohmann::json result = nlohmann::json::object();
+        result["epoch"] = changes.m_Epoch;
+        result["generation"] = changes.m_Generation;
+
+        if (!changes.IsModified())
+        {
+            result["not_modified"] = true;
+            return result;
+        }
+
+        nlohmann::json added = nlohmann::json::array();
+        for (const auto& name : changes.m_Added)
+        {
+            nlohmann::json item = nlohmann::json::object();
+            item["resource"] = name;
+            added.push_back(item);
+        }
+
+        if (changes.m_Full)
+        {
+            result["full"] = true;
+            result["resources"] = std::move(added);
+        }
+        else
+        {
+            result["added"] = std::move(added);
+            result["removed"] = changes.m_Removed;
+        }
+
+        return result;
+    }
+
+    nlohmann::json CreateRuntime(const std::string& resource)
+    {
+        return nlohmann::json::object();
+    }
+
+    std::optional<std::vector<uint8_t>> DecodeBase64(const std::string& text)
+    {
+        static constexpr auto decodeChar = [](char c) -> int
+        {
+            if (c >= 'A' && c <= 'Z') return c - 'A';
+            if (c >= 'a' && c <= 'z') return c - 'a' + 26;
+            if (c >= '0' && c <= '9') return c - '0' + 52;
+            if (c == '+') return 62;
+            if (c == '/') return 63;
+            return -1;
+        };
+
+        std::vector<uint8_t> result;
+        result.reserve(text.size() / 4 * 3);
+
+        uint32_t accumulator = 0;
+        int bits = 0;
+        for (char c : text)
+        {
+            if (c == '=')
+                break;
+
+            int value = decodeChar(c);
+            if (value < 0)
+                return std::nullopt;
+
+            accumulator = (accumulator << 6) | value;
+            bits += 6;
+
+            if (bits >= 8)
+            {
+                bits -= 8;
+                result.push_back(static_cast<uint8_t>(accumulator >> bits));
+            }
+        }
+
+        return result;
+    }
+
+    // binary fields arrive as MessagePack bin in msgpack frames or as base64 text in JSON frames
+    std::optional<std::vector<uint8_t>> GetBinary(const nlohmann::json& value)
+    {
+        if (value.is_binary())
+        {
+            return std::vector<uint8_t>(value.get_binary().begin(), value.get_binary().end());
+        }
+
+        if (value.is_string())
+        {
+            return DecodeBase64(value.get<std::string>());
+        }
+
+        return std::nullopt;
+    }
+
+    std::optional<std::vector<uint8_t>> ReadFileBytes(const std::string& path)
+    {
+        std::ifstream file(path, std::ios::binary);
+        if (!file)
+        {
+            return std::nullopt;
+        }
+
+        return std::vector<uint8_t>((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+    }
+
+    // files may be raw assemblies or packed blobs (see PackBlob), the latter are decoded straight into the managed array
+    Payload PayloadFromBytes(const std::vector<uint8_t>& bytes)
+    {
+        if (auto blob = UnpackBlob(bytes))
+        {
+            return *blob;
+        }
+
+        return Payload(bytes);
+    }
+
+    // remembers what we executed so later uploads can be sent as deltas against it
+    Hash256 CacheExecutedPayload(const Payload& script)
+    {
+        static auto& cache = BlobCache::GetInstance();
+
+        if (script.m_Codec == Codec::None && !script.m_Producer)
+        {
+            return cache.Put(script.m_Data);
+        }
+
+        return cache.Put(script.Decode());
+    }
+
+    // blobs known by hash, from the in-memory cache or the on-disk store
+    std::optional<std::vector<uint8_t>> LoadKnownBlob(const Hash256& hash)
+    {
+        if (auto cached = BlobCache::GetInstance().Get(hash))
+        {
+            return cached;
+        }
+
+        if (auto stored = AssemblyStore::GetInstance().GetImage(hash))
+        {
+            return stored->m_Payload.Decode();
+        }
+
+        return std::nullopt;
+    }
+
+    nlohmann::json DescribeAssembly(const AssemblyMetadata& metadata, bool types)
+    {
+        nlohmann::json references = nlohmann::json::array();
+        for (const auto& reference : metadata.m_References)
+        {
+            references.push_back({ { "name", reference.m_Name }, { "version", reference.m_Version.ToString() } });
+        }
+
+        nlohmann::json result = {
+            { "name", metadata.m_Name },
+            { "version", metadata.m_Version.ToString() },
+            { "culture", metadata.m_Culture },
+            { "runtime", metadata.m_RuntimeVersion },
+            { "references", std::move(references) },
+            { "typeCount", metadata.m_Types.size() },
+        };
+
+        if (types)
+        {
+            nlohmann::json names = nlohmann::json::array();
+            for (const auto& type : metadata.m_Types)
+            {
+                names.push_back(type.m_Namespace.empty() ? std::string(type.m_Name) : std::string(type.m_Namespace) + "." + std::string(type.m_Name));
+            }
+
+            result["types"] = std::move(names);
+        }
+
+        return result;
+    }
+
+    void StoreExecutedPayload(const Hash256& hash, const std::string& name, const Payload& script, const std::optional<Payload>& pdb, const std::string& resource)
+    {
+        static auto& store = AssemblyStore::GetInstance();
+
+        if (store.Contains(hash))
+        {
+            store.Touch(hash, resource);
+            return;
+        }
+
+        auto image = script.Decode();
+
+        // unnamed uploads are listed under their assembly name
+        std::string storedName = name;
+        if (storedName.empty())
+        {
+            if (auto metadata = ReadAssemblyMetadata(image))
+            {
+                storedName = metadata->m_Name;
+            }
+        }
+
+        std::optional<std::vector<uint8_t>> pdbBytes;
+        if (pdb.has_value())
+        {
+            pdbBytes = pdb->Decode();
+        }
+
+        store.Put(hash, storedName, image, pdbBytes ? std::optional<std::span<const uint8_t>>(*pdbBytes) : std::nullopt, resource);
+    }
+
+    // deadline_ms of execution requests, overrides the watchdog's default for loads made while handling them
+    std::optional<std::chrono::milliseconds> RequestDeadline(const nlohmann::json& request)
+    {
+        if (!request.contains("deadline_ms"))
+        {
+            return std::nullopt;
+        }
+
+        return std::chrono::milliseconds(request["deadline_ms"].get<int64_t>());
+    }
+
+    // typed requests fail as a whole on a field that is present but unusable, the registry replies { "error": what }
+    std::vector<uint8_t> RequireBinary(const nlohmann::json& json, const char* key, const char* error)
+    {
+        auto data = GetBinary(json.at(key));
+        if (!data.has_value())
+        {
+            throw std::invalid_argument(error);
+        }
+
+        return std::move(*data);
+    }
+
+    Hash256 RequireHash(const nlohmann::json& json, const char* key)
+    {
+        auto hash = HashFromHex(json.at(key).get<std::string>());
+        if (!hash.has_value())
+        {
+            throw std::invalid_argument("invalid hash");
+        }
+
+        return *hash;
+    }
+
+    // { script, codec?, size?, pdb?, pdbSize? }, sizes are checked with HasValidSize before anything is allocated
+    struct InlineUpload
+    {
+        Codec m_Codec = Codec::None;
+        std::vector<uint8_t> m_Script;
+        size_t m_Size = 0;
+        std::optional<std::vector<uint8_t>> m_Pdb;
+        size_t m_PdbSize = 0;
+
+        Payload GetScript() const
+        {
+            return Payload(m_Script, m_Codec, m_Size);
+        }
+
+        std::optional<Payload> GetPdb() const
+        {
+            return m_Pdb ? std::optional<Payload>(Payload(*m_Pdb, m_Codec, m_PdbSize)) : std::nullopt;
+        }
+    };
+
+    void from_json(const nlohmann::json& json, InlineUpload& upload)
+    {
+        auto codec = CodecFromName(json.value("codec", std::string()));
+        if (!codec.has_value())
+        {
+            throw std::invalid_argument("unknown codec");
+        }
+
+        upload.m_Codec = *codec;
+        upload.m_Script = RequireBinary(json, "script", "invalid inline script data");
+        if (upload.m_Script.empty())
+        {
+            throw std::invalid_argument("invalid inline script data");
+        }
+
+        upload.m_Size = json.value("size", upload.m_Script.size());
+        if (json.contains("pdb"))
+        {
+            upload.m_Pdb = RequireBinary(json, "pdb", "invalid inline pdb data");
+            upload.m_PdbSize = json.value("pdbSize", upload.m_Pdb->size());
+        }
+    }
+
+    nlohmann::json UsageJson(const ExecutionUsage& usage)
+    {
+        return {
+            { "heap_delta", usage.m_HeapDelta },
+            { "heap_after", usage.m_HeapAfter },
+            { "minor_collections", usage.m_MinorCollections },
+            { "major_collections", usage.m_MajorCollections },
+            { "methods_compiled", usage.m_MethodsCompiled },
+            { "jit_ms", usage.m_JitMs },
+            { "elapsed_ms", usage.m_ElapsedMs },
+            { "shared", usage.m_Shared },
+        };
+    }
+
+    nlohmann::json ExecuteInResource(const std::string& resource, const Payload& script, std::optional<Payload> pdb = std::nullopt, bool cache = true, const std::string& name = {})
+    {
+        static auto& executor = Executor::GetInstance();
+
+        nlohmann::json result = nlohmann::json::object();
+        result["success"] = false;
+
+        // plain images are rejected before a runtime is even looked up, the executor checks encoded ones after decoding
+        if (script.m_Codec == Codec::None && !script.m_Producer)
+        {
+            const char* error = nullptr;
+            auto metadata = ReadAssemblyMetadata(script.m_Data, &error);
+            if (!metadata.has_value() || !IsLoadableAssembly(*metadata, &error))
+            {
+                result["error"] = std::string("invalid image: ") + error;
+                return result;
+            }
+
+            result["assembly"] = DescribeAssembly(*metadata, false);
+        }
+
+        for (const cse::RuntimeInfo& runtime : executor.GetRuntimes())
+        {
+            if (runtime.GetResourceName() == resource)
+            {
+                auto randomName = random_string(8);
+                bool executed = executor.Execute(randomName, script, pdb, std::cref(runtime));
+
+                // results the script emits through CseHost are read with results_read
+                result["execution"] = Executor::LastExecutionId();
+                if (auto usage = UsageTracker::GetInstance().Find(Executor::LastExecutionId()))
+                {
+                    result["usage"] = UsageJson(*usage);
+                }
+
+                auto outcome = executed ? ExecutionOutcome::Completed : Executor::LastOutcome();
+                result["outcome"] = ExecutionOutcomeName(outcome);
+                if (outcome == ExecutionOutcome::TimedOut)
+                {
+                    result["error"] = "timed out";
+                }
+
+                if (executed)
+                {
+                    log_debug("[ExecuteInResource] Successfully executed script in resource: %s", resource);
+                    result["success"] = true;
+
+                    if (cache)
+                    {
+                        auto hash = CacheExecutedPayload(script);
+                        StoreExecutedPayload(hash, name, script, pdb, resource);
+                        result["hash"] = ToHex(hash);
+                    }
+                }
+                else
+                {
+                    log_warn("[ExecuteInResource] Failed to execute script in resource: %s", resource);
+                }
+
+                result["size"] = script.m_Size;
+                result["transferred"] = script.m_Data.size();
+                return result;
+            }
+        }
+
+        result["error"] = "resource not found";
+        return result;
+    }
+
+    // { resource, deadline_ms?, name?, scriptFilePath | inline upload }
+    struct ExecuteInResourceRequest
+    {
+        std::string m_Resource;
+        std::optional<std::chrono::milliseconds> m_Deadline;
+        std::string m_Name;
+        std::optional<std::string> m_ScriptFilePath;
+        std::optional<InlineUpload> m_Upload;
+    };
+
+    void from_json(const nlohmann::json& json, ExecuteInResourceRequest& request)
+    {
+        json.at("resource").get_to(request.m_Resource);
+        request.m_Deadline = RequestDeadline(json);
+        request.m_Name = json.value("name", std::string());
+
+        if (json.contains("scriptFilePath"))
+        {
+            request.m_ScriptFilePath = json.at("scriptFilePath").get<std::string>();
+        }
+        else
+        {
+            request.m_Upload = json.get<InlineUpload>();
+        }
+    }
+
+    nlohmann::json ExecuteInResource(const ExecuteInResourceRequest& request)
+    {
+        ExecutionWatchdog::DeadlineScope deadline(request.m_Deadline);
+        const auto& resource = request.m_Resource;
+
+        if (request.m_ScriptFilePath.has_value())
+        {
+            const auto& scriptFilePath = *request.m_ScriptFilePath;
+
+            auto scriptData = ReadFileBytes(scriptFilePath);
+            if (!scriptData.has_value())
+            {
+                println("[ExecuteInResource] Failed to open script file: %s", scriptFilePath.c_str());
+                return { { "error", "failed to open script file" } };
+            }
+
+            if (scriptData->empty())
+            {
+                println("[ExecuteInResource] Script file is empty: %s", scriptFilePath.c_str());
+                return { { "error", "script file is empty" } };
+            }
+
+            auto name = std::filesystem::path(scriptFilePath).filename().string();
+            return ExecuteInResource(resource, PayloadFromBytes(*scriptData), std::nullopt, true, name);
+        }
+
+        auto script = request.m_Upload->GetScript();
+        if (!script.HasValidSize())
+        {
+            return { { "error", "script size out of range" } };
+        }
+
+        auto pdb = request.m_Upload->GetPdb();
+        if (pdb.has_value() && !pdb->HasValidSize())
+        {
+            return { { "error", "pdb size out of range" } };
+        }
+
+        return ExecuteInResource(resource, script, pdb, true, request.m_Name);
+    }
+
+    // { resource, deadline_ms?, scriptFilePath | bundle }, a main assembly and its libraries in one transfer
+    struct ExecuteBundleRequest
+    {
+        std::string m_Resource;
+        std::optional<std::chrono::milliseconds> m_Deadline;
+        std::optional<std::string> m_ScriptFilePath;
+        std::vector<uint8_t> m_Bundle;
+    };
+
+    void from_json(const nlohmann::json& json, ExecuteBundleRequest& request)
+    {
+        json.at("resource").get_to(request.m_Resource);
+        request.m_Deadline = RequestDeadline(json);
+
+        if (json.contains("scriptFilePath"))
+        {
+            request.m_ScriptFilePath = json.at("scriptFilePath").get<std::string>();
+        }
+        else
+        {
+            request.m_Bundle = RequireBinary(json, "bundle", "invalid bundle data");
+        }
+    }
+
+    nlohmann::json ExecuteBundle(const ExecuteBundleRequest& request)
+    {
+        ExecutionWatchdog::DeadlineScope deadline(request.m_Deadline);
+        static auto& executor = Executor::GetInstance();
+
+        const auto& resource = request.m_Resource;
+
+        // the mapping or upload backs every entry view until the loads are done
+        std::unique_ptr<MappedFile> file;
+        std::span<const uint8_t> bundle = request.m_Bundle;
+
+        if (request.m_ScriptFilePath.has_value())
+        {
+            file = MappedFile::OpenRead(std::filesystem::path(*request.m_ScriptFilePath));
+            if (!file)
+            {
+                return { { "success", false }, { "error", "failed to open bundle file" } };
+            }
+
+            bundle = file->GetData();
+        }
+
+        const char* error = nullptr;
+        auto entries = ReadBundle(bundle, &error);
+        if (!entries.has_value())
+        {
+            return { { "success", false }, { "error", error } };
+        }
+
+        auto runtimes = executor.GetRuntimes();
+        auto runtime = std::find_if(runtimes.begin(), runtimes.end(), [&](const RuntimeInfo& info) { return info.GetResourceName() == resource; });
+        if (runtime == runtimes.end())
+        {
+            return { { "success", false }, { "error", "resource not found" } };
+        }
+
+        auto result = executor.ExecuteBundle(*entries, std::cref(*runtime));
+
+        nlohmann::json items = nlohmann::json::array();
+        for (const auto& entry : result.m_Entries)
+        {
+            items.push_back({
+                { "name", entry.m_Name },
+                { "version", entry.m_Version },
+                { "hash", ToHex(entry.m_Hash) },
+                { "status", BundleEntryStatusName(entry.m_Status) },
+            });
+
+            if (entry.m_Status == BundleEntryStatus::Loaded)
+            {
+                auto source = std::find_if(entries->begin(), entries->end(), [&](const BundleEntry& item) { return item.m_Hash == entry.m_Hash; });
+                StoreExecutedPayload(entry.m_Hash, entry.m_Name, source->m_Image, source->m_Pdb, resource);
+            }
+        }
+
+        nlohmann::json reply = { { "success", result.m_Success }, { "entries", std::move(items) }, { "transferred", bundle.size() } };
+        if (!result.m_Error.empty())
+        {
+            reply["error"] = result.m_Error;
+        }
+
+        return reply;
+    }
+
+    // { targets: "all" | [resource...] | { pattern }, scriptFilePath | script (codec?, size?) | hash, pdb?, name? }
+    struct ExecuteFanOutRequest
+    {
+        std::optional<std::chrono::milliseconds> m_Deadline;
+        std::string m_Name;
+        std::optional<std::string> m_ScriptFilePath;
+        std::optional<Hash256> m_Hash;
+        std::optional<InlineUpload> m_Upload;
+
+        bool m_All = false;
+        std::vector<std::string> m_Resources;
+        std::optional<std::string> m_Pattern;
+
+        bool Matches(const std::string& resource) const
+        {
+            if (m_Pattern.has_value())
+            {
+                return MatchWildcard<char>(*m_Pattern, resource);
+            }
+
+            return m_All || std::find(m_Resources.begin(), m_Resources.end(), resource) != m_Resources.end();
+        }
+    };
+
+    void from_json(const nlohmann::json& json, ExecuteFanOutRequest& request)
+    {
+        request.m_Deadline = RequestDeadline(json);
+        request.m_Name = json.value("name", std::string());
+
+        const auto& targets = json.at("targets");
+        if (targets.is_string() && targets.get<std::string>() == "all")
+        {
+            request.m_All = true;
+        }
+        else if (targets.is_array())
+        {
+            targets.get_to(request.m_Resources);
+        }
+        else if (targets.is_object())
+        {
+            request.m_Pattern = targets.at("pattern").get<std::string>();
+        }
+        else
+        {
+            throw std::invalid_argument("invalid targets");
+        }
+
+        if (json.contains("scriptFilePath"))
+        {
+            request.m_ScriptFilePath = json.at("scriptFilePath").get<std::string>();
+        }
+        else if (json.contains("hash"))
+        {
+            request.m_Hash = RequireHash(json, "hash");
+        }
+        else
+        {
+            request.m_Upload = json.get<InlineUpload>();
+        }
+    }
+
+    nlohmann::json ExecuteFanOut(const ExecuteFanOutRequest& request)
+    {
+        ExecutionWatchdog::DeadlineScope deadline(request.m_Deadline);
+        static auto& executor = Executor::GetInstance();
+        static auto& store = AssemblyStore::GetInstance();
+
+        // whatever backs the payload has to outlive every load
+        std::unique_ptr<MappedFile> file;
+        std::optional<StoredPayload> stored;
+        std::optional<Hash256> storedHash = request.m_Hash;
+        Payload script;
+        std::optional<Payload> pdb;
+        std::string name = request.m_Name;
+
+        if (request.m_ScriptFilePath.has_value())
+        {
+            const auto& path = *request.m_ScriptFilePath;
+            file = MappedFile::OpenRead(std::filesystem::path(path));
+            if (!file)
+            {
+                return { { "success", false }, { "error", "failed to open script file" } };
+            }
+
+            script = UnpackBlob(file->GetData()).value_or(Payload(std::span<const uint8_t>(file->GetData())));
+            if (name.empty())
+            {
+                name = std::filesystem::path(path).filename().string();
+            }
+        }
+        else if (storedHash.has_value())
+        {
+            stored = store.GetImage(*storedHash);
+            if (!stored.has_value())
+            {
+                return { { "success", false }, { "error", "unknown hash" } };
+            }
+
+            script = stored->m_Payload;
+        }
+        else
+        {
+            script = request.m_Upload->GetScript();
+            if (!script.HasValidSize())
+            {
+                return { { "success", false }, { "error", "script size out of range" } };
+            }
+
+            pdb = request.m_Upload->GetPdb();
+            if (pdb.has_value() && !pdb->HasValidSize())
+            {
+                return { { "success", false }, { "error", "pdb size out of range" } };
+            }
+        }
+
+        // one scan of the runtimes for all targets
+        std::vector<RuntimeInfo> selected;
+        for (auto& runtime : executor.GetRuntimes())
+        {
+            if (request.Matches(runtime.GetResourceName()))
+            {
+                selected.push_back(std::move(runtime));
+            }
+        }
+
+        if (selected.empty())
+        {
+            return { { "success", false }, { "error", "no matching runtimes" } };
+        }
+
+        using clock = std::chrono::steady_clock;
+        auto started = clock::now();
+
+        auto randomName = random_string(8);
+        const char* error = "invalid image";
+        auto results = executor.ExecuteFanOut(randomName, script, pdb, selected, CommandRegistry::CurrentClientId(), &error);
+        if (results.empty())
+        {
+            return { { "success", false }, { "error", error } };
+        }
+
+        auto elapsed = std::chrono::duration<double, std::milli>(clock::now() - started).count();
+
+        std::optional<Hash256> hash = storedHash;
+        size_t succeeded = 0;
+        nlohmann::json items = nlohmann::json::array();
+        for (const auto& result : results)
+        {
+            items.push_back({
+                { "resource", result.m_Resource },
+                { "success", result.m_Success },
+                { "execution", result.m_Execution },
+                { "outcome", ExecutionOutcomeName(result.m_Outcome) },
+                { "elapsed_ms", result.m_ElapsedMs },
+            });
+
+            if (auto usage = UsageTracker::GetInstance().Find(result.m_Execution))
+            {
+                items.back()["usage"] = UsageJson(*usage);
+            }
+
+            if (!result.m_Success)
+            {
+                continue;
+            }
+
+            succeeded++;
+
+            // stored images already carry their hash and stay where they are
+            if (stored.has_value())
+            {
+                store.Touch(*storedHash, result.m_Resource);
+                continue;
+            }
+
+            if (!hash.has_value())
+            {
+                hash = CacheExecutedPayload(script);
+            }
+
+            StoreExecutedPayload(*hash, name, script, pdb, result.m_Resource);
+        }
+
+        nlohmann::json reply = {
+            { "success", succeeded == results.size() },
+            { "succeeded", succeeded },
+            { "elapsed_ms", elapsed },
+            { "results", std::move(items) },
+        };
+
+        if (hash.has_value())
+        {
+            reply["hash"] = ToHex(*hash);
+        }
+
+        return reply;
+    }
+
+    // { execution, cursor?, max_bytes?, wait_ms? }, long polls for records emitted after cursor
+    struct ResultsReadRequest
+    {
+        uint64_t m_Execution = 0;
+        uint64_t m_Cursor = 0;
+        size_t m_MaxBytes = 256 * 1024;
+        std::chrono::milliseconds m_Wait{ 0 };
+    };
+
+    void from_json(const nlohmann::json& json, ResultsReadRequest& request)
+    {
+        json.at("execution").get_to(request.m_Execution);
+        request.m_Cursor = json.value("cursor", request.m_Cursor);
+        request.m_MaxBytes = json.value("max_bytes", request.m_MaxBytes);
+        request.m_Wait = std::chrono::milliseconds(std::clamp(json.value("wait_ms", 0), 0, 30000));
+    }
+
+    nlohmann::json ResultsRead(const ResultsReadRequest& request)
+    {
+        auto execution = request.m_Execution;
+
+        auto batch = ResultChannels::GetInstance().Read(execution, request.m_Cursor, request.m_MaxBytes, request.m_Wait);
+        if (!batch.has_value())
+        {
+            return { { "error", "unknown execution" } };
+        }
+
+        nlohmann::json records = nlohmann::json::array();
+        for (auto& record : batch->m_Records)
+        {
+            records.push_back({
+                { "sequence", record.m_Sequence },
+                { "time_us", record.m_Timestamp },
+                { "key", std::move(record.m_Key) },
+                { "payload", nlohmann::json::binary(std::move(record.m_Payload)) },
+            });
+        }
+
+        return {
+            { "execution", execution },
+            { "cursor", batch->m_Cursor },
+            { "skipped", batch->m_Skipped },
+            { "records", std::move(records) },
+        };
+    }
+
+    nlohmann::json ResultsList()
+    {
+        nlohmann::json result = nlohmann::json::array();
+        for (const auto& channel : ResultChannels::GetInstance().List())
+        {
+            result.push_back({
+                { "execution", channel.m_Execution },
+                { "resource", channel.m_Resource },
+                { "assembly", channel.m_Assembly },
+                { "emitted", channel.m_Emitted },
+                { "dropped", channel.m_Dropped },
+                { "written", channel.m_Written },
+            });
+        }
+
+        return result;
+    }
+
+    // { scriptFilePath | script, codec?, size?, types? }, reads the manifest without executing anything
+    struct InspectAssemblyRequest
+    {
+        std::optional<std::string> m_ScriptFilePath;
+        std::optional<InlineUpload> m_Upload;
+        bool m_Types = false;
+    };
+
+    void from_json(const nlohmann::json& json, InspectAssemblyRequest& request)
+    {
+        request.m_Types = json.value("types", false);
+
+        if (json.contains("scriptFilePath"))
+        {
+            request.m_ScriptFilePath = json.at("scriptFilePath").get<std::string>();
+        }
+        else
+        {
+            request.m_Upload = json.get<InlineUpload>();
+        }
+    }
+
+    nlohmann::json InspectAssembly(const InspectAssemblyRequest& request)
+    {
+        std::unique_ptr<MappedFile> file;
+        std::optional<std::vector<uint8_t>> data;
+        std::span<const uint8_t> image;
+
+        if (request.m_ScriptFilePath.has_value())
+        {
+            // raw images are parsed in place, packed blobs have to be decoded first
+            file = MappedFile::OpenRead(std::filesystem::path(*request.m_ScriptFilePath));
+            if (!file)
+            {
+                return { { "error", "failed to open script file" } };
+            }
+
+            image = file->GetData();
+            if (auto blob = UnpackBlob(image))
+            {
+                data = blob->Decode();
+                image = *data;
+            }
+        }
+        else
+        {
+            image = request.m_Upload->m_Script;
+            if (request.m_Upload->m_Codec != Codec::None)
+            {
+                auto payload = request.m_Upload->GetScript();
+                if (!payload.HasValidSize())
+                {
+                    return { { "error", "script size out of range" } };
+                }
+
+                data = payload.Decode();
+                image = *data;
+            }
+        }
+
+        const char* error = nullptr;
+        auto metadata = ReadAssemblyMetadata(image, &error);
+        if (!metadata.has_value())
+        {
+            return { { "error", std::string("invalid image: ") + error } };
+        }
+
+        auto result = DescribeAssembly(*metadata, request.m_Types);
+        result["loadable"] = IsLoadableAssembly(*metadata, &error);
+        if (!result["loadable"].get<bool>())
+        {
+            result["reason"] = error;
+        }
+
+        return result;
+    }
+
+    // { hash, blockSize? }
+    struct GetSignaturesRequest
+    {
+        Hash256 m_Hash;
+        size_t m_BlockSize = DELTA_DEFAULT_BLOCK_SIZE;
+    };
+
+    void from_json(const nlohmann::json& json, GetSignaturesRequest& request)
+    {
+        request.m_Hash = RequireHash(json, "hash");
+        request.m_BlockSize = json.value("blockSize", request.m_BlockSize);
+    }
+
+    nlohmann::json GetSignatures(const GetSignaturesRequest& request)
+    {
+
+        auto base = LoadKnownBlob(request.m_Hash);
+        if (!base.has_value())
+        {
+            return { { "error", "unknown hash" } };
+        }
+
+        size_t blockSize = request.m_BlockSize;
+        if (blockSize < DELTA_MIN_BLOCK_SIZE || blockSize > DELTA_MAX_BLOCK_SIZE)
+        {
+            return { { "error", "block size out of range" } };
+        }
+
+        auto signatures = ComputeSignatures(*base, blockSize);
+
+        // columnar, compact in both JSON and MessagePack
+        nlohmann::json weak = nlohmann::json::array();
+        nlohmann::json strong = nlohmann::json::array();
+        for (const auto& signature : signatures)
+        {
+            weak.push_back(signature.m_Weak);
+            strong.push_back(signature.m_Strong);
+        }
+
+        nlohmann::json result = nlohmann::json::object();
+        result["hash"] = ToHex(request.m_Hash);
+        result["size"] = base->size();
+        result["blockSize"] = blockSize;
+        result["weak"] = std::move(weak);
+        result["strong"] = std::move(strong);
+        return result;
+    }
+
+    // { resource, base, blockSize, hash, name?, ops: [ { copy, count } | { data } ] }
+    struct ExecuteDeltaRequest
+    {
+        std::string m_Resource;
+        std::optional<std::chrono::milliseconds> m_Deadline;
+        std::string m_Name;
+        Hash256 m_Base;
+        Hash256 m_Hash;
+        size_t m_BlockSize = 0;
+        std::vector<DeltaOp> m_Ops;
+    };
+
+    void from_json(const nlohmann::json& json, ExecuteDeltaRequest& request)
+    {
+        json.at("resource").get_to(request.m_Resource);
+        request.m_Deadline = RequestDeadline(json);
+        request.m_Name = json.value("name", std::string());
+        request.m_Base = RequireHash(json, "base");
+        request.m_Hash = RequireHash(json, "hash");
+        json.at("blockSize").get_to(request.m_BlockSize);
+
+        for (const auto& item : json.at("ops"))
+        {
+            DeltaOp op;
+            if (item.contains("copy"))
+            {
+                op.m_Block = item.at("copy").get<uint32_t>();
+                op.m_Count = item.value("count", 1u);
+                if (op.m_Count == 0)
+                {
+                    throw std::invalid_argument("empty copy");
+                }
+            }
+            else
+            {
+                op.m_Literal = RequireBinary(item, "data", "invalid literal");
+            }
+
+            request.m_Ops.push_back(std::move(op));
+        }
+    }
+
+    nlohmann::json ExecuteDelta(const ExecuteDeltaRequest& request)
+    {
+        ExecutionWatchdog::DeadlineScope deadline(request.m_Deadline);
+        static auto& cache = BlobCache::GetInstance();
+
+        const auto& resource = request.m_Resource;
+
+        auto base = LoadKnownBlob(request.m_Base);
+        if (!base.has_value())
+        {
+            return { { "success", false }, { "error", "unknown base" } };
+        }
+
+        // the same bounds the signatures were handed out with
+        size_t blockSize = request.m_BlockSize;
+        if (blockSize < DELTA_MIN_BLOCK_SIZE || blockSize > DELTA_MAX_BLOCK_SIZE)
+        {
+            return { { "success", false }, { "error", "block size out of range" } };
+        }
+
+        const auto& ops = request.m_Ops;
+
+        size_t transferred = 0;
+        for (const auto& op : ops)
+        {
+            transferred += op.m_Literal.size();
+        }
+
+        auto size = DeltaOutputSize(base->size(), blockSize, ops);
+        if (!size.has_value())
+        {
+            return { { "success", false }, { "error", "delta references blocks outside the base" } };
+        }
+
+        // rebuilt directly into the managed byte[], verified before CreateAssemblyInternal ever sees it
+        std::vector<uint8_t> rebuilt;
+        Payload script;
+        script.m_Size = *size;
+        script.m_Producer = [&](std::span<uint8_t> dst) -> bool
+        {
+            if (!ApplyDelta(*base, blockSize, ops, dst))
+            {
+                println("[ExecuteDelta] Failed to apply delta");
+                return false;
+            }
+
+            if (Sha256::Of(dst) != request.m_Hash)
+            {
+                println("[ExecuteDelta] Rebuilt image hash mismatch");
+                return false;
+            }
+
+            // only cached once it completed, a failed rebuild target must not become a delta base
+            rebuilt.assign(dst.begin(), dst.end());
+            return true;
+        };
+
+        auto result = ExecuteInResource(resource, script, std::nullopt, false);
+        if (result.value("success", false) && !rebuilt.empty())
+        {
+            cache.Put(request.m_Hash, rebuilt);
+            AssemblyStore::GetInstance().Put(request.m_Hash, request.m_Name, rebuilt, std::nullopt, resource);
+        }
+
+        result["hash"] = ToHex(request.m_Hash);
+        result["transferred"] = transferred;
+        return result;
+    }
+
+    // { resource, hash }, runs an assembly from the on-disk store without the client sending it again
+    struct ExecuteByHashRequest
+    {
+        std::string m_Resource;
+        std::optional<std::chrono::milliseconds> m_Deadline;
+        Hash256 m_Hash;
+    };
+
+    void from_json(const nlohmann::json& json, ExecuteByHashRequest& request)
+    {
+        json.at("resource").get_to(request.m_Resource);
+        request.m_Deadline = RequestDeadline(json);
+        request.m_Hash = RequireHash(json, "hash");
+    }
+
+    nlohmann::json ExecuteByHash(const ExecuteByHashRequest& request)
+    {
+        ExecutionWatchdog::DeadlineScope deadline(request.m_Deadline);
+        static auto& store = AssemblyStore::GetInstance();
+
+        const auto& resource = request.m_Resource;
+
+        // the mappings stay alive until the execution is done, the image is decoded straight from them
+        auto image = store.GetImage(request.m_Hash);
+        if (!image.has_value())
+        {
+            return { { "success", false }, { "error", "unknown hash" } };
+        }
+
+        auto pdb = store.GetPdb(request.m_Hash);
+
+        auto result = ExecuteInResource(resource, image->m_Payload, pdb ? std::optional<Payload>(pdb->m_Payload) : std::nullopt, false);
+        if (result.value("success", false))
+        {
+            store.Touch(request.m_Hash, resource);
+        }
+
+        result["hash"] = ToHex(request.m_Hash);
+        result["transferred"] = 0;
+        return result;
+    }
+
+    // { resource, source, references?, arguments?, debug?, name? }, compiles C# and runs it like an uploaded image
+    struct ExecuteSourceRequest
+    {
+        std::string m_Resource;
+        std::optional<std::chrono::milliseconds> m_Deadline;
+        std::string m_Name;
+        CompileRequest m_Compile;
+    };
+
+    void from_json(const nlohmann::json& json, ExecuteSourceRequest& request)
+    {
+        json.at("resource").get_to(request.m_Resource);
+        request.m_Deadline = RequestDeadline(json);
+        request.m_Name = json.value("name", std::string());
+
+        json.at("source").get_to(request.m_Compile.m_Source);
+        request.m_Compile.m_References = json.value("references", std::vector<std::string>());
+        request.m_Compile.m_Arguments = json.value("arguments", std::vector<std::string>());
+        request.m_Compile.m_Debug = json.value("debug", false);
+    }
+
+    nlohmann::json ExecuteSource(const ExecuteSourceRequest& request)
+    {
+        ExecutionWatchdog::DeadlineScope deadline(request.m_Deadline);
+        using clock = std::chrono::steady_clock;
+
+        const auto& resource = request.m_Resource;
+
+        auto compiled = SourceCompiler::GetInstance().Compile(request.m_Compile);
+
+        nlohmann::json compileInfo = {
+            { "key", ToHex(compiled.m_Key) },
+            { "cached", compiled.m_Cached },
+            { "compile_ms", compiled.m_CompileMs },
+        };
+
+        if (!compiled.m_Cached)
+        {
+            compileInfo["exit_code"] = compiled.m_ExitCode;
+            compileInfo["output"] = compiled.m_Output;
+        }
+
+        if (!compiled.m_Success)
+        {
+            return { { "success", false }, { "error", "compilation failed" }, { "compile", std::move(compileInfo) } };
+        }
+
+        std::optional<Payload> pdb;
+        if (compiled.m_Pdb)
+        {
+            pdb = Payload(std::span<const uint8_t>(compiled.m_Pdb->GetData()));
+        }
+
+        auto started = clock::now();
+        auto result = ExecuteInResource(resource, Payload(std::span<const uint8_t>(compiled.m_Image->GetData())), pdb, true, request.m_Name);
+
+        result["execute_ms"] = std::chrono::duration<double, std::milli>(clock::now() - started).count();
+        result["compile"] = std::move(compileInfo);
+        return result;
+    }
+
+    // { compiler?, references?, cache_directory?, timeout_ms? }
+    struct CompilerConfigRequest
+    {
+        std::optional<std::string> m_Compiler;
+        std::optional<std::vector<std::string>> m_References;
+        std::optional<std::string> m_CacheDirectory;
+        std::optional<std::chrono::milliseconds> m_Timeout;
+    };
+
+    void from_json(const nlohmann::json& json, CompilerConfigRequest& request)
+    {
+        if (json.contains("compiler"))
+        {
+            request.m_Compiler = json["compiler"].get<std::string>();
+        }
+
+        if (json.contains("references"))
+        {
+            request.m_References = json["references"].get<std::vector<std::string>>();
+        }
+
+        if (json.contains("cache_directory"))
+        {
+            request.m_CacheDirectory = json["cache_directory"].get<std::string>();
+        }
+
+        if (json.contains("timeout_ms"))
+        {
+            request.m_Timeout = std::chrono::milliseconds(json["timeout_ms"].get<int64_t>());
+        }
+    }
+
+    nlohmann::json CompilerConfig(const CompilerConfigRequest& request)
+    {
+        static auto& compiler = SourceCompiler::GetInstance();
+
+        auto options = compiler.GetOptions();
+        if (request.m_Compiler.has_value())
+        {
+            options.m_Compiler = *request.m_Compiler;
+        }
+
+        if (request.m_References.has_value())
+        {
+            options.m_References = *request.m_References;
+        }
+
+        if (request.m_CacheDirectory.has_value())
+        {
+            options.m_CacheDirectory = *request.m_CacheDirectory;
+        }
+
+        options.m_Timeout = request.m_Timeout.value_or(options.m_Timeout);
+        compiler.SetOptions(options);
+
+        auto stats = compiler.GetStats();
+        return {
+            { "compiler", options.m_Compiler.string() },
+            { "references", options.m_References },
+            { "cache_directory", options.m_CacheDirectory.string() },
+            { "timeout_ms", options.m_Timeout.count() },
+            { "compiled", stats.m_Compiled },
+            { "hits", stats.m_Hits },
+            { "failed", stats.m_Failed },
+        };
+    }
+
+    nlohmann::json StoreList()
+    {
+        nlohmann::json entries = nlohmann::json::array();
+        for (const auto& entry : AssemblyStore::GetInstance().List())
+        {
+            entries.push_back({
+                { "hash", ToHex(entry.m_Hash) },
+                { "name", entry.m_Name },
+                { "size", entry.m_Size },
+                { "stored_size", entry.m_StoredSize },
+                { "pdb", entry.m_HasPdb },
+                { "created", entry.m_Created },
+                { "last_used", entry.m_LastUsed },
+                { "uses", entry.m_UseCount },
+                { "resources", entry.m_Resources },
+            });
+        }
+
+        return entries;
+    }
+
+    // { directory?, budget_mb?, codec? }
+    struct StoreConfigRequest
+    {
+        std::optional<std::string> m_Directory;
+        std::optional<uint64_t> m_BudgetMb;
+        std::optional<Codec> m_Codec;
+    };
+
+    void from_json(const nlohmann::json& json, StoreConfigRequest& request)
+    {
+        if (json.contains("directory"))
+        {
+            request.m_Directory = json["directory"].get<std::string>();
+        }
+
+        if (json.contains("budget_mb"))
+        {
+            request.m_BudgetMb = json["budget_mb"].get<uint64_t>();
+        }
+
+        if (json.contains("codec"))
+        {
+            request.m_Codec = CodecFromName(json["codec"].get<std::string>());
+            if (!request.m_Codec.has_value())
+            {
+                throw std::invalid_argument("unknown codec");
+            }
+        }
+    }
+
+    nlohmann::json StoreConfig(const StoreConfigRequest& request)
+    {
+        static auto& store = AssemblyStore::GetInstance();
+
+        if (request.m_Directory.has_value() && !store.Open(*request.m_Directory))
+        {
+            return { { "error", "failed to open store" } };
+        }
+
+        if (request.m_BudgetMb.has_value())
+        {
+            store.SetBudget(*request.m_BudgetMb * 1024 * 1024);
+        }
+
+        if (request.m_Codec.has_value())
+        {
+            store.SetCodec(*request.m_Codec);
+        }
+
+        auto stats = store.GetStats();
+        return {
+            { "directory", stats.m_Directory.string() },
+            { "entries", stats.m_Entries },
+            { "bytes", stats.m_Bytes },
+            { "budget", stats.m_Budget },
+            { "evicted", stats.m_Evicted },
+        };
+    }
+
+    // { hash }
+    struct StoreRemoveRequest
+    {
+        Hash256 m_Hash;
+    };
+
+    void from_json(const nlohmann::json& json, StoreRemoveRequest& request)
+    {
+        request.m_Hash = RequireHash(json, "hash");
+    }
+
+    // compares LZ4 against a plain copy on a payload built by repeating a sample assembly up to the requested size
+    nlohmann::json BenchmarkCodec(const std::vector<uint8_t>& sample, size_t size)
+    {
+        using clock = std::chrono::steady_clock;
+
+        // nothing to repeat, the fill below would never make progress
+        if (sample.empty())
+        {
+            return { { "error", "empty sample" } };
+        }
+
+        std::vector<uint8_t> data;
+        data.reserve(size);
+        while (data.size() < size)
+        {
+            size_t chunk = std::min(sample.size(), size - data.size());
+            data.insert(data.end(), sample.begin(), sample.begin() + chunk);
+        }
+
+        auto seconds = [](clock::time_point start)
+        {
+            return std::chrono::duration<double>(clock::now() - start).count();
+        };
+
+        auto start = clock::now();
+        auto compressed = Compress(Codec::Lz4, data);
+        double compressTime = seconds(start);
+
+        std::vector<uint8_t> destination(data.size());
+
+        start = clock::now();
+        bool ok = Decompress(Codec::Lz4, compressed, destination);
+        double decompressTime = seconds(start);
+
+        ok = ok && destination == data;
+
+        start = clock::now();
+        std::memcpy(destination.data(), data.data(), data.size());
+        double copyTime = seconds(start);
+
+        double megabytes = data.size() / (1024.0 * 1024.0);
+
+        nlohmann::json result = nlohmann::json::object();
+        result["ok"] = ok;
+        result["size"] = data.size();
+        result["compressed_size"] = compressed.size();
+        result["ratio"] = data.empty() ? 0.0 : double(compressed.size()) / data.size();
+        result["compress_mbps"] = compressTime > 0 ? megabytes / compressTime : 0.0;
+        result["decompress_mbps"] = decompressTime > 0 ? megabytes / decompressTime : 0.0;
+        result["copy_mbps"] = copyTime > 0 ? megabytes / copyTime : 0.0;
+
+        // what a receiver holds at peak: wire buffer plus the decoded image
+        result["peak_bytes_raw"] = data.size() * 2;
+        result["peak_bytes_lz4"] = data.size() + compressed.size();
+        return result;
+    }
+
+    struct ListResourcesWithRuntimesRequest
+    {
+        // last generation seen by the client, 0 = none, nullopt = legacy array reply
+        std::optional<uint64_t> m_Generation;
+
+        // epoch the generation came from, a missing one never matches
+        uint64_t m_Epoch = 0;
+    };
+
+    void from_json(const nlohmann::json& json, ListResourcesWithRuntimesRequest& request)
+    {
+        if (json.contains("generation"))
+        {
+            request.m_Generation = json.at("generation").get<uint64_t>();
+        }
+
+        if (json.contains("epoch"))
+        {
+            request.m_Epoch = json.at("epoch").get<uint64_t>();
+        }
+    }
+
+    struct CreateRuntimeRequest
+    {
+        std::string m_Resource;
+    };
+
+    void from_json(const nlohmann::json& json, CreateRuntimeRequest& request)
+    {
+        json.at("resource").get_to(request.m_Resource);
+    }
+
+    struct CodecBenchmarkRequest
+    {
+        // the payload and both codec outputs are held at once
+        static constexpr size_t MAX_SIZE_MB = 256;
+
+        std::string m_ScriptFilePath;
+        size_t m_SizeMb = 1;
+    };
+
+    void from_json(const nlohmann::json& json, CodecBenchmarkRequest& request)
+    {
+        request.m_ScriptFilePath = json.value("scriptFilePath", std::string());
+        request.m_SizeMb = std::clamp(json.value("size_mb", size_t(1)), size_t(1), CodecBenchmarkRequest::MAX_SIZE_MB);
+    }
+
+    nlohmann::json SchedulerStatsJson()
+    {
+        auto stats = Scheduler::GetInstance().GetStats();
+
+        nlohmann::json classes = nlohmann::json::array();
+        for (const auto& c : stats.m_Classes)
+        {
+            classes.push_back({
+                { "class", PriorityClassName(c.m_Class) },
+                { "depth", c.m_Depth },
+                { "submitted", c.m_Submitted },
+                { "completed", c.m_Completed },
+                { "wait_avg_ms", c.m_WaitAvgMs },
+                { "wait_p50_ms", c.m_WaitP50Ms },
+                { "wait_p99_ms", c.m_WaitP99Ms },
+                { "wait_max_ms", c.m_WaitMaxMs },
+            });
+        }
+
+        nlohmann::json clients = nlohmann::json::array();
+        for (const auto& c : stats.m_Clients)
+        {
+            clients.push_back({ { "client", c.m_ClientId }, { "weight", c.m_Weight }, { "depth", c.m_Depth } });
+        }
+
+        return {
+            { "workers", stats.m_Workers },
+            { "busy", stats.m_Busy },
+            { "classes", std::move(classes) },
+            { "clients", std::move(clients) },
+        };
+    }
+
+    struct CommandResultRequest
+    {
+        uint64_t m_Pending = 0;
+    };
+
+    void from_json(const nlohmann::json& json, CommandResultRequest& request)
+    {
+        json.at("pending").get_to(request.m_Pending);
+    }
+
+    struct SetClientWeightRequest
+    {
+        uint32_t m_Weight = 1;
+    };
+
+    void from_json(const nlohmann::json& json, SetClientWeightRequest& request)
+    {
+        json.at("weight").get_to(request.m_Weight);
+    }
+
+    struct LogConfigRequest
+    {
+        std::optional<std::string> m_Level;
+
+        // an empty path closes the log file
+        std::optional<std::string> m_File;
+    };
+
+    void from_json(const nlohmann::json& json, LogConfigRequest& request)
+    {
+        if (json.contains("level"))
+        {
+            request.m_Level = json.at("level").get<std::string>();
+        }
+
+        if (json.contains("file"))
+        {
+            request.m_File = json.at("file").get<std::string>();
+        }
+    }
+
+    nlohmann::json LogConfig(const LogConfigRequest& request)
+    {
+        if (request.m_Level.has_value())
+        {
+            bool found = false;
+            for (uint8_t i = 0; i <= static_cast<uint8_t>(LogLevel::Error); ++i)
+            {
+                if (*request.m_Level == LogLevelName(static_cast<LogLevel>(i)))
+                {
+                    set_log_level(static_cast<LogLevel>(i));
+                    found = true;
+                }
+            }
+
+            if (!found)
+            {
+                return { { "error", "unknown level" } };
+            }
+        }
+
+        if (request.m_File.has_value() && !set_log_file(*request.m_File))
+        {
+            return { { "error", "failed to open log file" } };
+        }
+
+        auto stats = get_log_stats();
+        return {
+            { "level", LogLevelName(get_log_level()) },
+            { "min_level", LogLevelName(static_cast<LogLevel>(CSE_LOG_MIN_LEVEL)) },
+            { "written", stats.m_Written },
+            { "dropped", stats.m_Dropped },
+            { "rings", stats.m_Rings },
+        };
+    }
+
+    struct WatchAddRequest
+    {
+        WatchRule m_Rule;
+    };
+
+    void from_json(const nlohmann::json& json, WatchAddRequest& request)
+    {
+        json.at("directory").get_to(request.m_Rule.m_Directory);
+        json.at("resource").get_to(request.m_Rule.m_Resource);
+        request.m_Rule.m_Pattern = json.value("pattern", request.m_Rule.m_Pattern);
+        request.m_Rule.m_Recursive = json.value("recursive", false);
+        request.m_Rule.m_Debounce = std::chrono::milliseconds(json.value("debounce_ms", request.m_Rule.m_Debounce.count()));
+    }
+
+    struct WatchRemoveRequest
+    {
+        uint64_t m_Id = 0;
+    };
+
+    void from_json(const nlohmann::json& json, WatchRemoveRequest& request)
+    {
+        json.at("id").get_to(request.m_Id);
+    }
+
+    struct WatchStatusRequest
+    {
+        // last seen result sequence, only newer results are returned
+        uint64_t m_Since = 0;
+    };
+
+    void from_json(const nlohmann::json& json, WatchStatusRequest& request)
+    {
+        request.m_Since = json.value("since", uint64_t(0));
+    }
+
+    nlohmann::json WatchStatus(uint64_t since)
+    {
+        static auto& watcher = ScriptWatcher::GetInstance();
+
+        nlohmann::json rules = nlohmann::json::array();
+        for (const auto& info : watcher.GetRules())
+        {
+            nlohmann::json rule = {
+                { "id", info.m_Id },
+                { "directory", info.m_Rule.m_Directory },
+                { "pattern", info.m_Rule.m_Pattern },
+                { "resource", info.m_Rule.m_Resource },
+                { "recursive", info.m_Rule.m_Recursive },
+                { "debounce_ms", info.m_Rule.m_Debounce.count() },
+                { "changes", info.m_Changes },
+                { "executions", info.m_Executions },
+                { "skipped", info.m_Skipped },
+                { "failed", info.m_Failed },
+            };
+
+            // a failed rule stays listed until it is removed, re-add it once the directory is back
+            if (info.m_Failed)
+            {
+                rule["error"] = info.m_Error;
+            }
+
+            rules.push_back(std::move(rule));
+        }
+
+        nlohmann::json results = nlohmann::json::array();
+        for (const auto& result : watcher.GetResults(since))
+        {
+            nlohmann::json entry = {
+                { "sequence", result.m_Sequence },
+                { "rule", result.m_RuleId },
+                { "path", result.m_Path },
+                { "resource", result.m_Resource },
+                { "success", result.m_Success },
+                { "elapsed_ms", result.m_ElapsedMs },
+            };
+
+            if (result.m_Success)
+            {
+                entry["hash"] = ToHex(result.m_Hash);
+            }
+            else
+            {
+                entry["error"] = result.m_Error;
+            }
+
+            results.push_back(std::move(entry));
+        }
+
+        return { { "rules", std::move(rules) }, { "results", std::move(results) } };
+    }
+
+    // { history? }, one pass over every runtime, one array per column with a row per runtime
+    struct RuntimeSnapshotRequest
+    {
+        size_t m_History = 8;
+    };
+
+    void from_json(const nlohmann::json& json, RuntimeSnapshotRequest& request)
+    {
+        request.m_History = json.value("history", request.m_History);
+    }
+
+    nlohmann::json RuntimeSnapshotJson(const RuntimeSnapshotRequest& request)
+    {
+        static auto& tracker = UsageTracker::GetInstance();
+
+        auto history = request.m_History;
+        auto snapshots = Executor::GetInstance().Snapshot();
+
+        // both are collected once and joined by resource
+        std::unordered_map<std::string, std::vector<uint64_t>> executions;
+        for (const auto& usage : tracker.GetExecutions())
+        {
+            executions[usage.m_Resource].push_back(usage.m_Execution);
+        }
+
+        std::unordered_map<std::string, ResourceUsage> totals;
+        for (auto& usage : tracker.GetResources())
+        {
+            totals.emplace(usage.m_Resource, std::move(usage));
+        }
+
+        nlohmann::json resource = nlohmann::json::array();
+        nlohmann::json domain = nlohmann::json::array();
+        nlohmann::json assemblies = nlohmann::json::array();
+        nlohmann::json executed = nlohmann::json::array();
+        nlohmann::json recent = nlohmann::json::array();
+        nlohmann::json heapDelta = nlohmann::json::array();
+        nlohmann::json methodsCompiled = nlohmann::json::array();
+
+        for (const auto& snapshot : snapshots)
+        {
+            resource.push_back(snapshot.m_Resource);
+            domain.push_back(snapshot.m_Domain);
+            assemblies.push_back(snapshot.m_Assemblies);
+
+            auto total = totals.find(snapshot.m_Resource);
+            executed.push_back(total != totals.end() ? total->second.m_Executions : 0);
+            heapDelta.push_back(total != totals.end() ? total->second.m_HeapDelta : 0);
+            methodsCompiled.push_back(total != totals.end() ? total->second.m_MethodsCompiled : 0);
+
+            // newest last, at most history of them
+            auto ids = executions.find(snapshot.m_Resource);
+            nlohmann::json last = nlohmann::json::array();
+            if (ids != executions.end())
+            {
+                size_t first = ids->second.size() > history ? ids->second.size() - history : 0;
+                last = std::vector<uint64_t>(ids->second.begin() + first, ids->second.end());
+            }
+
+            recent.push_back(std::move(last));
+        }
+
+        auto sample = tracker.Sample();
+        return {
+            { "rows", snapshots.size() },
+            { "heap_used", sample.m_HeapUsed },
+            { "heap_size", sample.m_HeapSize },
+            { "columns", {
+                { "resource", std::move(resource) },
+                { "domain", std::move(domain) },
+                { "assemblies", std::move(assemblies) },
+                { "executed", std::move(executed) },
+                { "recent_executions", std::move(recent) },
+                { "heap_delta", std::move(heapDelta) },
+                { "methods_compiled", std::move(methodsCompiled) },
+            } },
+        };
+    }
+
+    // { resource, kind: "assemblies" | "types" | "methods", prefix?, cursor?, limit? }, pass the returned cursor back for the next page
+    struct EnumerateRuntimeRequest
+    {
+        std::string m_Resource;
+        EnumerationKind m_Kind = EnumerationKind::Assemblies;
+        std::string m_Prefix;
+        EnumerationCursor m_Cursor;
+        size_t m_Limit = 256;
+    };
+
+    void from_json(const nlohmann::json& json, EnumerateRuntimeRequest& request)
+    {
+        json.at("resource").get_to(request.m_Resource);
+
+        auto kind = EnumerationKindFromName(json.value("kind", std::string("assemblies")));
+        if (!kind.has_value())
+        {
+            throw std::invalid_argument("unknown kind");
+        }
+
+        request.m_Kind = *kind;
+        request.m_Prefix = json.value("prefix", std::string());
+
+        if (json.contains("cursor") && json["cursor"].is_object())
+        {
+            const auto& position = json["cursor"];
+            request.m_Cursor.m_Assembly = position.value("assembly", 0u);
+            request.m_Cursor.m_Type = position.value("type", 0u);
+            request.m_Cursor.m_Method = position.value("method", 0u);
+        }
+
+        request.m_Limit = std::clamp(json.value("limit", request.m_Limit), size_t(1), size_t(4096));
+    }
+
+    nlohmann::json EnumerateRuntime(const EnumerateRuntimeRequest& request)
+    {
+        const auto& resource = request.m_Resource;
+        auto kind = request.m_Kind;
+
+        auto runtimes = Executor::GetInstance().GetRuntimes();
+        auto runtime = std::find_if(runtimes.begin(), runtimes.end(), [&](const RuntimeInfo& info) { return info.GetResourceName() == resource; });
+        if (runtime == runtimes.end())
+        {
+            return { { "error", "resource not found" } };
+        }
+
+        auto page = EnumerateDomain(runtime->m_Domain, kind, request.m_Prefix, request.m_Cursor, request.m_Limit);
+        if (!page.has_value())
+        {
+            return { { "error", "failed to list assemblies" } };
+        }
+
+        // columnar like runtime_snapshot, a page of methods repeats little but the names
+        nlohmann::json assembly = nlohmann::json::array();
+        nlohmann::json space = nlohmann::json::array();
+        nlohmann::json name = nlohmann::json::array();
+        nlohmann::json method = nlohmann::json::array();
+        nlohmann::json token = nlohmann::json::array();
+        nlohmann::json flags = nlohmann::json::array();
+        nlohmann::json count = nlohmann::json::array();
+
+        for (const auto& item : page->m_Items)
+        {
+            assembly.push_back(item.m_Assembly);
+            name.push_back(item.m_Name);
+
+            if (kind == EnumerationKind::Assemblies)
+            {
+                count.push_back(item.m_Count);
+                continue;
+            }
+
+            space.push_back(item.m_Namespace);
+            token.push_back(item.m_Token);
+            flags.push_back(item.m_Flags);
+
+            if (kind == EnumerationKind::Types)
+            {
+                count.push_back(item.m_Count);
+            }
+            else
+            {
+                method.push_back(item.m_Method);
+            }
+        }
+
+        nlohmann::json columns = { { "assembly", std::move(assembly) }, { "name", std::move(name) } };
+        if (kind == EnumerationKind::Assemblies)
+        {
+            columns["types"] = std::move(count);
+        }
+        else
+        {
+            columns["namespace"] = std::move(space);
+            columns["token"] = std::move(token);
+            columns["flags"] = std::move(flags);
+            if (kind == EnumerationKind::Types)
+            {
+                columns["methods"] = std::move(count);
+            }
+            else
+            {
+                columns["method"] = std::move(method);
+            }
+        }
+
+        nlohmann::json assemblies = nlohmann::json::object();
+        for (const auto& [index, assemblyName] : page->m_Assemblies)
+        {
+            assemblies[std::to_string(index)] = assemblyName;
+        }
+
+        nlohmann::json reply = {
+            { "rows", page->m_Items.size() },
+            { "scanned", page->m_Scanned },
+            { "columns", std::move(columns) },
+            { "cursor", nullptr },
+        };
+
+        if (kind != EnumerationKind::Assemblies)
+        {
+            reply["assemblies"] = std::move(assemblies);
+        }
+
+        if (page->m_Next.has_value())
+        {
+            reply["cursor"] = { { "assembly", page->m_Next->m_Assembly }, { "type", page->m_Next->m_Type }, { "method", page->m_Next->m_Method } };
+        }
+
+        return reply;
+    }
+
+    // { deadline_ms?, grace_ms? }
+    struct WatchdogConfigRequest
+    {
+        std::optional<std::chrono::milliseconds> m_Deadline;
+        std::optional<std::chrono::milliseconds> m_Grace;
+    };
+
+    void from_json(const nlohmann::json& json, WatchdogConfigRequest& request)
+    {
+        request.m_Deadline = RequestDeadline(json);
+        if (json.contains("grace_ms"))
+        {
+            request.m_Grace = std::chrono::milliseconds(json["grace_ms"].get<int64_t>());
+        }
+    }
+
+    nlohmann::json WatchdogConfig(const WatchdogConfigRequest& request)
+    {
+        static auto& watchdog = ExecutionWatchdog::GetInstance();
+
+        auto options = watchdog.GetOptions();
+        options.m_Deadline = request.m_Deadline.value_or(options.m_Deadline);
+        options.m_Grace = request.m_Grace.value_or(options.m_Grace);
+        watchdog.SetOptions(options);
+
+        auto stats = watchdog.GetStats();
+        return {
+            { "deadline_ms", options.m_Deadline.count() },
+            { "grace_ms", options.m_Grace.count() },
+            { "abort_supported", MonoMethods::GetInstance().supports(MonoFeature::ThreadAbort) },
+            { "runs", stats.m_Runs },
+            { "timed_out", stats.m_TimedOut },
+            { "aborted", stats.m_Aborted },
+            { "abandoned", stats.m_Abandoned },
+            { "stuck", stats.m_Stuck },
+            { "idle_runners", stats.m_IdleRunners },
+        };
+    }
+
+    // { enabled? }, turning capture off hands every hooked domain its console writers back
+    struct ConsoleConfigRequest
+    {
+        std::optional<bool> m_Enabled;
+    };
+
+    void from_json(const nlohmann::json& json, ConsoleConfigRequest& request)
+    {
+        if (json.contains("enabled"))
+        {
+            request.m_Enabled = json.at("enabled").get<bool>();
+        }
+    }
+
+    nlohmann::json ConsoleConfig(const ConsoleConfigRequest& request)
+    {
+        static auto& capture = OutputCapture::GetInstance();
+
+        if (request.m_Enabled.has_value())
+        {
+            capture.SetEnabled(*request.m_Enabled);
+        }
+
+        auto stats = capture.GetStats();
+        return {
+            { "enabled", stats.m_Enabled },
+            { "domains", stats.m_Domains },
+            { "chunks", stats.m_Chunks },
+            { "bytes", stats.m_Bytes },
+            { "written", stats.m_Written },
+        };
+    }
+
+    // { cursor?, execution?, resource?, max_bytes?, wait_ms? }, long polls for console output written after cursor
+    struct ConsoleReadRequest
+    {
+        CaptureFilter m_Filter;
+        uint64_t m_Cursor = 0;
+        size_t m_MaxBytes = 256 * 1024;
+        std::chrono::milliseconds m_Wait{ 0 };
+    };
+
+    void from_json(const nlohmann::json& json, ConsoleReadRequest& request)
+    {
+        request.m_Filter.m_Execution = json.value("execution", uint64_t(0));
+        request.m_Filter.m_Resource = json.value("resource", std::string());
+        request.m_Cursor = json.value("cursor", request.m_Cursor);
+        request.m_MaxBytes = json.value("max_bytes", request.m_MaxBytes);
+        request.m_Wait = std::chrono::milliseconds(std::clamp(json.value("wait_ms", 0), 0, 30000));
+    }
+
+    nlohmann::json ConsoleRead(const ConsoleReadRequest& request)
+    {
+        auto batch = OutputCapture::GetInstance().Read(request.m_Cursor, request.m_MaxBytes, request.m_Filter, request.m_Wait);
+
+        nlohmann::json chunks = nlohmann::json::array();
+        for (auto& chunk : batch.m_Chunks)
+        {
+            chunks.push_back({
+                { "sequence", chunk.m_Sequence },
+                { "time_us", chunk.m_Timestamp },
+                { "execution", chunk.m_Execution },
+                { "resource", std::move(chunk.m_Resource) },
+                { "stream", OutputStreamName(chunk.m_Stream) },
+                { "text", std::move(chunk.m_Text) },
+            });
+        }
+
+        return {
+            { "cursor", batch.m_Cursor },
+            { "skipped", batch.m_Skipped },
+            { "chunks", std::move(chunks) },
+        };
+    }
+
+    // { allocations? }
+    struct ProfilerStartRequest
+    {
+        bool m_Allocations = true;
+    };
+
+    void from_json(const nlohmann::json& json, ProfilerStartRequest& request)
+    {
+        request.m_Allocations = json.value("allocations", request.m_Allocations);
+    }
+
+    // { limit?, folded? }, hottest methods by exclusive time and the folded stacks for flame graphs
+    struct ProfilerReportRequest
+    {
+        size_t m_Limit = 100;
+        bool m_Folded = true;
+    };
+
+    void from_json(const nlohmann::json& json, ProfilerReportRequest& request)
+    {
+        request.m_Limit = json.value("limit", request.m_Limit);
+        request.m_Folded = json.value("folded", request.m_Folded);
+    }
+
+    nlohmann::json ProfilerReport(const ProfilerReportRequest& request)
+    {
+        auto report = ScriptProfiler::GetInstance().Report(request.m_Limit);
+
+        nlohmann::json methods = nlohmann::json::array();
+        for (auto& method : report.m_Methods)
+        {
+            methods.push_back({
+                { "method", std::move(method.m_Name) },
+                { "calls", method.m_Calls },
+                { "inclusive_ms", method.m_InclusiveMs },
+                { "exclusive_ms", method.m_ExclusiveMs },
+                { "allocations", method.m_Allocations },
+                { "allocated_bytes", method.m_AllocatedBytes },
+            });
+        }
+
+        nlohmann::json reply = {
+            { "running", report.m_Running },
+            { "allocations", report.m_Allocations },
+            { "threads", report.m_Threads },
+            { "instrumented", report.m_Instrumented },
+            { "methods", std::move(methods) },
+        };
+
+        // one "a;b;c <us>" line per stack, what flamegraph.pl and speedscope read
+        if (request.m_Folded)
+        {
+            std::string folded;
+            for (const auto& line : report.m_Folded)
+            {
+                folded += line;
+                folded += '\n';
+            }
+
+            reply["folded"] = std::move(folded);
+        }
+
+        return reply;
+    }
+
+    // { directory?, enabled?, max_segments? }
+    struct JournalConfigRequest
+    {
+        std::optional<std::string> m_Directory;
+        std::optional<bool> m_Enabled;
+        std::optional<size_t> m_MaxSegments;
+    };
+
+    void from_json(const nlohmann::json& json, JournalConfigRequest& request)
+    {
+        if (json.contains("directory"))
+        {
+            request.m_Directory = json["directory"].get<std::string>();
+        }
+
+        if (json.contains("enabled"))
+        {
+            request.m_Enabled = json["enabled"].get<bool>();
+        }
+
+        if (json.contains("max_segments"))
+        {
+            request.m_MaxSegments = json["max_segments"].get<size_t>();
+        }
+    }
+
+    nlohmann::json JournalConfig(const JournalConfigRequest& request)
+    {
+        static auto& journal = ExecutionJournal::GetInstance();
+
+        if (request.m_Directory.has_value() && !journal.Open(*request.m_Directory))
+        {
+            return { { "error", "failed to open journal" } };
+        }
+
+        if (request.m_Enabled.has_value())
+        {
+            journal.SetEnabled(*request.m_Enabled);
+        }
+
+        if (request.m_MaxSegments.has_value())
+        {
+            journal.SetMaxSegments(*request.m_MaxSegments);
+        }
+
+        auto stats = journal.GetStats();
+        return {
+            { "directory", stats.m_Directory.string() },
+            { "enabled", stats.m_Enabled },
+            { "segments", stats.m_Segments },
+            { "max_segments", stats.m_MaxSegments },
+            { "records_per_segment", ExecutionJournal::SEGMENT_RECORDS },
+            { "next", stats.m_Next },
+            { "oldest", stats.m_Oldest },
+            { "bytes", stats.m_Bytes },
+            { "dropped", stats.m_Dropped },
+        };
+    }
+
+    // { from_us?, to_us?, resource?, outcome?, cursor?, limit?, newest_first? }, times are unix microseconds
+    void from_json(const nlohmann::json& json, JournalQuery& query)
+    {
+        query.m_From = json.value("from_us", uint64_t(0));
+        query.m_To = json.value("to_us", std::numeric_limits<uint64_t>::max());
+        query.m_Cursor = json.value("cursor", uint64_t(0));
+        query.m_Limit = std::min(json.value("limit", size_t(100)), size_t(10000));
+        query.m_NewestFirst = json.value("newest_first", false);
+
+        if (json.contains("resource"))
+        {
+            query.m_Resource = json["resource"].get<std::string>();
+        }
+
+        if (json.contains("outcome"))
+        {
+            auto name = json["outcome"].get<std::string>();
+            for (auto outcome : { ExecutionOutcome::Completed, ExecutionOutcome::Failed, ExecutionOutcome::TimedOut })
+            {
+                if (name == ExecutionOutcomeName(outcome))
+                {
+                    query.m_Outcome = outcome;
+                }
+            }
+
+            if (!query.m_Outcome.has_value())
+            {
+                throw std::invalid_argument("unknown outcome");
+            }
+        }
+    }
+
+    nlohmann::json QueryJournal(const JournalQuery& query)
+    {
+        auto page = ExecutionJournal::GetInstance().Query(query);
+
+        nlohmann::json entries = nlohmann::json::array();
+        for (auto& entry : page.m_Entries)
+        {
+            entries.push_back({
+                { "index", entry.m_Index },
+                { "time_us", entry.m_Timestamp },
+                { "execution", entry.m_Execution },
+                { "hash", ToHex(entry.m_Hash) },
+                { "resource", std::move(entry.m_Resource) },
+                { "script", std::move(entry.m_Script) },
+                { "outcome", ExecutionOutcomeName(entry.m_Outcome) },
+                { "rejected", entry.m_Rejected },
+                { "pdb", entry.m_HasPdb },
+                { "size", entry.m_ImageSize },
+                { "marshal_ms", entry.m_MarshalMs },
+                { "run_ms", entry.m_RunMs },
+                { "total_ms", entry.m_TotalMs },
+                { "heap_delta", entry.m_HeapDelta },
+            });
+        }
+
+        return {
+            { "cursor", page.m_Cursor },
+            { "done", page.m_Done },
+            { "scanned", page.m_Scanned },
+            { "entries", std::move(entries) },
+        };
+    }
+
+    // { since? }, per-execution deltas after the given execution id plus running totals per resource
+    struct UsageStatsRequest
+    {
+        uint64_t m_Since = 0;
+    };
+
+    void from_json(const nlohmann::json& json, UsageStatsRequest& request)
+    {
+        request.m_Since = json.value("since", request.m_Since);
+    }
+
+    nlohmann::json UsageStats(const UsageStatsRequest& request)
+    {
+        static auto& tracker = UsageTracker::GetInstance();
+
+        nlohmann::json executions = nlohmann::json::array();
+        for (const auto& usage : tracker.GetExecutions(request.m_Since))
+        {
+            auto item = UsageJson(usage);
+            item["execution"] = usage.m_Execution;
+            item["resource"] = usage.m_Resource;
+            item["assembly"] = usage.m_Assembly;
+            item["success"] = usage.m_Success;
+            executions.push_back(std::move(item));
+        }
+
+        nlohmann::json resources = nlohmann::json::array();
+        for (const auto& usage : tracker.GetResources())
+        {
+            resources.push_back({
+                { "resource", usage.m_Resource },
+                { "executions", usage.m_Executions },
+                { "heap_delta", usage.m_HeapDelta },
+                { "peak_heap_delta", usage.m_PeakHeapDelta },
+                { "minor_collections", usage.m_MinorCollections },
+                { "major_collections", usage.m_MajorCollections },
+                { "methods_compiled", usage.m_MethodsCompiled },
+                { "jit_ms", usage.m_JitMs },
+                { "elapsed_ms", usage.m_ElapsedMs },
+                { "shared_executions", usage.m_SharedExecutions },
+            });
+        }
+
+        auto sample = tracker.Sample();
+        return {
+            { "heap_used", sample.m_HeapUsed },
+            { "heap_size", sample.m_HeapSize },
+            { "minor_collections", sample.m_MinorCollections },
+            { "major_collections", sample.m_MajorCollections },
+            { "executions", std::move(executions) },
+            { "resources", std::move(resources) },
+        };
+    }
+
+    // { enabled?, budget_ms?, hot_methods?, since? }
+    struct WarmupConfigRequest
+    {
+        std::optional<bool> m_Enabled;
+        std::optional<std::chrono::milliseconds> m_Budget;
+        std::optional<std::vector<std::string>> m_HotMethods;
+        uint64_t m_Since = 0;
+    };
+
+    void from_json(const nlohmann::json& json, WarmupConfigRequest& request)
+    {
+        if (json.contains("enabled"))
+        {
+            request.m_Enabled = json["enabled"].get<bool>();
+        }
+
+        if (json.contains("budget_ms"))
+        {
+            request.m_Budget = std::chrono::milliseconds(json["budget_ms"].get<int64_t>());
+        }
+
+        if (json.contains("hot_methods"))
+        {
+            request.m_HotMethods = json["hot_methods"].get<std::vector<std::string>>();
+        }
+
+        request.m_Since = json.value("since", request.m_Since);
+    }
+
+    nlohmann::json WarmupConfig(const WarmupConfigRequest& request)
+    {
+        static auto& warmup = JitWarmup::GetInstance();
+
+        auto options = warmup.GetOptions();
+        options.m_Enabled = request.m_Enabled.value_or(options.m_Enabled);
+        if (options.m_Enabled && !MonoMethods::GetInstance().supports(MonoFeature::GenericSignatures))
+        {
+            return { { "error", "unsupported: this Mono build has no mono_signature_is_generic" } };
+        }
+
+        options.m_Budget = request.m_Budget.value_or(options.m_Budget);
+        if (request.m_HotMethods.has_value())
+        {
+            options.m_HotMethods = *request.m_HotMethods;
+        }
+
+        warmup.SetOptions(options);
+
+        nlohmann::json reports = nlohmann::json::array();
+        for (const auto& report : warmup.GetReports(request.m_Since))
+        {
+            reports.push_back({
+                { "sequence", report.m_Sequence },
+                { "assembly", report.m_Assembly },
+                { "resource", report.m_Resource },
+                { "methods", report.m_Methods },
+                { "compiled", report.m_Compiled },
+                { "failed", report.m_Failed },
+                { "skipped", report.m_Skipped },
+                { "jit_ms", report.m_JitMs },
+                { "budget_exhausted", report.m_BudgetExhausted },
+            });
+        }
+
+        return {
+            { "enabled", options.m_Enabled },
+            { "budget_ms", options.m_Budget.count() },
+            { "hot_methods", options.m_HotMethods.size() },
+            { "reports", std::move(reports) },
+        };
+    }
+
+    void RegisterCommands(CommandRegistry& registry)
+    {
+        using namespace std::chrono_literals;
+
+        // stubs, cheap enough to answer on the client thread
+        registry.Register<nlohmann::json>("list_resources"_cmd, { ExecutionPolicy::Inline }, [](const nlohmann::json&)
+        {
+            return ListResources();
+        });
+
+        // goes through the scheduler's reserved interactive worker, so it never waits behind executions
+        registry.Register<ListResourcesWithRuntimesRequest>("list_resources_with_runtimes"_cmd, { ExecutionPolicy::WorkerPool, PriorityClass::Interactive, 0, 5s }, [](const ListResourcesWithRuntimesRequest& request)
+        {
+            if (request.m_Generation.has_value())
+            {
+                return ListResourcesWithRuntimes(request.m_Epoch, *request.m_Generation);
+            }
+
+            return ListResourcesWithRuntimes();
+        });
+
+        // attaches to every domain once, kept off the client thread
+        registry.Register<RuntimeSnapshotRequest>("runtime_snapshot"_cmd, { ExecutionPolicy::WorkerPool, PriorityClass::Interactive, 1, 10s }, [](const RuntimeSnapshotRequest& request)
+        {
+            return RuntimeSnapshotJson(request);
+        });
+
+        registry.Register<EnumerateRuntimeRequest>("enumerate_runtime"_cmd, { ExecutionPolicy::WorkerPool, PriorityClass::Interactive, 2, 10s }, [](const EnumerateRuntimeRequest& request)
+        {
+            return EnumerateRuntime(request);
+        });
+
+        registry.Register<CreateRuntimeRequest>("create_runtime"_cmd, { ExecutionPolicy::Inline }, [](const CreateRuntimeRequest& request)
+        {
+            return CreateRuntime(request.m_Resource);
+        });
+
+        // executions are serialized per resource so two scripts never race inside one domain
+        registry.Register<ExecuteInResourceRequest>("execute_in_resource"_cmd, { ExecutionPolicy::DomainQueue, PriorityClass::Execution, 0, 60s }, [](const ExecuteInResourceRequest& request)
+        {
+            return ExecuteInResource(request);
+        });
+
+        registry.Register<ExecuteBundleRequest>("execute_bundle"_cmd, { ExecutionPolicy::DomainQueue, PriorityClass::Execution, 0, 120s }, [](const ExecuteBundleRequest& request)
+        {
+            return ExecuteBundle(request);
+        });
+
+        // compile time counts against the same deadline as the execution
+        registry.Register<ExecuteSourceRequest>("execute_source"_cmd, { ExecutionPolicy::DomainQueue, PriorityClass::Execution, 0, 120s }, [](const ExecuteSourceRequest& request)
+        {
+            return ExecuteSource(request);
+        });
+
+        // waits on the client thread, every target is queued through its own resource's domain queue
+        registry.Register<ExecuteFanOutRequest>("execute_fanout"_cmd, { ExecutionPolicy::Inline }, [](const ExecuteFanOutRequest& request)
+        {
+            return ExecuteFanOut(request);
+        });
+
+        registry.Register<ExecuteDeltaRequest>("execute_delta"_cmd, { ExecutionPolicy::DomainQueue, PriorityClass::Execution, 0, 60s }, [](const ExecuteDeltaRequest& request)
+        {
+            return ExecuteDelta(request);
+        });
+
+        // answered inline so they stay responsive even when every worker is stuck
+        registry.Register<nlohmann::json>("scheduler_stats"_cmd, { ExecutionPolicy::Inline }, [](const nlohmann::json&)
+        {
+            return SchedulerStatsJson();
+        });
+
+        // { pending }, reply of a command that timed out while running
+        registry.Register<CommandResultRequest>("command_result"_cmd, { ExecutionPolicy::Inline }, [&registry](const CommandResultRequest& request)
+        {
+            return registry.PollPending(request.m_Pending);
+        });
+
+        registry.Register<SetClientWeightRequest>("set_client_weight"_cmd, { ExecutionPolicy::Inline }, [](const SetClientWeightRequest& request)
+        {
+            uint64_t clientId = CommandRegistry::CurrentClientId();
+            Scheduler::GetInstance().SetClientWeight(clientId, request.m_Weight);
+            return nlohmann::json{ { "client", clientId }, { "weight", request.m_Weight } };
+        });
+
+        registry.Register<LogConfigRequest>("log_config"_cmd, { ExecutionPolicy::Inline }, [](const LogConfigRequest& request)
+        {
+            return LogConfig(request);
+        });
+
+        registry.Register<ExecuteByHashRequest>("execute_by_hash"_cmd, { ExecutionPolicy::DomainQueue, PriorityClass::Execution, 0, 60s }, [](const ExecuteByHashRequest& request)
+        {
+            return ExecuteByHash(request);
+        });
+
+        registry.Register<nlohmann::json>("store_list"_cmd, { ExecutionPolicy::WorkerPool, PriorityClass::Interactive, 0, 5s }, [](const nlohmann::json&)
+        {
+            return StoreList();
+        });
+
+        registry.Register<StoreConfigRequest>("store_config"_cmd, { ExecutionPolicy::Inline }, [](const StoreConfigRequest& request)
+        {
+            return StoreConfig(request);
+        });
+
+        registry.Register<StoreRemoveRequest>("store_remove"_cmd, { ExecutionPolicy::Inline }, [](const StoreRemoveRequest& request)
+        {
+            return nlohmann::json{ { "removed", AssemblyStore::GetInstance().Remove(request.m_Hash) } };
+        });
+
+        registry.Register<CompilerConfigRequest>("compiler_config"_cmd, { ExecutionPolicy::Inline }, [](const CompilerConfigRequest& request)
+        {
+            return CompilerConfig(request);
+        });
+
+        registry.Register<UsageStatsRequest>("usage_stats"_cmd, { ExecutionPolicy::Inline }, [](const UsageStatsRequest& request)
+        {
+            return UsageStats(request);
+        });
+
+        registry.Register<WatchdogConfigRequest>("watchdog_config"_cmd, { ExecutionPolicy::Inline }, [](const WatchdogConfigRequest& request)
+        {
+            return WatchdogConfig(request);
+        });
+
+        registry.Register<WarmupConfigRequest>("warmup_config"_cmd, { ExecutionPolicy::Inline }, [](const WarmupConfigRequest& request)
+        {
+            return WarmupConfig(request);
+        });
+
+        // inline on purpose: a long poll only holds up the client that asked for it
+        registry.Register<ResultsReadRequest>("results_read"_cmd, { ExecutionPolicy::Inline }, [](const ResultsReadRequest& request)
+        {
+            return ResultsRead(request);
+        });
+
+        registry.Register<nlohmann::json>("results_list"_cmd, { ExecutionPolicy::Inline }, [](const nlohmann::json&)
+        {
+            return ResultsList();
+        });
+
+        // { allocations? }, methods compiled after this are instrumented, start before running the code of interest
+        registry.Register<ProfilerStartRequest>("profiler_start"_cmd, { ExecutionPolicy::Inline }, [](const ProfilerStartRequest& request)
+        {
+            if (!ScriptProfiler::GetInstance().Start(request.m_Allocations))
+            {
+                return nlohmann::json{ { "running", false }, { "error", "unsupported: this Mono build has no profiler API" } };
+            }
+
+            return nlohmann::json{ { "running", true } };
+        });
+
+        registry.Register<nlohmann::json>("profiler_stop"_cmd, { ExecutionPolicy::Inline }, [](const nlohmann::json&)
+        {
+            ScriptProfiler::GetInstance().Stop();
+            return nlohmann::json{ { "running", false } };
+        });
+
+        registry.Register<nlohmann::json>("profiler_reset"_cmd, { ExecutionPolicy::Inline }, [](const nlohmann::json&)
+        {
+            ScriptProfiler::GetInstance().Reset();
+            return nlohmann::json{ { "success", true } };
+        });
+
+        // walks every thread's call tree
+        registry.Register<ProfilerReportRequest>("profiler_report"_cmd, { ExecutionPolicy::WorkerPool, PriorityClass::Interactive, 1, 10s }, [](const ProfilerReportRequest& request)
+        {
+            return ProfilerReport(request);
+        });
+
+        registry.Register<ConsoleReadRequest>("console_read"_cmd, { ExecutionPolicy::Inline }, [](const ConsoleReadRequest& request)
+        {
+            return ConsoleRead(request);
+        });
+
+        // restoring writers attaches to every hooked domain
+        registry.Register<ConsoleConfigRequest>("console_config"_cmd, { ExecutionPolicy::WorkerPool, PriorityClass::Interactive, 1, 10s }, [](const ConsoleConfigRequest& request)
+        {
+            return ConsoleConfig(request);
+        });
+
+        // scans mapped segments, a wide query reads up to ExecutionJournal::MAX_SCAN records
+        registry.Register<JournalQuery>("journal_query"_cmd, { ExecutionPolicy::WorkerPool, PriorityClass::Bulk, 2, 30s }, [](const JournalQuery& request)
+        {
+            return QueryJournal(request);
+        });
+
+        // reopening waits for in-flight appends and finds the end of the newest segment
+        registry.Register<JournalConfigRequest>("journal_config"_cmd, { ExecutionPolicy::WorkerPool, PriorityClass::Interactive, 1, 10s }, [](const JournalConfigRequest& request)
+        {
+            return JournalConfig(request);
+        });
+
+        // hot reload: files matching a rule are executed in its resource whenever their content changes
+        registry.Register<WatchAddRequest>("watch_add"_cmd, { ExecutionPolicy::Inline }, [](const WatchAddRequest& request)
+        {
+            uint64_t id = ScriptWatcher::GetInstance().AddRule(request.m_Rule);
+            if (id == 0)
+            {
+                return nlohmann::json{ { "error", "failed to watch directory" } };
+            }
+
+            return nlohmann::json{ { "id", id } };
+        });
+
+        registry.Register<WatchRemoveRequest>("watch_remove"_cmd, { ExecutionPolicy::Inline }, [](const WatchRemoveRequest& request)
+        {
+            return nlohmann::json{ { "removed", ScriptWatcher::GetInstance().RemoveRule(request.m_Id) } };
+        });
+
+        // poll with the last seen "sequence" to only get new results
+        registry.Register<WatchStatusRequest>("watch_status"_cmd, { ExecutionPolicy::Inline }, [](const WatchStatusRequest& request)
+        {
+            return WatchStatus(request.m_Since);
+        });
+
+        // CPU bound, keep them off the client thread
+        registry.Register<InspectAssemblyRequest>("inspect_assembly"_cmd, { ExecutionPolicy::WorkerPool, PriorityClass::Interactive, 0, 5s }, [](const InspectAssemblyRequest& request)
+        {
+            return InspectAssembly(request);
+        });
+
+        registry.Register<GetSignaturesRequest>("get_signatures"_cmd, { ExecutionPolicy::WorkerPool, PriorityClass::Bulk, 4, 30s }, [](const GetSignaturesRequest& request)
+        {
+            return GetSignatures(request);
+        });
+
+        registry.Register<CodecBenchmarkRequest>("codec_benchmark"_cmd, { ExecutionPolicy::WorkerPool, PriorityClass::Bulk, 1, 120s }, [](const CodecBenchmarkRequest& request)
+        {
+            auto embedded = embedded_script();
+            std::vector<uint8_t> sample(embedded.begin(), embedded.end());
+            if (!request.m_ScriptFilePath.empty())
+            {
+                sample = ReadFileBytes(request.m_ScriptFilePath).value_or(sample);
+            }
+
+            return BenchmarkCodec(sample, request.m_SizeMb * 1024 * 1024);
+        });
+    }
+}
\ No newline at end of file
@@ -0,0 +1,187 @@
+#include <cse/hash.hpp>
+#include <algorithm>
+
+namespace cse
+{
+    namespace
+    {
+        constexpr uint32_t K[64] = {
+            0x428a2f98, 0x71374491, 0xb5c0fbcf, 0xe9b5dba5, 0x3956c25b, 0x59f111f1, 0x923f82a4, 0xab1c5ed5,
+            0xd807aa98, 0x12835b01, 0x243185be, 0x550c7dc3, 0x72be5d74, 0x80deb1fe, 0x9bdc06a7, 0xc19bf174,
+            0xe49b69c1, 0xefbe4786, 0x0fc19dc6, 0x240ca1cc, 0x2de92c6f, 0x4a7484aa, 0x5cb0a9dc, 0x76f988da,
+            0x983e5152, 0xa831c66d, 0xb00327c8, 0xbf597fc7, 0xc6e00bf3, 0xd5a79147, 0x06ca6351, 0x14292967,
+            0x27b70a85, 0x2e1b2138, 0x4d2c6dfc, 0x53380d13, 0x650a7354, 0x766a0abb, 0x81c2c92e, 0x92722c85,
+            0xa2bfe8a1, 0xa81a664b, 0xc24b8b70, 0xc76c51a3, 0xd192e819, 0xd6990624, 0xf40e3585, 0x106aa070,
+            0x19a4c116, 0x1e376c08, 0x2748774c, 0x34b0bcb5, 0x391c0cb3, 0x4ed8aa4a, 0x5b9cca4f, 0x682e6ff3,
+            0x748f82ee, 0x78a5636f, 0x84c87814, 0x8cc70208, 0x90befffa, 0xa4506ceb, 0xbef9a3f7, 0xc67178f2,
+        };
+
+        inline uint32_t Rotr(uint32_t x, int n)
+        {
+            return (x >> n) | (x << (32 - n));
+        }
+    }
+
+    Sha256::Sha256()
+        : m_State{ 0x6a09e667, 0xbb67ae85, 0x3c6ef372, 0xa54ff53a, 0x510e527f, 0x9b05688c, 0x1f83d9ab, 0x5be0cd19 }
+    {
+    }
+
+    void Sha256::Transform(const uint8_t* block)
+    {
+        uint32_t w[64];
+        for (int i = 0; i < 16; ++i)
+        {
+            w[i] = (uint32_t(block[i * 4]) << 24) | (uint32_t(block[i * 4 + 1]) << 16) | (uint32_t(block[i * 4 + 2]) << 8) | block[i * 4 + 3];
+        }
+
+        for (int i = 16; i < 64; ++i)
+        {
+            uint32_t s0 = Rotr(w[i - 15], 7) ^ Rotr(w[i - 15], 18) ^ (w[i - 15] >> 3);
+            uint32_t s1 = Rotr(w[i - 2], 17) ^ Rotr(w[i - 2], 19) ^ (w[i - 2] >> 10);
+            w[i] = w[i - 16] + s0 + w[i - 7] + s1;
+        }
+
+        uint32_t a = m_State[0], b = m_State[1], c = m_State[2], d = m_State[3];
+        uint32_t e = m_State[4], f = m_State[5], g = m_State[6], h = m_State[7];
+
+        for (int i = 0; i < 64; ++i)
+        {
+            uint32_t s1 = Rotr(e, 6) ^ Rotr(e, 11) ^ Rotr(e, 25);
+            uint32_t ch = (e & f) ^ (~e & g);
+            uint32_t t1 = h + s1 + ch + K[i] + w[i];
+            uint32_t s0 = Rotr(a, 2) ^ Rotr(a, 13) ^ Rotr(a, 22);
+            uint32_t maj = (a & b) ^ (a & c) ^ (b & c);
+            uint32_t t2 = s0 + maj;
+
+            h = g;
+            g = f;
+            f = e;
+            e = d + t1;
+            d = c;
+            c = b;
+            b = a;
+            a = t1 + t2;
+        }
+
+        m_State[0] += a; m_State[1] += b; m_State[2] += c; m_State[3] += d;
+        m_State[4] += e; m_State[5] += f; m_State[6] += g; m_State[7] += h;
+    }
+
+    void Sha256::Update(std::span<const uint8_t> data)
+    {
+        const uint8_t* ptr = data.data();
+        size_t size = data.size();
+        m_Length += size;
+
+        if (m_BufferSize)
+        {
+            size_t take = std::min(size, sizeof(m_Buffer) - m_BufferSize);
+            std::memcpy(m_Buffer + m_BufferSize, ptr, take);
+            m_BufferSize += take;
+            ptr += take;
+            size -= take;
+
+            if (m_BufferSize < sizeof(m_Buffer))
+            {
+                return;
+            }
+
+            Transform(m_Buffer);
+            m_BufferSize = 0;
+        }
+
+        while (size >= sizeof(m_Buffer))
+        {
+            Transform(ptr);
+            ptr += sizeof(m_Buffer);
+            size -= sizeof(m_Buffer);
+        }
+
+        if (size)
+        {
+            std::memcpy(m_Buffer, ptr, size);
+            m_BufferSize = size;
+        }
+    }
+
+    Hash256 Sha256::Finish()
+    {
+        uint64_t bitLength = m_Length * 8;
+
+        uint8_t padding[72] = { 0x80 };
+        size_t padSize = (m_BufferSize < 56) ? (56 - m_BufferSize) : (120 - m_BufferSize);
+        Update(std::span<const uint8_t>(padding, padSize));
+
+        uint8_t length[8];
+        for (int i = 0; i < 8; ++i)
+        {
+            length[i] = static_cast<uint8_t>(bitLength >> (56 - i * 8));
+        }
+        Update(length);
+
+        Hash256 digest;
+        for (int i = 0; i < 8; ++i)
+        {
+            digest[i * 4] = static_cast<uint8_t>(m_State[i] >> 24);
+            digest[i * 4 + 1] = static_cast<uint8_t>(m_State[i] >> 16);
+            digest[i * 4 + 2] = static_cast<uint8_t>(m_State[i] >> 8);
+            digest[i * 4 + 3] = static_cast<uint8_t>(m_State[i]);
+        }
+
+        return digest;
+    }
+
+    Hash256 Sha256::Of(std::span<const uint8_t> data)
+    {
+        Sha256 sha;
+        sha.Update(data);
+        return sha.Finish();
+    }
+
+    std::string ToHex(const Hash256& hash)
+    {
+        static constexpr char digits[] = "0123456789abcdef";
+
+        std::string hex;
+        hex.reserve(hash.size() * 2);
+        for (uint8_t b : hash)
+        {
+            hex.push_back(digits[b >> 4]);
+            hex.push_back(digits[b & 15]);
+        }
+
+        return hex;
+    }
+
+    std::optional<Hash256> HashFromHex(std::string_view hex)
+    {
+        if (hex.size() != 64)
+        {
+            return std::nullopt;
+        }
+
+        auto nibble = [](char c) -> int
+        {
+            if (c >= '0' && c <= '9') return c - '0';
+            if (c >= 'a' && c <= 'f') return c - 'a' + 10;
+            if (c >= 'A' && c <= 'F') return c - 'A' + 10;
+            return -1;
+        };
+
+        Hash256 hash;
+        for (size_t i = 0; i < hash.size(); ++i)
+        {
+            int hi = nibble(hex[i * 2]);
+            int lo = nibble(hex[i * 2 + 1]);
+            if (hi < 0 || lo < 0)
+            {
+                return std::nullopt;
+            }
+
+            hash[i] = static_cast<uint8_t>((hi << 4) | lo);
+        }
+
+        return hash;
+    }
+}
\ No newline at end of file
@@ -0,0 +1,148 @@
+#include <cse/introspection.hpp>
+#include <cse/executor.hpp>
+#include <algorithm>
+
+namespace cse
+{
+    // rows scanned per requested item before a page is cut short
+    static constexpr size_t SCAN_FACTOR = 64;
+
+    static const char* Text(const char* text)
+    {
+        return text ? text : "";
+    }
+
+    std::optional<EnumerationKind> EnumerationKindFromName(std::string_view name)
+    {
+        if (name == "assemblies")
+        {
+            return EnumerationKind::Assemblies;
+        }
+
+        if (name == "types")
+        {
+            return EnumerationKind::Types;
+        }
+
+        if (name == "methods")
+        {
+            return EnumerationKind::Methods;
+        }
+
+        return std::nullopt;
+    }
+
+    std::optional<EnumerationPage> EnumerateDomain(MonoDomain* domain, EnumerationKind kind, std::string_view prefix,
+        EnumerationCursor cursor, size_t limit)
+    {
+        static auto& methods = MonoMethods::GetInstance();
+
+        MonoScope scope(domain);
+        auto assemblies = Executor::LoadedAssemblies(domain);
+        if (!assemblies.has_value())
+        {
+            return std::nullopt;
+        }
+
+        EnumerationPage page;
+        const size_t budget = limit * SCAN_FACTOR;
+
+        auto full = [&]()
+        {
+            return page.m_Items.size() >= limit || page.m_Scanned >= budget;
+        };
+
+        for (uint32_t a = cursor.m_Assembly; a < assemblies->size(); ++a)
+        {
+            MonoImage* image = methods.assembly_get_image((*assemblies)[a]);
+            if (!image)
+            {
+                continue;
+            }
+
+            const uint32_t typeRows = static_cast<uint32_t>(methods.image_get_table_rows(image, MONO_TABLE_TYPEDEF));
+
+            if (kind == EnumerationKind::Assemblies)
+            {
+                if (full())
+                {
+                    page.m_Next = EnumerationCursor{ a, 0, 0 };
+                    return page;
+                }
+
+                page.m_Scanned++;
+                page.m_Items.push_back({ a, {}, Text(methods.image_get_name(image)), {}, 0, 0, typeRows });
+                continue;
+            }
+
+            const MonoTableInfo* typeTable = methods.image_get_table_info(image, MONO_TABLE_TYPEDEF);
+            const uint32_t methodRows = static_cast<uint32_t>(methods.image_get_table_rows(image, MONO_TABLE_METHOD));
+            const MonoTableInfo* methodTable = methods.image_get_table_info(image, MONO_TABLE_METHOD);
+
+            // row 0 is <Module>
+            uint32_t firstType = a == cursor.m_Assembly ? std::max<uint32_t>(cursor.m_Type, 1) : 1;
+            for (uint32_t t = firstType; t < typeRows; ++t)
+            {
+                if (full())
+                {
+                    page.m_Next = EnumerationCursor{ a, t, 0 };
+                    return page;
+                }
+
+                page.m_Scanned++;
+
+                uint32_t columns[MONO_TYPEDEF_SIZE];
+                methods.metadata_decode_row(typeTable, static_cast<int>(t), columns, MONO_TYPEDEF_SIZE);
+
+                const char* space = Text(methods.metadata_string_heap(image, columns[MONO_TYPEDEF_NAMESPACE]));
+                if (!std::string_view(space).starts_with(prefix))
+                {
+                    continue;
+                }
+
+                const char* name = Text(methods.metadata_string_heap(image, columns[MONO_TYPEDEF_NAME]));
+
+                // a type's methods run up to the next type's list, method list indices are 1 based
+                uint32_t methodBegin = columns[MONO_TYPEDEF_METHOD_LIST] - 1;
+                uint32_t methodEnd = methodRows;
+                if (t + 1 < typeRows)
+                {
+                    uint32_t next[MONO_TYPEDEF_SIZE];
+                    methods.metadata_decode_row(typeTable, static_cast<int>(t + 1), next, MONO_TYPEDEF_SIZE);
+                    methodEnd = next[MONO_TYPEDEF_METHOD_LIST] - 1;
+                }
+
+                methodEnd = std::min(methodEnd, methodRows);
+                methodBegin = std::min(methodBegin, methodEnd);
+
+                page.m_Assemblies.try_emplace(a, Text(methods.image_get_name(image)));
+
+                if (kind == EnumerationKind::Types)
+                {
+                    page.m_Items.push_back({ a, space, name, {}, MONO_TOKEN_TYPE_DEF | (t + 1), columns[MONO_TYPEDEF_FLAGS], methodEnd - methodBegin });
+                    continue;
+                }
+
+                uint32_t firstMethod = a == cursor.m_Assembly && t == cursor.m_Type ? cursor.m_Method : 0;
+                for (uint32_t m = methodBegin + firstMethod; m < methodEnd; ++m)
+                {
+                    // cut inside the type, the type row itself is scanned again on the next page
+                    if (full())
+                    {
+                        page.m_Next = EnumerationCursor{ a, t, m - methodBegin };
+                        return page;
+                    }
+
+                    page.m_Scanned++;
+
+                    uint32_t method[MONO_METHOD_SIZE];
+                    methods.metadata_decode_row(methodTable, static_cast<int>(m), method, MONO_METHOD_SIZE);
+                    page.m_Items.push_back({ a, space, name, Text(methods.metadata_string_heap(image, method[MONO_METHOD_NAME])),
+                        MONO_TOKEN_METHOD_DEF | (m + 1), method[MONO_METHOD_FLAGS], 0 });
+                }
+            }
+        }
+
+        return page;
+    }
+}
\ No newline at end of file
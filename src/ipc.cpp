@@ -1,18 +1,46 @@
 #include <cse/ipc.hpp>
 #include <cse/console.hpp>
+#include <cse/compression.hpp>
+#include <cse/entry.hpp>
+#include <cse/log.hpp>
 #include <windows.h>
+#include <algorithm>
+#include <condition_variable>
+#include <mutex>
 #include <optional>
+#include <vector>
+#include <cstring>
 
 namespace cse
 {
+    namespace
+    {
+        struct Client
+        {
+            // closed by the client thread under m_ClientsMutex, Shutdown cancels its reads under the same lock
+            HANDLE m_Pipe = INVALID_HANDLE_VALUE;
+            bool m_Done = false;
+            std::thread m_Thread;
+        };
+    }
+
     struct IpcManager::Impl
     {
         IpcCallback m_Callback;
+        IpcDisconnectCallback m_DisconnectCallback;
         std::thread m_ListenerThread;
+        std::atomic_uint64_t m_NextClientId = 1;
         std::atomic_bool m_Running;
 
         HANDLE m_PipeHandle;
 
+        // wakes the listener out of a pending ConnectNamedPipe
+        HANDLE m_StopEvent = NULL;
+
+        std::mutex m_ClientsMutex;
+        std::condition_variable m_ClientDone;
+        std::vector<std::shared_ptr<Client>> m_Clients;
+
     private:
         bool ReadExact(HANDLE pipe, void* buffer, size_t size)
         {
@@ -21,6 +49,11 @@ namespace cse
 
             while (totalRead < size)
             {
+                if (!m_Running)
+                {
+                    return false;
+                }
+
                 DWORD read = 0;
                 if (!ReadFile(pipe, buf + totalRead, static_cast<DWORD>(size - totalRead), &read, NULL) || read == 0)
                 {
@@ -63,28 +96,81 @@ namespace cse
             return true;
         }
 
-        std::optional<nlohmann::json> ReceiveJson(HANDLE pipe)
+        struct Message
+        {
+            nlohmann::json m_Body;
+            uint32_t m_Flags = 0;
+        };
+
+        std::optional<Message> ReceiveJson(HANDLE pipe)
         {
-            uint32_t length = 0;
-            if (!ReadExact(pipe, &length, sizeof(length)))
+            uint32_t header = 0;
+            if (!ReadExact(pipe, &header, sizeof(header)))
             {
                 return std::nullopt;
             }
 
+            Message message;
+            message.m_Flags = header & ~IPC_FRAME_LENGTH_MASK;
+
+            uint32_t length = header & IPC_FRAME_LENGTH_MASK;
             if (length == 0)
             {
-                return nlohmann::json::object();
+                message.m_Body = nlohmann::json::object();
+                return message;
+            }
+
+            // the header alone would let a client make us allocate up to 1 GiB
+            if (length > MAX_PAYLOAD_SIZE)
+            {
+                println("Frame too large: %u", length);
+                return std::nullopt;
             }
 
-            std::vector<char> buffer(length);
+            std::vector<uint8_t> buffer(length);
             if (!ReadExact(pipe, buffer.data(), length))
             {
                 return std::nullopt;
             }
 
+            if (message.m_Flags & IPC_FRAME_LZ4)
+            {
+                uint32_t rawLength = 0;
+                if (length < sizeof(rawLength))
+                {
+                    println("Compressed frame too short.");
+                    return std::nullopt;
+                }
+
+                std::memcpy(&rawLength, buffer.data(), sizeof(rawLength));
+                if (rawLength > MAX_PAYLOAD_SIZE)
+                {
+                    println("Compressed frame too large: %u", rawLength);
+                    return std::nullopt;
+                }
+
+                std::vector<uint8_t> raw(rawLength);
+                if (!Decompress(Codec::Lz4, std::span<const uint8_t>(buffer).subspan(sizeof(rawLength)), raw))
+                {
+                    println("Failed to decompress frame.");
+                    return std::nullopt;
+                }
+
+                buffer = std::move(raw);
+            }
+
             try
             {
-                return nlohmann::json::parse(buffer);
+                if (message.m_Flags & IPC_FRAME_MSGPACK)
+                {
+                    message.m_Body = nlohmann::json::from_msgpack(buffer);
+                }
+                else
+                {
+                    message.m_Body = nlohmann::json::parse(buffer);
+                }
+
+                return message;
             }
             catch(const std::exception& e)
             {
@@ -93,17 +179,47 @@ namespace cse
             }
         }
 
-        bool SendJson(HANDLE pipe, const nlohmann::json& json)
+        bool SendJson(HANDLE pipe, const nlohmann::json& json, uint32_t flags)
         {
-            std::string serialized = json.dump();
-            uint32_t length = static_cast<uint32_t>(serialized.size());
+            std::vector<uint8_t> body;
+            if (flags & IPC_FRAME_MSGPACK)
+            {
+                body = nlohmann::json::to_msgpack(json);
+            }
+            else
+            {
+                std::string serialized = json.dump();
+                body.assign(serialized.begin(), serialized.end());
+            }
+
+            if ((flags & IPC_FRAME_LZ4) && body.size() >= IPC_COMPRESS_THRESHOLD)
+            {
+                uint32_t rawLength = static_cast<uint32_t>(body.size());
+                auto compressed = Compress(Codec::Lz4, body);
+
+                std::vector<uint8_t> framed(sizeof(rawLength) + compressed.size());
+                std::memcpy(framed.data(), &rawLength, sizeof(rawLength));
+                std::memcpy(framed.data() + sizeof(rawLength), compressed.data(), compressed.size());
+                body = std::move(framed);
+            }
+            else
+            {
+                flags &= ~IPC_FRAME_LZ4;
+            }
+
+            if (body.size() > IPC_FRAME_LENGTH_MASK)
+            {
+                println("Reply too large to send: %zu bytes", body.size());
+                return false;
+            }
 
-            if (!WriteAll(pipe, &length, sizeof(length)))
+            uint32_t header = static_cast<uint32_t>(body.size()) | flags;
+            if (!WriteAll(pipe, &header, sizeof(header)))
             {
                 return false;
             }
 
-            if (!WriteAll(pipe, serialized.data(), length))
+            if (!WriteAll(pipe, body.data(), body.size()))
             {
                 return false;
             }
@@ -111,9 +227,10 @@ namespace cse
             return true;
         }
 
-        void ClientThread(HANDLE pipe)
+        void ClientThread(std::shared_ptr<Client> client, uint64_t clientId)
         {
-            while (true)
+            HANDLE pipe = client->m_Pipe;
+            while (m_Running)
             {
                 auto request = ReceiveJson(pipe);
                 if (!request.has_value())
@@ -121,27 +238,103 @@ namespace cse
                     break;
                 }
 
-                auto response = m_Callback(*request);
+                auto response = m_Callback(request->m_Body, clientId);
                 if (response.is_null())
                 {
                     break;
                 }   
 
-                if (!SendJson(pipe, response))
+                if (!SendJson(pipe, response, request->m_Flags))
                 {
                     break;
                 }
             }
 
-            FlushFileBuffers(pipe);
-            DisconnectNamedPipe(pipe);
-            CloseHandle(pipe);
+            // waits for the client to read the last reply, not worth holding up a shutdown for
+            if (m_Running)
+            {
+                FlushFileBuffers(pipe);
+            }
+
+            {
+                std::lock_guard lock(m_ClientsMutex);
+                DisconnectNamedPipe(pipe);
+                CloseHandle(pipe);
+                client->m_Pipe = INVALID_HANDLE_VALUE;
+            }
+
+            if (m_DisconnectCallback)
+            {
+                m_DisconnectCallback(clientId);
+            }
+
+            std::lock_guard lock(m_ClientsMutex);
+            client->m_Done = true;
+            m_ClientDone.notify_all();
+        }
+
+        // requires m_ClientsMutex, a client thread can't join itself so its handle is left to the next connect or Shutdown
+        void ReapClients()
+        {
+            std::erase_if(m_Clients, [](const std::shared_ptr<Client>& client)
+            {
+                if (!client->m_Done)
+                {
+                    return false;
+                }
+
+                client->m_Thread.join();
+                return true;
+            });
+        }
+
+        // the pipe was opened with FILE_FLAG_OVERLAPPED so the wait can be abandoned once m_StopEvent is set
+        bool WaitForClient(HANDLE pipe)
+        {
+            OVERLAPPED overlapped = {};
+            overlapped.hEvent = CreateEventW(NULL, TRUE, FALSE, NULL);
+            if (overlapped.hEvent == NULL)
+            {
+                return false;
+            }
+
+            bool connected = ConnectNamedPipe(pipe, &overlapped) != FALSE;
+            if (!connected)
+            {
+                DWORD error = GetLastError();
+                if (error == ERROR_PIPE_CONNECTED)
+                {
+                    connected = true;
+                }
+                else if (error == ERROR_IO_PENDING)
+                {
+                    HANDLE events[] = { overlapped.hEvent, m_StopEvent };
+                    DWORD transferred = 0;
+                    if (WaitForMultipleObjects(2, events, FALSE, INFINITE) == WAIT_OBJECT_0)
+                    {
+                        connected = GetOverlappedResult(pipe, &overlapped, &transferred, FALSE) != FALSE;
+                    }
+                    else
+                    {
+                        CancelIo(pipe);
+                        GetOverlappedResult(pipe, &overlapped, &transferred, TRUE);
+                    }
+                }
+                else
+                {
+                    println("Failed to connect to named pipe. Error: %x", error);
+                }
+            }
+
+            CloseHandle(overlapped.hEvent);
+            return connected;
         }
 
     public:
         void Initialize(const wchar_t* pipeName)
         {
             m_Running = true;
+            m_StopEvent = CreateEventW(NULL, TRUE, FALSE, NULL);
 
             m_ListenerThread = std::thread([&, pipeName]()
             {
@@ -167,29 +360,92 @@ namespace cse
                     }
 
                     println("Waiting for client to connect to pipe...");
-                    BOOL ok = ConnectNamedPipe(m_PipeHandle, NULL) ? TRUE : (GetLastError() == ERROR_PIPE_CONNECTED);
-                    if (!ok)
+                    if (!WaitForClient(m_PipeHandle))
                     {
-                        println("Failed to connect to named pipe. Error: %x", GetLastError());
                         CloseHandle(m_PipeHandle);
-                        Sleep(1000);
+                        if (m_Running)
+                        {
+                            Sleep(1000);
+                        }
 
                         continue;
                     }
 
                     println("Named pipe created successfully.");
-                    std::thread (&Impl::ClientThread, this, m_PipeHandle).detach();
+
+                    auto client = std::make_shared<Client>();
+                    client->m_Pipe = m_PipeHandle;
+
+                    std::lock_guard lock(m_ClientsMutex);
+                    ReapClients();
+                    client->m_Thread = std::thread(&Impl::ClientThread, this, client, m_NextClientId++);
+                    m_Clients.push_back(std::move(client));
                 }
             });
         }
 
         void Shutdown()
         {
-            m_Running = false;
+            if (!m_Running.exchange(false))
+            {
+                return;
+            }
+
+            SetEvent(m_StopEvent);
             if (m_ListenerThread.joinable())
             {
                 m_ListenerThread.join();
             }
+
+            // idle clients sit in ReadFile until it is cancelled, busy ones leave once their reply is out,
+            // cancelling again each round catches a read that started after the previous cancel
+            std::unique_lock lock(m_ClientsMutex);
+            auto deadline = std::chrono::steady_clock::now() + IPC_SHUTDOWN_GRACE;
+            auto done = [&]()
+            {
+                return std::all_of(m_Clients.begin(), m_Clients.end(), [](const auto& client) { return client->m_Done; });
+            };
+
+            while (!done() && std::chrono::steady_clock::now() < deadline)
+            {
+                for (const auto& client : m_Clients)
+                {
+                    if (client->m_Pipe != INVALID_HANDLE_VALUE)
+                    {
+                        CancelIoEx(client->m_Pipe, NULL);
+                    }
+                }
+
+                m_ClientDone.wait_for(lock, std::chrono::milliseconds(50), done);
+            }
+
+            std::vector<std::shared_ptr<Client>> clients;
+            clients.swap(m_Clients);
+            lock.unlock();
+
+            bool stuck = false;
+            for (auto& client : clients)
+            {
+                if (client->m_Done)
+                {
+                    client->m_Thread.join();
+                }
+                else
+                {
+                    // still waiting on a command, the reply path returns into this module
+                    client->m_Thread.detach();
+                    stuck = true;
+                }
+            }
+
+            CloseHandle(m_StopEvent);
+            m_StopEvent = NULL;
+
+            if (stuck)
+            {
+                log_error("[IPC] Client threads still busy at shutdown, keeping the module loaded");
+                pin_module("ipc client threads are still running commands");
+            }
         }
     };
 
@@ -201,13 +457,32 @@ namespace cse
 
     void IpcManager::Initialize(IpcCallback callback, const wchar_t* pipeName)
     {
-        m_Impl = std::make_unique<Impl>();
+        if (!m_Impl)
+        {
+            m_Impl = std::make_unique<Impl>();
+        }
+
         m_Impl->m_Callback = std::move(callback);
         m_Impl->Initialize(pipeName);
     }
 
+    // set before Initialize, client threads read it without synchronization
+    void IpcManager::OnDisconnect(IpcDisconnectCallback callback)
+    {
+        if (!m_Impl)
+        {
+            m_Impl = std::make_unique<Impl>();
+        }
+
+        m_Impl->m_DisconnectCallback = std::move(callback);
+    }
+
+    // stops accepting connections, then cancels and joins every client thread
     void IpcManager::Shutdown()
     {
-        m_Impl->Shutdown();
+        if (m_Impl)
+        {
+            m_Impl->Shutdown();
+        }
     }
 }
\ No newline at end of file
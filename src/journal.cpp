@@ -0,0 +1,698 @@
+#include <cse/journal.hpp>
+#include <cse/mapped_file.hpp>
+#include <cse/console.hpp>
+#include <cse/log.hpp>
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <charconv>
+#include <cstdio>
+#include <cstring>
+#include <deque>
+#include <mutex>
+#include <thread>
+
+namespace cse
+{
+    namespace
+    {
+        struct SegmentHeader
+        {
+            static constexpr uint32_t MAGIC = 0x4A455343; // "CSEJ"
+            static constexpr uint32_t VERSION = 1;
+
+            uint32_t m_Magic;
+            uint32_t m_Version;
+            uint32_t m_RecordSize;
+            uint32_t m_Capacity;
+            uint64_t m_First;
+
+            // summary of the records, only ever widened by appends: time range, bit per resource id % 64, bit per outcome
+            uint64_t m_MinTimestamp;
+            uint64_t m_MaxTimestamp;
+            uint64_t m_Resources;
+            uint32_t m_Outcomes;
+            uint8_t m_Reserved[76];
+        };
+
+        struct JournalRecord
+        {
+            static constexpr uint8_t REJECTED = 1;
+            static constexpr uint8_t HAS_PDB = 2;
+
+            // index + 1, stored last, anything else means the slot is unwritten or still being written
+            uint64_t m_Sequence;
+            uint64_t m_Timestamp;
+            uint64_t m_Execution;
+            Hash256 m_Hash;
+            int64_t m_HeapDelta;
+            uint32_t m_ResourceId;
+            uint32_t m_ImageSize;
+            uint32_t m_MarshalUs;
+            uint32_t m_RunUs;
+            uint32_t m_TotalUs;
+            uint8_t m_Outcome;
+            uint8_t m_Flags;
+            uint8_t m_Reserved[2];
+            char m_Resource[24];
+            char m_Script[16];
+        };
+
+        // the header takes one record's place, so records stay aligned
+        static_assert(sizeof(SegmentHeader) == 128, "the journal layout is persisted");
+        static_assert(sizeof(JournalRecord) == 128, "the journal layout is persisted");
+
+        constexpr uint64_t SEGMENT_SIZE = sizeof(SegmentHeader) + ExecutionJournal::SEGMENT_RECORDS * sizeof(JournalRecord);
+
+        // segments writers look up without the mutex, by segment number
+        constexpr size_t WRITE_SLOTS = 16;
+
+        constexpr size_t MAX_SEGMENTS_LIMIT = 4096;
+
+        // FNV-1a of the full name
+        uint32_t ResourceId(std::string_view resource)
+        {
+            uint32_t hash = 2166136261u;
+            for (char c : resource)
+            {
+                hash ^= static_cast<uint8_t>(c);
+                hash *= 16777619u;
+            }
+
+            return hash;
+        }
+
+        template <size_t N>
+        void CopyString(char (&out)[N], std::string_view value)
+        {
+            size_t length = std::min(value.size(), N - 1);
+            std::memcpy(out, value.data(), length);
+            std::memset(out + length, 0, N - length);
+        }
+
+        template <size_t N>
+        std::string_view ReadString(const char (&value)[N])
+        {
+            return std::string_view(value, strnlen(value, N));
+        }
+
+        uint32_t ToMicroseconds(double ms)
+        {
+            return static_cast<uint32_t>(std::clamp(ms * 1000.0, 0.0, static_cast<double>(UINT32_MAX)));
+        }
+
+        void WidenMin(uint64_t& target, uint64_t value)
+        {
+            std::atomic_ref<uint64_t> ref(target);
+            uint64_t current = ref.load(std::memory_order_relaxed);
+            while (value < current && !ref.compare_exchange_weak(current, value, std::memory_order_relaxed))
+            {
+            }
+        }
+
+        void WidenMax(uint64_t& target, uint64_t value)
+        {
+            std::atomic_ref<uint64_t> ref(target);
+            uint64_t current = ref.load(std::memory_order_relaxed);
+            while (value > current && !ref.compare_exchange_weak(current, value, std::memory_order_relaxed))
+            {
+            }
+        }
+
+        std::filesystem::path SegmentPath(const std::filesystem::path& directory, uint64_t first)
+        {
+            char name[48];
+            std::snprintf(name, sizeof(name), "journal-%016llx.bin", static_cast<unsigned long long>(first));
+            return directory / name;
+        }
+
+        std::optional<uint64_t> ParseSegmentName(const std::string& name)
+        {
+            static constexpr std::string_view prefix = "journal-";
+            static constexpr std::string_view suffix = ".bin";
+            if (name.size() != prefix.size() + 16 + suffix.size() || !name.starts_with(prefix) || !name.ends_with(suffix))
+            {
+                return std::nullopt;
+            }
+
+            uint64_t first = 0;
+            const char* begin = name.data() + prefix.size();
+            auto [end, ec] = std::from_chars(begin, begin + 16, first, 16);
+            if (ec != std::errc() || end != begin + 16 || first % ExecutionJournal::SEGMENT_RECORDS != 0)
+            {
+                return std::nullopt;
+            }
+
+            return first;
+        }
+
+        struct Segment
+        {
+            uint64_t m_First;
+            std::filesystem::path m_Path;
+            std::unique_ptr<MappedFile> m_File;
+
+            SegmentHeader* GetHeader() const
+            {
+                return reinterpret_cast<SegmentHeader*>(m_File->GetData().data());
+            }
+
+            JournalRecord* GetRecords() const
+            {
+                return reinterpret_cast<JournalRecord*>(m_File->GetData().data() + sizeof(SegmentHeader));
+            }
+
+            static std::atomic_ref<uint64_t> Commit(JournalRecord& record)
+            {
+                return std::atomic_ref<uint64_t>(record.m_Sequence);
+            }
+
+            // records in [first, first + committed) are all this segment ever got, newer appends go to the next one
+            uint64_t CountWritten() const
+            {
+                JournalRecord* records = GetRecords();
+                for (uint64_t slot = ExecutionJournal::SEGMENT_RECORDS; slot > 0; --slot)
+                {
+                    if (Commit(records[slot - 1]).load(std::memory_order_acquire) == m_First + slot)
+                    {
+                        return slot;
+                    }
+                }
+
+                return 0;
+            }
+        };
+
+        bool IsValid(const SegmentHeader& header, uint64_t first, size_t size)
+        {
+            return header.m_Magic == SegmentHeader::MAGIC && header.m_Version == SegmentHeader::VERSION &&
+                header.m_RecordSize == sizeof(JournalRecord) && header.m_Capacity == ExecutionJournal::SEGMENT_RECORDS &&
+                header.m_First == first && size >= SEGMENT_SIZE;
+        }
+
+        JournalEntry ToEntry(const JournalRecord& record, uint64_t index)
+        {
+            JournalEntry entry;
+            entry.m_Index = index;
+            entry.m_Timestamp = record.m_Timestamp;
+            entry.m_Execution = record.m_Execution;
+            entry.m_Hash = record.m_Hash;
+            entry.m_Resource = ReadString(record.m_Resource);
+            entry.m_Script = ReadString(record.m_Script);
+            entry.m_Outcome = static_cast<ExecutionOutcome>(record.m_Outcome);
+            entry.m_Rejected = record.m_Flags & JournalRecord::REJECTED;
+            entry.m_HasPdb = record.m_Flags & JournalRecord::HAS_PDB;
+            entry.m_ImageSize = record.m_ImageSize;
+            entry.m_MarshalMs = record.m_MarshalUs / 1000.0;
+            entry.m_RunMs = record.m_RunUs / 1000.0;
+            entry.m_TotalMs = record.m_TotalUs / 1000.0;
+            entry.m_HeapDelta = record.m_HeapDelta;
+            return entry;
+        }
+    }
+
+    struct ExecutionJournal::Impl
+    {
+        // segment list, opening and creating segments, queries
+        std::mutex m_Mutex;
+        std::filesystem::path m_Directory;
+        std::deque<std::unique_ptr<Segment>> m_Segments;
+        size_t m_MaxSegments = 32;
+
+        std::atomic<bool> m_Opened{ false };
+        std::atomic<bool> m_Enabled{ true };
+        std::atomic<uint64_t> m_Next{ 0 };
+        std::atomic<uint64_t> m_Dropped{ 0 };
+
+        // writers inside Enter/Leave never take the mutex, so unmapping only has to wait for them to drain.
+        // The generation changes on every open, indices reserved before it don't belong to the new journal
+        std::atomic<uint32_t> m_Writers{ 0 };
+        std::atomic<bool> m_Paused{ false };
+        std::atomic<uint64_t> m_Generation{ 0 };
+        std::array<std::atomic<Segment*>, WRITE_SLOTS> m_WriteSlots{};
+
+        bool Enter()
+        {
+            m_Writers.fetch_add(1);
+            if (!m_Paused.load())
+            {
+                return true;
+            }
+
+            m_Writers.fetch_sub(1);
+            return false;
+        }
+
+        void Leave()
+        {
+            m_Writers.fetch_sub(1, std::memory_order_release);
+        }
+
+        // requires m_Mutex, writers waiting in Append block on it until Resume
+        void Quiesce()
+        {
+            m_Paused.store(true);
+            while (m_Writers.load() != 0)
+            {
+                std::this_thread::yield();
+            }
+        }
+
+        void Resume()
+        {
+            m_Paused.store(false);
+        }
+
+        Segment* FindWritable(uint64_t index)
+        {
+            uint64_t first = index - index % SEGMENT_RECORDS;
+            Segment* segment = m_WriteSlots[(first / SEGMENT_RECORDS) % WRITE_SLOTS].load(std::memory_order_acquire);
+            return segment && segment->m_First == first ? segment : nullptr;
+        }
+
+        // require m_Mutex
+        bool OpenLocked(const std::filesystem::path& directory);
+        bool EnsureOpen();
+        Segment* GetOrCreate(uint64_t index);
+        void Prune();
+    };
+
+    ExecutionJournal::ExecutionJournal() : m_Impl(std::make_unique<Impl>()) {}
+    ExecutionJournal::~ExecutionJournal() = default;
+
+    ExecutionJournal& ExecutionJournal::GetInstance()
+    {
+        static ExecutionJournal instance;
+        return instance;
+    }
+
+    bool ExecutionJournal::Open(const std::filesystem::path& directory)
+    {
+        std::lock_guard lock(m_Impl->m_Mutex);
+        return m_Impl->OpenLocked(directory);
+    }
+
+    bool ExecutionJournal::Impl::OpenLocked(const std::filesystem::path& directory)
+    {
+        std::error_code ec;
+        std::filesystem::create_directories(directory, ec);
+        if (ec)
+        {
+            println("[Journal] Failed to create %s: %s", directory.string().c_str(), ec.message().c_str());
+            return false;
+        }
+
+        std::vector<std::pair<uint64_t, std::filesystem::path>> files;
+        for (const auto& file : std::filesystem::directory_iterator(directory, ec))
+        {
+            if (auto first = ParseSegmentName(file.path().filename().string()))
+            {
+                files.emplace_back(*first, file.path());
+            }
+        }
+
+        std::sort(files.begin(), files.end());
+
+        Quiesce();
+
+        for (auto& slot : m_WriteSlots)
+        {
+            slot.store(nullptr, std::memory_order_relaxed);
+        }
+
+        m_Segments.clear();
+        m_Directory = directory;
+
+        for (auto& [first, path] : files)
+        {
+            auto file = MappedFile::OpenWrite(path, 0);
+            if (!file || file->GetSize() < SEGMENT_SIZE || !IsValid(*reinterpret_cast<const SegmentHeader*>(file->GetData().data()), first, file->GetSize()))
+            {
+                println("[Journal] Segment %s is incompatible, removing it", path.string().c_str());
+                file.reset();
+                std::filesystem::remove(path, ec);
+                continue;
+            }
+
+            m_Segments.push_back(std::make_unique<Segment>(Segment{ first, path, std::move(file) }));
+        }
+
+        Prune();
+
+        uint64_t next = 0;
+        if (!m_Segments.empty())
+        {
+            Segment& newest = *m_Segments.back();
+            next = newest.m_First + newest.CountWritten();
+            m_WriteSlots[(newest.m_First / SEGMENT_RECORDS) % WRITE_SLOTS].store(&newest, std::memory_order_release);
+        }
+
+        m_Next.store(next);
+        m_Generation.fetch_add(1);
+        m_Opened.store(true);
+
+        Resume();
+
+        log_info("[Journal] Opened %s with %zu segments, next record %llu", m_Directory.string(), m_Segments.size(), (unsigned long long)next);
+        return true;
+    }
+
+    bool ExecutionJournal::Impl::EnsureOpen()
+    {
+        if (m_Opened.load())
+        {
+            return true;
+        }
+
+        std::error_code ec;
+        auto temp = std::filesystem::temp_directory_path(ec);
+        if (ec)
+        {
+            return false;
+        }
+
+        return OpenLocked(temp / "cse_journal");
+    }
+
+    Segment* ExecutionJournal::Impl::GetOrCreate(uint64_t index)
+    {
+        uint64_t first = index - index % SEGMENT_RECORDS;
+
+        auto it = std::find_if(m_Segments.begin(), m_Segments.end(), [&](const auto& segment) { return segment->m_First == first; });
+        Segment* segment = it != m_Segments.end() ? it->get() : nullptr;
+
+        if (!segment)
+        {
+            auto path = SegmentPath(m_Directory, first);
+            auto file = MappedFile::OpenWrite(path, SEGMENT_SIZE);
+            if (!file)
+            {
+                println("[Journal] Failed to create segment %s", path.string().c_str());
+                return nullptr;
+            }
+
+            // new files are zero filled, this only matters if a stale one was left under the same name
+            auto* header = reinterpret_cast<SegmentHeader*>(file->GetData().data());
+            if (!IsValid(*header, first, file->GetSize()))
+            {
+                std::memset(file->GetData().data(), 0, file->GetSize());
+                header->m_Magic = SegmentHeader::MAGIC;
+                header->m_Version = SegmentHeader::VERSION;
+                header->m_RecordSize = sizeof(JournalRecord);
+                header->m_Capacity = SEGMENT_RECORDS;
+                header->m_First = first;
+                header->m_MinTimestamp = UINT64_MAX;
+            }
+
+            auto created = std::make_unique<Segment>(Segment{ first, path, std::move(file) });
+            segment = created.get();
+
+            auto position = std::find_if(m_Segments.begin(), m_Segments.end(), [&](const auto& other) { return other->m_First > first; });
+            m_Segments.insert(position, std::move(created));
+
+            if (m_Segments.size() > m_MaxSegments)
+            {
+                Quiesce();
+                Prune();
+                Resume();
+
+                // pruned right away, the index is older than everything kept
+                if (m_Segments.empty() || m_Segments.front()->m_First > first)
+                {
+                    return nullptr;
+                }
+            }
+        }
+
+        m_WriteSlots[(first / SEGMENT_RECORDS) % WRITE_SLOTS].store(segment, std::memory_order_release);
+        return segment;
+    }
+
+    void ExecutionJournal::Impl::Prune()
+    {
+        std::error_code ec;
+        while (m_Segments.size() > m_MaxSegments)
+        {
+            Segment* oldest = m_Segments.front().get();
+            for (auto& slot : m_WriteSlots)
+            {
+                Segment* expected = oldest;
+                slot.compare_exchange_strong(expected, nullptr, std::memory_order_relaxed);
+            }
+
+            auto path = oldest->m_Path;
+            m_Segments.pop_front();
+
+            // unmapped first, a mapped file can't be deleted
+            if (!std::filesystem::remove(path, ec))
+            {
+                log_warn("[Journal] Failed to remove %s: %s", path.string(), ec.message());
+            }
+        }
+    }
+
+    void ExecutionJournal::SetEnabled(bool enabled)
+    {
+        m_Impl->m_Enabled.store(enabled);
+    }
+
+    void ExecutionJournal::SetMaxSegments(size_t segments)
+    {
+        std::lock_guard lock(m_Impl->m_Mutex);
+
+        // the newest two stay, a writer may still be finishing in the previous segment
+        m_Impl->m_MaxSegments = std::clamp<size_t>(segments, 2, MAX_SEGMENTS_LIMIT);
+        if (m_Impl->m_Segments.size() > m_Impl->m_MaxSegments)
+        {
+            m_Impl->Quiesce();
+            m_Impl->Prune();
+            m_Impl->Resume();
+        }
+    }
+
+    void ExecutionJournal::Append(const JournalEntry& entry)
+    {
+        auto& impl = *m_Impl;
+        if (!impl.m_Enabled.load(std::memory_order_relaxed))
+        {
+            return;
+        }
+
+        if (!impl.m_Opened.load())
+        {
+            std::lock_guard lock(impl.m_Mutex);
+            if (!impl.EnsureOpen())
+            {
+                impl.m_Dropped.fetch_add(1, std::memory_order_relaxed);
+                return;
+            }
+        }
+
+        // a paused journal is being reopened or pruned under the mutex, waiting on it waits that out
+        while (!impl.Enter())
+        {
+            std::lock_guard lock(impl.m_Mutex);
+        }
+
+        uint64_t generation = impl.m_Generation.load();
+        uint64_t index = impl.m_Next.fetch_add(1, std::memory_order_relaxed);
+
+        Segment* segment = impl.FindWritable(index);
+        if (!segment)
+        {
+            // first record of a new segment (or one evicted from the write slots), mapped outside the section
+            impl.Leave();
+            {
+                std::lock_guard lock(impl.m_Mutex);
+                if (impl.m_Generation.load() == generation)
+                {
+                    impl.GetOrCreate(index);
+                }
+            }
+
+            while (!impl.Enter())
+            {
+                std::lock_guard lock(impl.m_Mutex);
+            }
+
+            segment = impl.m_Generation.load() == generation ? impl.FindWritable(index) : nullptr;
+            if (!segment)
+            {
+                impl.Leave();
+                impl.m_Dropped.fetch_add(1, std::memory_order_relaxed);
+                return;
+            }
+        }
+
+        JournalRecord& record = segment->GetRecords()[index - segment->m_First];
+        record.m_Timestamp = entry.m_Timestamp;
+        record.m_Execution = entry.m_Execution;
+        record.m_Hash = entry.m_Hash;
+        record.m_HeapDelta = entry.m_HeapDelta;
+        record.m_ResourceId = ResourceId(entry.m_Resource);
+        record.m_ImageSize = entry.m_ImageSize;
+        record.m_MarshalUs = ToMicroseconds(entry.m_MarshalMs);
+        record.m_RunUs = ToMicroseconds(entry.m_RunMs);
+        record.m_TotalUs = ToMicroseconds(entry.m_TotalMs);
+        record.m_Outcome = static_cast<uint8_t>(entry.m_Outcome);
+        record.m_Flags = (entry.m_Rejected ? JournalRecord::REJECTED : 0) | (entry.m_HasPdb ? JournalRecord::HAS_PDB : 0);
+        CopyString(record.m_Resource, entry.m_Resource);
+        CopyString(record.m_Script, entry.m_Script);
+
+        SegmentHeader* header = segment->GetHeader();
+        WidenMin(header->m_MinTimestamp, entry.m_Timestamp);
+        WidenMax(header->m_MaxTimestamp, entry.m_Timestamp);
+        std::atomic_ref<uint64_t>(header->m_Resources).fetch_or(1ull << (record.m_ResourceId % 64), std::memory_order_relaxed);
+        std::atomic_ref<uint32_t>(header->m_Outcomes).fetch_or(1u << record.m_Outcome, std::memory_order_relaxed);
+
+        Segment::Commit(record).store(index + 1, std::memory_order_release);
+        impl.Leave();
+    }
+
+    JournalPage ExecutionJournal::Query(const JournalQuery& query)
+    {
+        auto& impl = *m_Impl;
+        std::lock_guard lock(impl.m_Mutex);
+
+        JournalPage page;
+        page.m_Done = true;
+
+        if (!impl.EnsureOpen() || impl.m_Segments.empty() || query.m_Limit == 0)
+        {
+            return page;
+        }
+
+        uint32_t resourceId = 0;
+        std::string resourcePrefix;
+        if (query.m_Resource.has_value())
+        {
+            resourceId = ResourceId(*query.m_Resource);
+            resourcePrefix = query.m_Resource->substr(0, sizeof(JournalRecord::m_Resource) - 1);
+        }
+
+        // the summaries are widened before a record commits, a segment they rule out has no matching record
+        auto mayMatch = [&](SegmentHeader& header)
+        {
+            uint64_t minTimestamp = std::atomic_ref<uint64_t>(header.m_MinTimestamp).load(std::memory_order_relaxed);
+            uint64_t maxTimestamp = std::atomic_ref<uint64_t>(header.m_MaxTimestamp).load(std::memory_order_relaxed);
+            uint64_t resources = std::atomic_ref<uint64_t>(header.m_Resources).load(std::memory_order_relaxed);
+            uint32_t outcomes = std::atomic_ref<uint32_t>(header.m_Outcomes).load(std::memory_order_relaxed);
+
+            return minTimestamp <= query.m_To && maxTimestamp >= query.m_From &&
+                (!query.m_Resource.has_value() || (resources & (1ull << (resourceId % 64)))) &&
+                (!query.m_Outcome.has_value() || (outcomes & (1u << static_cast<uint32_t>(*query.m_Outcome))));
+        };
+
+        auto matches = [&](const JournalRecord& record)
+        {
+            return record.m_Timestamp >= query.m_From && record.m_Timestamp <= query.m_To &&
+                (!query.m_Resource.has_value() || (record.m_ResourceId == resourceId && ReadString(record.m_Resource) == resourcePrefix)) &&
+                (!query.m_Outcome.has_value() || record.m_Outcome == static_cast<uint8_t>(*query.m_Outcome));
+        };
+
+        // false once the page is full or the scan budget is spent, the cursor then points at the next index to read
+        auto visit = [&](Segment& segment, uint64_t index)
+        {
+            JournalRecord& record = segment.GetRecords()[index - segment.m_First];
+            page.m_Scanned++;
+
+            if (Segment::Commit(record).load(std::memory_order_acquire) == index + 1 && matches(record))
+            {
+                page.m_Entries.push_back(ToEntry(record, index));
+            }
+
+            if (page.m_Entries.size() >= query.m_Limit || page.m_Scanned >= MAX_SCAN)
+            {
+                page.m_Cursor = query.m_NewestFirst ? index : index + 1;
+                page.m_Done = query.m_NewestFirst ? index == 0 : page.m_Cursor >= impl.m_Next.load();
+                return false;
+            }
+
+            return true;
+        };
+
+        uint64_t next = impl.m_Next.load();
+
+        if (!query.m_NewestFirst)
+        {
+            for (auto& segment : impl.m_Segments)
+            {
+                uint64_t end = std::min(segment->m_First + SEGMENT_RECORDS, next);
+                uint64_t start = std::max(segment->m_First, query.m_Cursor);
+                if (start >= end || !mayMatch(*segment->GetHeader()))
+                {
+                    continue;
+                }
+
+                for (uint64_t index = start; index < end; ++index)
+                {
+                    if (!visit(*segment, index))
+                    {
+                        return page;
+                    }
+                }
+            }
+
+            page.m_Cursor = next;
+            return page;
+        }
+
+        uint64_t cursor = query.m_Cursor ? query.m_Cursor : next;
+        for (auto it = impl.m_Segments.rbegin(); it != impl.m_Segments.rend(); ++it)
+        {
+            Segment& segment = **it;
+            uint64_t end = std::min({ segment.m_First + SEGMENT_RECORDS, next, cursor });
+            if (end <= segment.m_First || !mayMatch(*segment.GetHeader()))
+            {
+                continue;
+            }
+
+            for (uint64_t index = end; index-- > segment.m_First;)
+            {
+                if (!visit(segment, index))
+                {
+                    return page;
+                }
+            }
+        }
+
+        page.m_Cursor = 0;
+        return page;
+    }
+
+    JournalStats ExecutionJournal::GetStats()
+    {
+        auto& impl = *m_Impl;
+        std::lock_guard lock(impl.m_Mutex);
+
+        JournalStats stats;
+        impl.EnsureOpen();
+
+        stats.m_Directory = impl.m_Directory;
+        stats.m_Enabled = impl.m_Enabled.load();
+        stats.m_Segments = impl.m_Segments.size();
+        stats.m_MaxSegments = impl.m_MaxSegments;
+        stats.m_Next = impl.m_Next.load();
+        stats.m_Oldest = impl.m_Segments.empty() ? stats.m_Next : impl.m_Segments.front()->m_First;
+        stats.m_Dropped = impl.m_Dropped.load();
+
+        for (auto& segment : impl.m_Segments)
+        {
+            stats.m_Bytes += segment->m_File->GetSize();
+        }
+
+        return stats;
+    }
+
+    void ExecutionJournal::Flush()
+    {
+        auto& impl = *m_Impl;
+        std::lock_guard lock(impl.m_Mutex);
+
+        // nothing flushes a segment when writing moves past it, clean pages cost next to nothing here
+        for (auto& segment : impl.m_Segments)
+        {
+            segment->m_File->Flush();
+        }
+    }
+}
\ No newline at end of file
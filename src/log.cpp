@@ -0,0 +1,471 @@
+#include <cse/log.hpp>
+#include <windows.h>
+#include <cstdarg>
+#include <cstdio>
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include <map>
+#include <chrono>
+#include <algorithm>
+
+namespace cse
+{
+    const char* LogLevelName(LogLevel level)
+    {
+        switch (level)
+        {
+        case LogLevel::Trace:
+            return "trace";
+        case LogLevel::Debug:
+            return "debug";
+        case LogLevel::Info:
+            return "info";
+        case LogLevel::Warn:
+            return "warn";
+        case LogLevel::Error:
+            return "error";
+        default:
+            return "unknown";
+        }
+    }
+
+    namespace logging
+    {
+        struct RecordHeader
+        {
+            // whole record including this header, 8 byte aligned; 0 marks the unused tail before a wrap
+            uint32_t m_Size;
+            uint32_t m_PayloadSize;
+            uint64_t m_Timestamp;
+            const char* m_Format;
+
+            // nullptr when the payload is already formatted text
+            Formatter m_Formatter;
+            LogLevel m_Level;
+        };
+
+        // single producer (the owning thread), single consumer (the logger thread)
+        struct Ring
+        {
+            static constexpr size_t CAPACITY = 64 * 1024;
+
+            alignas(64) std::atomic<uint64_t> m_Head{ 0 };
+            alignas(64) std::atomic<uint64_t> m_Tail{ 0 };
+
+            std::atomic<uint64_t> m_Dropped{ 0 };
+            std::atomic<bool> m_Abandoned{ false };
+
+            // producer only, head after the reservation in progress
+            uint64_t m_Pending = 0;
+
+            uint32_t m_ThreadId = 0;
+            std::unique_ptr<uint8_t[]> m_Buffer = std::make_unique<uint8_t[]>(CAPACITY);
+        };
+
+        struct Logger
+        {
+            using clock = std::chrono::steady_clock;
+
+            std::mutex m_RingsMutex;
+            std::vector<std::shared_ptr<Ring>> m_Rings;
+            uint64_t m_RetiredDropped = 0;
+
+            std::atomic<uint8_t> m_Level{ static_cast<uint8_t>(CSE_LOG_MIN_LEVEL) };
+
+            // nothing is captured while no sink would see it
+            std::atomic<bool> m_HasSink{ false };
+
+            std::mutex m_SinkMutex;
+            bool m_Console = false;
+            FILE* m_File = nullptr;
+            std::map<uint64_t, LogSubscriber> m_Subscribers;
+            uint64_t m_NextSubscriber = 1;
+
+            std::atomic<uint64_t> m_Written{ 0 };
+
+            std::thread m_Thread;
+            std::atomic<bool> m_Running{ false };
+            clock::time_point m_Start = clock::now();
+
+            static Logger& GetInstance()
+            {
+                static Logger instance;
+                return instance;
+            }
+
+            ~Logger()
+            {
+                if (m_Thread.joinable())
+                {
+                    m_Thread.detach();
+                }
+            }
+
+            // requires m_SinkMutex
+            void UpdateHasSink()
+            {
+                m_HasSink.store(m_Console || m_File || !m_Subscribers.empty(), std::memory_order_relaxed);
+            }
+
+            Ring& LocalRing()
+            {
+                struct Owner
+                {
+                    std::shared_ptr<Ring> m_Ring;
+
+                    ~Owner()
+                    {
+                        // the logger thread drains what is left and then forgets the ring
+                        if (m_Ring)
+                        {
+                            m_Ring->m_Abandoned.store(true, std::memory_order_release);
+                        }
+                    }
+                };
+
+                static thread_local Owner owner;
+                if (!owner.m_Ring)
+                {
+                    owner.m_Ring = std::make_shared<Ring>();
+                    owner.m_Ring->m_ThreadId = GetCurrentThreadId();
+
+                    std::lock_guard lock(m_RingsMutex);
+                    m_Rings.push_back(owner.m_Ring);
+                }
+
+                return *owner.m_Ring;
+            }
+
+            // drains one ring into the sinks, returns the number of records consumed
+            size_t Drain(Ring& ring, std::string& console)
+            {
+                size_t count = 0;
+                uint64_t tail = ring.m_Tail.load(std::memory_order_relaxed);
+                uint64_t head = ring.m_Head.load(std::memory_order_acquire);
+
+                std::string line;
+                while (tail != head)
+                {
+                    size_t offset = tail % Ring::CAPACITY;
+                    const auto* header = reinterpret_cast<const RecordHeader*>(ring.m_Buffer.get() + offset);
+
+                    if (header->m_Size == 0)
+                    {
+                        tail += Ring::CAPACITY - offset;
+                        continue;
+                    }
+
+                    const uint8_t* payload = reinterpret_cast<const uint8_t*>(header + 1);
+
+                    line.clear();
+                    if (header->m_Formatter)
+                    {
+                        header->m_Formatter(header->m_Format, payload, line);
+                    }
+                    else
+                    {
+                        line.assign(reinterpret_cast<const char*>(payload), header->m_PayloadSize);
+                    }
+
+                    Emit(ring, *header, line, console);
+
+                    tail += header->m_Size;
+                    ring.m_Tail.store(tail, std::memory_order_release);
+                    count++;
+                }
+
+                return count;
+            }
+
+            // requires m_SinkMutex
+            void Emit(const Ring& ring, const RecordHeader& header, const std::string& line, std::string& console)
+            {
+                if (m_Console)
+                {
+                    console.append(line);
+                    console.push_back('\n');
+                }
+
+                if (m_File)
+                {
+                    double seconds = std::chrono::duration<double>(clock::duration(header.m_Timestamp) - m_Start.time_since_epoch()).count();
+                    fprintf(m_File, "[%12.6f] [%-5s] [%5u] %s\n", seconds, LogLevelName(header.m_Level), ring.m_ThreadId, line.c_str());
+                }
+
+                for (const auto& [id, subscriber] : m_Subscribers)
+                {
+                    subscriber(header.m_Level, line);
+                }
+
+                m_Written.fetch_add(1, std::memory_order_relaxed);
+            }
+
+            size_t DrainAll()
+            {
+                std::vector<std::shared_ptr<Ring>> rings;
+                {
+                    std::lock_guard lock(m_RingsMutex);
+                    rings = m_Rings;
+                }
+
+                size_t count = 0;
+                std::string console;
+                {
+                    std::lock_guard lock(m_SinkMutex);
+                    for (auto& ring : rings)
+                    {
+                        count += Drain(*ring, console);
+                    }
+
+                    // one write per pass instead of one per line
+                    if (!console.empty())
+                    {
+                        fwrite(console.data(), 1, console.size(), stdout);
+                        fflush(stdout);
+                    }
+
+                    if (m_File && count)
+                    {
+                        fflush(m_File);
+                    }
+                }
+
+                std::lock_guard lock(m_RingsMutex);
+                std::erase_if(m_Rings, [&](const std::shared_ptr<Ring>& ring)
+                {
+                    bool finished = ring->m_Abandoned.load(std::memory_order_acquire) &&
+                        ring->m_Tail.load(std::memory_order_relaxed) == ring->m_Head.load(std::memory_order_acquire);
+
+                    if (finished)
+                    {
+                        m_RetiredDropped += ring->m_Dropped.load(std::memory_order_relaxed);
+                    }
+
+                    return finished;
+                });
+
+                return count;
+            }
+
+            void Run()
+            {
+                while (m_Running.load(std::memory_order_acquire))
+                {
+                    if (DrainAll() == 0)
+                    {
+                        std::this_thread::sleep_for(std::chrono::milliseconds(2));
+                    }
+                }
+
+                DrainAll();
+            }
+        };
+
+        void FormatPrintf(std::string& out, const char* fmt, ...)
+        {
+            char buffer[512];
+
+            va_list args;
+            va_start(args, fmt);
+            int length = vsnprintf(buffer, sizeof(buffer), fmt, args);
+            va_end(args);
+
+            if (length < 0)
+            {
+                return;
+            }
+
+            if (static_cast<size_t>(length) < sizeof(buffer))
+            {
+                out.append(buffer, length);
+                return;
+            }
+
+            size_t offset = out.size();
+            out.resize(offset + length + 1);
+
+            va_start(args, fmt);
+            vsnprintf(out.data() + offset, length + 1, fmt, args);
+            va_end(args);
+
+            out.resize(offset + length);
+        }
+
+        bool IsEnabled(LogLevel level)
+        {
+            static auto& logger = Logger::GetInstance();
+            return static_cast<uint8_t>(level) >= logger.m_Level.load(std::memory_order_relaxed) &&
+                logger.m_HasSink.load(std::memory_order_relaxed);
+        }
+
+        uint8_t* Reserve(LogLevel level, const char* fmt, Formatter formatter, size_t payloadSize)
+        {
+            static auto& logger = Logger::GetInstance();
+            Ring& ring = logger.LocalRing();
+
+            size_t total = (sizeof(RecordHeader) + payloadSize + 7) & ~size_t(7);
+            if (total > Ring::CAPACITY / 2)
+            {
+                ring.m_Dropped.fetch_add(1, std::memory_order_relaxed);
+                return nullptr;
+            }
+
+            uint64_t head = ring.m_Head.load(std::memory_order_relaxed);
+            uint64_t tail = ring.m_Tail.load(std::memory_order_acquire);
+
+            size_t offset = head % Ring::CAPACITY;
+            size_t contiguous = Ring::CAPACITY - offset;
+            size_t needed = contiguous < total ? contiguous + total : total;
+
+            if (head - tail + needed > Ring::CAPACITY)
+            {
+                // never wait on the logger thread, losing a line beats stalling the caller
+                ring.m_Dropped.fetch_add(1, std::memory_order_relaxed);
+                return nullptr;
+            }
+
+            if (contiguous < total)
+            {
+                reinterpret_cast<RecordHeader*>(ring.m_Buffer.get() + offset)->m_Size = 0;
+                head += contiguous;
+                offset = 0;
+            }
+
+            auto* header = reinterpret_cast<RecordHeader*>(ring.m_Buffer.get() + offset);
+            header->m_Size = static_cast<uint32_t>(total);
+            header->m_PayloadSize = static_cast<uint32_t>(payloadSize);
+            header->m_Timestamp = Logger::clock::now().time_since_epoch().count();
+            header->m_Format = fmt;
+            header->m_Formatter = formatter;
+            header->m_Level = level;
+
+            ring.m_Pending = head + total;
+            return reinterpret_cast<uint8_t*>(header + 1);
+        }
+
+        void Commit()
+        {
+            static auto& logger = Logger::GetInstance();
+            Ring& ring = logger.LocalRing();
+            ring.m_Head.store(ring.m_Pending, std::memory_order_release);
+        }
+    }
+
+    void log_text(LogLevel level, std::string_view text)
+    {
+        if (!logging::IsEnabled(level))
+            return;
+
+        uint8_t* out = logging::Reserve(level, nullptr, nullptr, text.size());
+        if (!out)
+            return;
+
+        std::memcpy(out, text.data(), text.size());
+        logging::Commit();
+    }
+
+    void set_log_level(LogLevel level)
+    {
+        uint8_t value = std::max<uint8_t>(static_cast<uint8_t>(level), CSE_LOG_MIN_LEVEL);
+        logging::Logger::GetInstance().m_Level.store(value, std::memory_order_relaxed);
+    }
+
+    LogLevel get_log_level()
+    {
+        return static_cast<LogLevel>(logging::Logger::GetInstance().m_Level.load(std::memory_order_relaxed));
+    }
+
+    void set_log_console(bool enabled)
+    {
+        auto& logger = logging::Logger::GetInstance();
+        std::lock_guard lock(logger.m_SinkMutex);
+        logger.m_Console = enabled;
+        logger.UpdateHasSink();
+    }
+
+    bool set_log_file(const std::string& path)
+    {
+        auto& logger = logging::Logger::GetInstance();
+
+        FILE* file = nullptr;
+        if (!path.empty() && fopen_s(&file, path.c_str(), "ab") != 0)
+        {
+            return false;
+        }
+
+        std::lock_guard lock(logger.m_SinkMutex);
+        if (logger.m_File)
+        {
+            fclose(logger.m_File);
+        }
+
+        logger.m_File = file;
+        logger.UpdateHasSink();
+        return true;
+    }
+
+    uint64_t add_log_subscriber(LogSubscriber subscriber)
+    {
+        auto& logger = logging::Logger::GetInstance();
+        std::lock_guard lock(logger.m_SinkMutex);
+
+        uint64_t id = logger.m_NextSubscriber++;
+        logger.m_Subscribers.emplace(id, std::move(subscriber));
+        logger.UpdateHasSink();
+        return id;
+    }
+
+    void remove_log_subscriber(uint64_t id)
+    {
+        auto& logger = logging::Logger::GetInstance();
+        std::lock_guard lock(logger.m_SinkMutex);
+        logger.m_Subscribers.erase(id);
+        logger.UpdateHasSink();
+    }
+
+    LogStats get_log_stats()
+    {
+        auto& logger = logging::Logger::GetInstance();
+
+        LogStats stats;
+        stats.m_Written = logger.m_Written.load(std::memory_order_relaxed);
+
+        std::lock_guard lock(logger.m_RingsMutex);
+        stats.m_Dropped = logger.m_RetiredDropped;
+        for (const auto& ring : logger.m_Rings)
+        {
+            stats.m_Dropped += ring->m_Dropped.load(std::memory_order_relaxed);
+        }
+
+        stats.m_Rings = logger.m_Rings.size();
+        return stats;
+    }
+
+    void start_logger()
+    {
+        auto& logger = logging::Logger::GetInstance();
+        if (logger.m_Running.exchange(true))
+        {
+            return;
+        }
+
+        logger.m_Thread = std::thread(&logging::Logger::Run, &logger);
+    }
+
+    void stop_logger()
+    {
+        auto& logger = logging::Logger::GetInstance();
+        if (!logger.m_Running.exchange(false))
+        {
+            return;
+        }
+
+        if (logger.m_Thread.joinable())
+        {
+            logger.m_Thread.join();
+        }
+    }
+}
\ No newline at end of file
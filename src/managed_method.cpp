@@ -0,0 +1,93 @@
+#include <cse/managed_method.hpp>
+#include <cstring>
+
+namespace cse
+{
+    ManagedException DescribeException(MonoObject* exception)
+    {
+        static auto& methods = MonoMethods::GetInstance();
+
+        ManagedException result;
+        if (!exception)
+        {
+            return result;
+        }
+
+        if (MonoClass* klass = methods.object_get_class(exception))
+        {
+            result.m_Type = ClassFullName(klass);
+        }
+
+        // ToString itself may throw, the type is still worth reporting then
+        MonoObject* nested = nullptr;
+        MonoString* text = methods.object_to_string(exception, &nested);
+        if (text && !nested)
+        {
+            result.m_Message = marshal::Traits<std::string>::From(text);
+        }
+
+        return result;
+    }
+
+    std::string ClassFullName(MonoClass* klass)
+    {
+        static auto& methods = MonoMethods::GetInstance();
+
+        const char* space = methods.class_get_namespace(klass);
+        std::string name = space && *space ? std::string(space) + "." : std::string();
+        name += methods.class_get_name(klass);
+        return name;
+    }
+
+    std::string MethodFullName(MonoMethod* method)
+    {
+        static auto& methods = MonoMethods::GetInstance();
+
+        MonoClass* klass = methods.method_get_class(method);
+        std::string name = klass ? ClassFullName(klass) : std::string();
+        name += "::";
+        name += methods.method_get_name(method);
+        return name;
+    }
+
+    namespace marshal
+    {
+        MonoString* Traits<std::string_view>::To(MonoDomain* domain, std::string_view value)
+        {
+            static auto& methods = MonoMethods::GetInstance();
+            return methods.string_new_len(domain, value.data(), static_cast<uint32_t>(value.size()));
+        }
+
+        std::string Traits<std::string>::From(MonoString* value)
+        {
+            static auto& methods = MonoMethods::GetInstance();
+
+            if (!value)
+            {
+                return {};
+            }
+
+            std::string result;
+            if (char* text = methods.string_to_utf8(value))
+            {
+                result = text;
+                methods.free(text);
+            }
+
+            return result;
+        }
+
+        MonoArray* Traits<std::span<const uint8_t>>::To(MonoDomain* domain, std::span<const uint8_t> value)
+        {
+            static auto& methods = MonoMethods::GetInstance();
+
+            MonoArray* array = methods.array_new(domain, methods.get_byte_class(), value.size());
+            if (array && !value.empty())
+            {
+                std::memcpy(methods.array_addr_with_size(array, sizeof(uint8_t), 0), value.data(), value.size());
+            }
+
+            return array;
+        }
+    }
+}
\ No newline at end of file
@@ -0,0 +1,92 @@
+#include <cse/mapped_file.hpp>
+#include <cse/console.hpp>
+#include <windows.h>
+#include <algorithm>
+
+namespace cse
+{
+    std::unique_ptr<MappedFile> MappedFile::OpenRead(const std::filesystem::path& path)
+    {
+        return Open(path, false, 0);
+    }
+
+    std::unique_ptr<MappedFile> MappedFile::OpenWrite(const std::filesystem::path& path, size_t size)
+    {
+        return Open(path, true, size);
+    }
+
+    std::unique_ptr<MappedFile> MappedFile::Open(const std::filesystem::path& path, bool write, size_t size)
+    {
+        std::unique_ptr<MappedFile> mapped(new MappedFile());
+
+        DWORD access = write ? GENERIC_READ | GENERIC_WRITE : GENERIC_READ;
+        // readers don't lock out a writer that still has the file open, e.g. a compiler finishing its output
+        DWORD share = write ? FILE_SHARE_READ : FILE_SHARE_READ | FILE_SHARE_WRITE | FILE_SHARE_DELETE;
+
+        mapped->m_File = CreateFileW(path.wstring().c_str(), access, share, nullptr, write ? OPEN_ALWAYS : OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+        if (mapped->m_File == INVALID_HANDLE_VALUE)
+        {
+            mapped->m_File = nullptr;
+            return nullptr;
+        }
+
+        LARGE_INTEGER fileSize{};
+        if (!GetFileSizeEx(mapped->m_File, &fileSize))
+        {
+            return nullptr;
+        }
+
+        // a mapping larger than the file grows the file
+        size_t mappedSize = std::max<size_t>(static_cast<size_t>(fileSize.QuadPart), size);
+        if (mappedSize == 0)
+        {
+            // an empty file can't be mapped, it is still a valid file with no data
+            return mapped;
+        }
+
+        mapped->m_Mapping = CreateFileMappingW(mapped->m_File, nullptr, write ? PAGE_READWRITE : PAGE_READONLY,
+            static_cast<DWORD>(static_cast<uint64_t>(mappedSize) >> 32), static_cast<DWORD>(mappedSize), nullptr);
+
+        if (!mapped->m_Mapping)
+        {
+            println("[MappedFile] Failed to map %s. Error: %x", path.string().c_str(), GetLastError());
+            return nullptr;
+        }
+
+        mapped->m_View = static_cast<uint8_t*>(MapViewOfFile(mapped->m_Mapping, write ? FILE_MAP_WRITE : FILE_MAP_READ, 0, 0, mappedSize));
+        if (!mapped->m_View)
+        {
+            println("[MappedFile] Failed to map a view of %s. Error: %x", path.string().c_str(), GetLastError());
+            return nullptr;
+        }
+
+        mapped->m_Size = mappedSize;
+        return mapped;
+    }
+
+    MappedFile::~MappedFile()
+    {
+        if (m_View)
+        {
+            UnmapViewOfFile(m_View);
+        }
+
+        if (m_Mapping)
+        {
+            CloseHandle(m_Mapping);
+        }
+
+        if (m_File)
+        {
+            CloseHandle(m_File);
+        }
+    }
+
+    void MappedFile::Flush(size_t offset, size_t length)
+    {
+        if (m_View)
+        {
+            FlushViewOfFile(m_View + offset, length);
+        }
+    }
+}
\ No newline at end of file
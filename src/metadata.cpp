@@ -0,0 +1,533 @@
+#include <cse/metadata.hpp>
+#include <algorithm>
+#include <array>
+#include <cstring>
+
+namespace cse
+{
+    namespace
+    {
+        constexpr uint16_t IMAGE_DOS_MAGIC = 0x5A4D;            // MZ
+        constexpr uint32_t IMAGE_PE_SIGNATURE = 0x00004550;     // PE\0\0
+        constexpr uint16_t IMAGE_OPTIONAL_MAGIC_PE32 = 0x10B;
+        constexpr uint16_t IMAGE_OPTIONAL_MAGIC_PE32PLUS = 0x20B;
+        constexpr uint32_t IMAGE_DIRECTORY_CLI = 14;
+        constexpr uint32_t METADATA_SIGNATURE = 0x424A5342;     // BSJB
+
+        constexpr uint16_t IMAGE_MACHINE_I386 = 0x014C;
+        constexpr uint16_t IMAGE_MACHINE_AMD64 = 0x8664;
+
+        // bounds checked little endian reads, every offset in an image is untrusted
+        class Reader
+        {
+        private:
+            std::span<const uint8_t> m_Data;
+
+        public:
+            explicit Reader(std::span<const uint8_t> data) : m_Data(data) {}
+
+            bool Has(uint64_t offset, uint64_t size) const
+            {
+                return offset <= m_Data.size() && size <= m_Data.size() - offset;
+            }
+
+            template<typename T>
+            bool Read(uint64_t offset, T& value) const
+            {
+                if (!Has(offset, sizeof(T)))
+                    return false;
+
+                std::memcpy(&value, m_Data.data() + offset, sizeof(T));
+                return true;
+            }
+
+            std::span<const uint8_t> Slice(uint64_t offset, uint64_t size) const
+            {
+                return Has(offset, size) ? m_Data.subspan(offset, size) : std::span<const uint8_t>{};
+            }
+        };
+
+        uint32_t ReadIndex(const uint8_t*& cursor, uint8_t size)
+        {
+            uint32_t value = cursor[0] | (cursor[1] << 8);
+            if (size == 4)
+            {
+                value |= (cursor[2] << 16) | (static_cast<uint32_t>(cursor[3]) << 24);
+            }
+
+            cursor += size;
+            return value;
+        }
+
+        // metadata table numbers, ECMA-335 II.22
+        enum Table : uint8_t
+        {
+            Module = 0x00, TypeRef = 0x01, TypeDef = 0x02, FieldPtr = 0x03, Field = 0x04, MethodPtr = 0x05,
+            MethodDef = 0x06, ParamPtr = 0x07, Param = 0x08, InterfaceImpl = 0x09, MemberRef = 0x0A,
+            Constant = 0x0B, CustomAttribute = 0x0C, FieldMarshal = 0x0D, DeclSecurity = 0x0E,
+            ClassLayout = 0x0F, FieldLayout = 0x10, StandAloneSig = 0x11, EventMap = 0x12, EventPtr = 0x13,
+            Event = 0x14, PropertyMap = 0x15, PropertyPtr = 0x16, Property = 0x17, MethodSemantics = 0x18,
+            MethodImpl = 0x19, ModuleRef = 0x1A, TypeSpec = 0x1B, ImplMap = 0x1C, FieldRVA = 0x1D,
+            EncLog = 0x1E, EncMap = 0x1F, Assembly = 0x20, AssemblyProcessor = 0x21, AssemblyOS = 0x22,
+            AssemblyRef = 0x23, AssemblyRefProcessor = 0x24, AssemblyRefOS = 0x25, File = 0x26,
+            ExportedType = 0x27, ManifestResource = 0x28, NestedClass = 0x29, GenericParam = 0x2A,
+            MethodSpec = 0x2B, GenericParamConstraint = 0x2C,
+            TableCount = 0x2D
+        };
+
+        // 0xFF marks tag values that are not used
+        struct CodedIndex
+        {
+            uint8_t m_TagBits;
+            std::array<uint8_t, 22> m_Tables;
+            uint8_t m_Count;
+        };
+
+        constexpr CodedIndex TypeDefOrRef{ 2, { TypeDef, TypeRef, TypeSpec }, 3 };
+        constexpr CodedIndex HasConstant{ 2, { Field, Param, Property }, 3 };
+        constexpr CodedIndex HasCustomAttribute{ 5, { MethodDef, Field, TypeRef, TypeDef, Param, InterfaceImpl, MemberRef, Module,
+            DeclSecurity, Property, Event, StandAloneSig, ModuleRef, TypeSpec, Assembly, AssemblyRef, File, ExportedType,
+            ManifestResource, GenericParam, GenericParamConstraint, MethodSpec }, 22 };
+        constexpr CodedIndex HasFieldMarshal{ 1, { Field, Param }, 2 };
+        constexpr CodedIndex HasDeclSecurity{ 2, { TypeDef, MethodDef, Assembly }, 3 };
+        constexpr CodedIndex MemberRefParent{ 3, { TypeDef, TypeRef, ModuleRef, MethodDef, TypeSpec }, 5 };
+        constexpr CodedIndex HasSemantics{ 1, { Event, Property }, 2 };
+        constexpr CodedIndex MethodDefOrRef{ 1, { MethodDef, MemberRef }, 2 };
+        constexpr CodedIndex MemberForwarded{ 1, { Field, MethodDef }, 2 };
+        constexpr CodedIndex Implementation{ 2, { File, AssemblyRef, ExportedType }, 3 };
+        constexpr CodedIndex CustomAttributeType{ 3, { 0xFF, 0xFF, MethodDef, MemberRef, 0xFF }, 5 };
+        constexpr CodedIndex ResolutionScope{ 2, { Module, ModuleRef, AssemblyRef, TypeRef }, 4 };
+        constexpr CodedIndex TypeOrMethodDef{ 1, { TypeDef, MethodDef }, 2 };
+
+        struct Layout
+        {
+            std::array<uint32_t, TableCount> m_Rows{};
+            uint8_t m_String = 2;
+            uint8_t m_Guid = 2;
+            uint8_t m_Blob = 2;
+
+            uint8_t Index(Table table) const
+            {
+                return m_Rows[table] < 0x10000 ? 2 : 4;
+            }
+
+            uint8_t Coded(const CodedIndex& coded) const
+            {
+                uint32_t largest = 0;
+                for (uint8_t i = 0; i < coded.m_Count; ++i)
+                {
+                    if (coded.m_Tables[i] != 0xFF)
+                    {
+                        largest = std::max(largest, m_Rows[coded.m_Tables[i]]);
+                    }
+                }
+
+                return largest < (1u << (16 - coded.m_TagBits)) ? 2 : 4;
+            }
+
+            uint32_t RowSize(uint8_t table) const
+            {
+                const uint32_t s = m_String, g = m_Guid, b = m_Blob;
+
+                switch (table)
+                {
+                case Module: return 2 + s + g * 3;
+                case TypeRef: return Coded(ResolutionScope) + s * 2;
+                case TypeDef: return 4 + s * 2 + Coded(TypeDefOrRef) + Index(Field) + Index(MethodDef);
+                case FieldPtr: return Index(Field);
+                case Field: return 2 + s + b;
+                case MethodPtr: return Index(MethodDef);
+                case MethodDef: return 4 + 2 + 2 + s + b + Index(Param);
+                case ParamPtr: return Index(Param);
+                case Param: return 2 + 2 + s;
+                case InterfaceImpl: return Index(TypeDef) + Coded(TypeDefOrRef);
+                case MemberRef: return Coded(MemberRefParent) + s + b;
+                case Constant: return 2 + Coded(HasConstant) + b;
+                case CustomAttribute: return Coded(HasCustomAttribute) + Coded(CustomAttributeType) + b;
+                case FieldMarshal: return Coded(HasFieldMarshal) + b;
+                case DeclSecurity: return 2 + Coded(HasDeclSecurity) + b;
+                case ClassLayout: return 2 + 4 + Index(TypeDef);
+                case FieldLayout: return 4 + Index(Field);
+                case StandAloneSig: return b;
+                case EventMap: return Index(TypeDef) + Index(Event);
+                case EventPtr: return Index(Event);
+                case Event: return 2 + s + Coded(TypeDefOrRef);
+                case PropertyMap: return Index(TypeDef) + Index(Property);
+                case PropertyPtr: return Index(Property);
+                case Property: return 2 + s + b;
+                case MethodSemantics: return 2 + Index(MethodDef) + Coded(HasSemantics);
+                case MethodImpl: return Index(TypeDef) + Coded(MethodDefOrRef) * 2;
+                case ModuleRef: return s;
+                case TypeSpec: return b;
+                case ImplMap: return 2 + Coded(MemberForwarded) + s + Index(ModuleRef);
+                case FieldRVA: return 4 + Index(Field);
+                case EncLog: return 4 + 4;
+                case EncMap: return 4;
+                case Assembly: return 4 + 2 * 4 + 4 + b + s * 2;
+                case AssemblyProcessor: return 4;
+                case AssemblyOS: return 4 * 3;
+                case AssemblyRef: return 2 * 4 + 4 + b + s * 2 + b;
+                case AssemblyRefProcessor: return 4 + Index(AssemblyRef);
+                case AssemblyRefOS: return 4 * 3 + Index(AssemblyRef);
+                case File: return 4 + s + b;
+                case ExportedType: return 4 + 4 + s * 2 + Coded(Implementation);
+                case ManifestResource: return 4 + 4 + s + Coded(Implementation);
+                case NestedClass: return Index(TypeDef) * 2;
+                case GenericParam: return 2 + 2 + Coded(TypeOrMethodDef) + s;
+                case MethodSpec: return Coded(MethodDefOrRef) + b;
+                case GenericParamConstraint: return Index(GenericParam) + Coded(TypeDefOrRef);
+                default: return 0;
+                }
+            }
+        };
+
+        struct Heaps
+        {
+            std::span<const uint8_t> m_Strings;
+            std::span<const uint8_t> m_Blob;
+
+            std::string_view String(uint32_t index) const
+            {
+                if (index >= m_Strings.size())
+                    return {};
+
+                auto* begin = reinterpret_cast<const char*>(m_Strings.data() + index);
+                auto* end = static_cast<const char*>(std::memchr(begin, 0, m_Strings.size() - index));
+                return end ? std::string_view(begin, end - begin) : std::string_view{};
+            }
+
+            // blobs are prefixed with a compressed length, II.24.2.4
+            std::span<const uint8_t> Blob(uint32_t index) const
+            {
+                if (index >= m_Blob.size())
+                    return {};
+
+                const uint8_t* p = m_Blob.data() + index;
+                size_t available = m_Blob.size() - index;
+                uint32_t length;
+                size_t header;
+
+                if ((p[0] & 0x80) == 0)
+                {
+                    length = p[0];
+                    header = 1;
+                }
+                else if ((p[0] & 0xC0) == 0x80 && available >= 2)
+                {
+                    length = ((p[0] & 0x3F) << 8) | p[1];
+                    header = 2;
+                }
+                else if ((p[0] & 0xE0) == 0xC0 && available >= 4)
+                {
+                    length = ((p[0] & 0x1F) << 24) | (p[1] << 16) | (p[2] << 8) | p[3];
+                    header = 4;
+                }
+                else
+                {
+                    return {};
+                }
+
+                if (length > available - header)
+                    return {};
+
+                return { p + header, length };
+            }
+        };
+
+        std::optional<AssemblyMetadata> Fail(const char** error, const char* reason)
+        {
+            if (error)
+            {
+                *error = reason;
+            }
+
+            return std::nullopt;
+        }
+
+        AssemblyVersion ReadVersion(const uint8_t*& cursor)
+        {
+            AssemblyVersion version;
+            version.m_Major = static_cast<uint16_t>(ReadIndex(cursor, 2));
+            version.m_Minor = static_cast<uint16_t>(ReadIndex(cursor, 2));
+            version.m_Build = static_cast<uint16_t>(ReadIndex(cursor, 2));
+            version.m_Revision = static_cast<uint16_t>(ReadIndex(cursor, 2));
+            return version;
+        }
+    }
+
+    std::string AssemblyVersion::ToString() const
+    {
+        return std::to_string(m_Major) + "." + std::to_string(m_Minor) + "." + std::to_string(m_Build) + "." + std::to_string(m_Revision);
+    }
+
+    std::optional<AssemblyMetadata> ReadAssemblyMetadata(std::span<const uint8_t> image, const char** error)
+    {
+        Reader reader(image);
+        AssemblyMetadata metadata;
+
+        // PE headers, II.25.2
+        uint16_t dosMagic = 0;
+        uint32_t peOffset = 0;
+        if (!reader.Read(0, dosMagic) || dosMagic != IMAGE_DOS_MAGIC || !reader.Read(0x3C, peOffset))
+            return Fail(error, "not a PE image (missing MZ header)");
+
+        uint32_t peSignature = 0;
+        if (!reader.Read(peOffset, peSignature) || peSignature != IMAGE_PE_SIGNATURE)
+            return Fail(error, "not a PE image (missing PE signature)");
+
+        uint64_t coff = static_cast<uint64_t>(peOffset) + 4;
+        uint16_t sectionCount = 0, optionalSize = 0;
+        if (!reader.Read(coff, metadata.m_Machine) || !reader.Read(coff + 2, sectionCount) || !reader.Read(coff + 16, optionalSize))
+            return Fail(error, "truncated COFF header");
+
+        uint64_t optional = coff + 20;
+        uint16_t optionalMagic = 0;
+        if (!reader.Read(optional, optionalMagic))
+            return Fail(error, "truncated optional header");
+
+        if (optionalMagic != IMAGE_OPTIONAL_MAGIC_PE32 && optionalMagic != IMAGE_OPTIONAL_MAGIC_PE32PLUS)
+            return Fail(error, "unknown optional header magic");
+
+        metadata.m_Pe32Plus = optionalMagic == IMAGE_OPTIONAL_MAGIC_PE32PLUS;
+
+        uint64_t directoryCountOffset = optional + (metadata.m_Pe32Plus ? 108 : 92);
+        uint32_t directoryCount = 0;
+        if (!reader.Read(directoryCountOffset, directoryCount) || directoryCount <= IMAGE_DIRECTORY_CLI)
+            return Fail(error, "not a .NET assembly (no CLI header directory)");
+
+        uint64_t cliDirectory = directoryCountOffset + 4 + IMAGE_DIRECTORY_CLI * 8;
+        if (cliDirectory + 8 > optional + optionalSize)
+            return Fail(error, "not a .NET assembly (no CLI header directory)");
+
+        uint32_t cliRva = 0, cliSize = 0;
+        if (!reader.Read(cliDirectory, cliRva) || !reader.Read(cliDirectory + 4, cliSize) || cliRva == 0)
+            return Fail(error, "not a .NET assembly (empty CLI header directory)");
+
+        uint64_t sections = optional + optionalSize;
+        if (!reader.Has(sections, static_cast<uint64_t>(sectionCount) * 40))
+            return Fail(error, "truncated section table");
+
+        auto rvaToOffset = [&](uint32_t rva, uint32_t size) -> std::optional<uint64_t>
+        {
+            for (uint16_t i = 0; i < sectionCount; ++i)
+            {
+                uint64_t section = sections + i * 40ull;
+                uint32_t virtualSize = 0, virtualAddress = 0, rawSize = 0, rawPointer = 0;
+                reader.Read(section + 8, virtualSize);
+                reader.Read(section + 12, virtualAddress);
+                reader.Read(section + 16, rawSize);
+                reader.Read(section + 20, rawPointer);
+
+                uint32_t extent = std::max(virtualSize, rawSize);
+                if (rva >= virtualAddress && rva - virtualAddress < extent)
+                {
+                    uint64_t delta = rva - virtualAddress;
+                    if (delta + size > rawSize)
+                        return std::nullopt;
+
+                    uint64_t offset = static_cast<uint64_t>(rawPointer) + delta;
+                    return reader.Has(offset, size) ? std::optional(offset) : std::nullopt;
+                }
+            }
+
+            return std::nullopt;
+        };
+
+        // CLI header, II.25.3.3
+        auto cliOffset = rvaToOffset(cliRva, 72);
+        if (!cliOffset)
+            return Fail(error, "CLI header outside of the image");
+
+        uint32_t metadataRva = 0, metadataSize = 0;
+        reader.Read(*cliOffset + 8, metadataRva);
+        reader.Read(*cliOffset + 12, metadataSize);
+        reader.Read(*cliOffset + 16, metadata.m_CliFlags);
+        reader.Read(*cliOffset + 20, metadata.m_EntryPointToken);
+
+        auto metadataOffset = rvaToOffset(metadataRva, metadataSize);
+        if (!metadataOffset || metadataSize < 20)
+            return Fail(error, "metadata root outside of the image");
+
+        // metadata root, II.24.2.1
+        Reader root(reader.Slice(*metadataOffset, metadataSize));
+
+        uint32_t signature = 0, versionLength = 0;
+        if (!root.Read(0, signature) || signature != METADATA_SIGNATURE)
+            return Fail(error, "bad metadata signature");
+
+        if (!root.Read(12, versionLength) || versionLength > 255 || !root.Has(16, versionLength))
+            return Fail(error, "bad metadata version string");
+
+        auto versionBytes = root.Slice(16, versionLength);
+        auto* versionChars = reinterpret_cast<const char*>(versionBytes.data());
+        metadata.m_RuntimeVersion = std::string_view(versionChars, strnlen(versionChars, versionBytes.size()));
+
+        uint64_t streamHeader = 16 + ((versionLength + 3) & ~3u);
+        uint16_t streamCount = 0;
+        if (!root.Read(streamHeader + 2, streamCount))
+            return Fail(error, "truncated stream headers");
+
+        streamHeader += 4;
+
+        std::span<const uint8_t> tables;
+        Heaps heaps;
+
+        for (uint16_t i = 0; i < streamCount; ++i)
+        {
+            uint32_t offset = 0, size = 0;
+            if (!root.Read(streamHeader, offset) || !root.Read(streamHeader + 4, size))
+                return Fail(error, "truncated stream headers");
+
+            uint64_t nameOffset = streamHeader + 8;
+            if (nameOffset >= metadataSize)
+                return Fail(error, "truncated stream headers");
+
+            // stream names are at most 32 bytes including the terminator
+            auto nameBytes = root.Slice(nameOffset, std::min<uint64_t>(32, metadataSize - nameOffset));
+            auto* nameChars = reinterpret_cast<const char*>(nameBytes.data());
+            size_t nameLength = strnlen(nameChars, nameBytes.size());
+            if (nameLength == nameBytes.size())
+                return Fail(error, "unterminated stream name");
+
+            std::string_view name(nameChars, nameLength);
+            if (!root.Has(offset, size))
+                return Fail(error, "stream outside of the metadata");
+
+            auto stream = root.Slice(offset, size);
+            if (name == "#~" || name == "#-")
+            {
+                tables = stream;
+            }
+            else if (name == "#Strings")
+            {
+                heaps.m_Strings = stream;
+            }
+            else if (name == "#Blob")
+            {
+                heaps.m_Blob = stream;
+            }
+
+            streamHeader += 8 + ((nameLength + 4) & ~3u);
+        }
+
+        if (tables.empty() || heaps.m_Strings.empty())
+            return Fail(error, "missing #~ or #Strings stream");
+
+        // tables stream header, II.24.2.6
+        Reader tableReader(tables);
+        uint8_t heapSizes = 0;
+        uint64_t valid = 0;
+        if (!tableReader.Read(6, heapSizes) || !tableReader.Read(8, valid))
+            return Fail(error, "truncated tables stream");
+
+        if (valid >> TableCount)
+            return Fail(error, "unknown metadata tables present");
+
+        Layout layout;
+        layout.m_String = (heapSizes & 0x01) ? 4 : 2;
+        layout.m_Guid = (heapSizes & 0x02) ? 4 : 2;
+        layout.m_Blob = (heapSizes & 0x04) ? 4 : 2;
+
+        uint64_t cursor = 24;
+        for (uint8_t table = 0; table < TableCount; ++table)
+        {
+            if (valid & (1ull << table))
+            {
+                if (!tableReader.Read(cursor, layout.m_Rows[table]))
+                    return Fail(error, "truncated table row counts");
+
+                cursor += 4;
+            }
+        }
+
+        // uncompressed (#-) streams written by edit and continue can carry 4 extra bytes
+        if (heapSizes & 0x40)
+        {
+            cursor += 4;
+        }
+
+        std::array<uint64_t, TableCount> tableOffsets{};
+        for (uint8_t table = 0; table < TableCount; ++table)
+        {
+            tableOffsets[table] = cursor;
+            cursor += static_cast<uint64_t>(layout.m_Rows[table]) * layout.RowSize(table);
+        }
+
+        if (cursor > tables.size())
+            return Fail(error, "metadata tables extend past the stream");
+
+        // Assembly, II.22.2
+        if (layout.m_Rows[Assembly] != 1)
+            return Fail(error, "not an assembly (no Assembly row, probably a netmodule)");
+
+        {
+            const uint8_t* row = tables.data() + tableOffsets[Assembly] + 4;
+            metadata.m_Version = ReadVersion(row);
+            row += 4;
+            metadata.m_PublicKey = heaps.Blob(ReadIndex(row, layout.m_Blob));
+            metadata.m_Name = heaps.String(ReadIndex(row, layout.m_String));
+            metadata.m_Culture = heaps.String(ReadIndex(row, layout.m_String));
+        }
+
+        if (metadata.m_Name.empty())
+            return Fail(error, "assembly has no name");
+
+        // AssemblyRef, II.22.5
+        metadata.m_References.reserve(layout.m_Rows[AssemblyRef]);
+        for (uint32_t i = 0; i < layout.m_Rows[AssemblyRef]; ++i)
+        {
+            const uint8_t* row = tables.data() + tableOffsets[AssemblyRef] + static_cast<uint64_t>(i) * layout.RowSize(AssemblyRef);
+
+            AssemblyReference reference;
+            reference.m_Version = ReadVersion(row);
+            row += 4;
+            reference.m_PublicKeyOrToken = heaps.Blob(ReadIndex(row, layout.m_Blob));
+            reference.m_Name = heaps.String(ReadIndex(row, layout.m_String));
+            reference.m_Culture = heaps.String(ReadIndex(row, layout.m_String));
+
+            metadata.m_References.push_back(reference);
+        }
+
+        // TypeDef, II.22.37, row 1 is <Module>
+        uint32_t typeRowSize = layout.RowSize(TypeDef);
+        metadata.m_Types.reserve(layout.m_Rows[TypeDef]);
+        for (uint32_t i = 1; i < layout.m_Rows[TypeDef]; ++i)
+        {
+            const uint8_t* row = tables.data() + tableOffsets[TypeDef] + static_cast<uint64_t>(i) * typeRowSize;
+
+            TypeDefinition type;
+            type.m_Flags = ReadIndex(row, 4);
+            type.m_Name = heaps.String(ReadIndex(row, layout.m_String));
+            type.m_Namespace = heaps.String(ReadIndex(row, layout.m_String));
+
+            metadata.m_Types.push_back(type);
+        }
+
+        return metadata;
+    }
+
+    bool IsLoadableAssembly(const AssemblyMetadata& metadata, const char** error)
+    {
+        const char* reason = nullptr;
+
+        if (!(metadata.m_CliFlags & CLI_FLAG_ILONLY))
+        {
+            reason = "mixed-mode assemblies cannot be loaded from memory";
+        }
+        else if (metadata.m_Machine != IMAGE_MACHINE_I386 && metadata.m_Machine != IMAGE_MACHINE_AMD64)
+        {
+            reason = "assembly targets an unsupported architecture";
+        }
+        else if ((metadata.m_CliFlags & CLI_FLAG_32BIT_REQUIRED) && !(metadata.m_CliFlags & CLI_FLAG_32BIT_PREFERRED))
+        {
+            reason = "assembly is x86 only";
+        }
+
+        if (reason && error)
+        {
+            *error = reason;
+        }
+
+        return reason == nullptr;
+    }
+}
\ No newline at end of file
@@ -1,7 +1,11 @@
 #include <cse/mono.hpp>
+#include <cse/log.hpp>
 #include <windows.h>
+#include <algorithm>
+#include <iterator>
 #include <stdexcept>
 #include <format>
+#include <utility>
 
 namespace cse
 {
@@ -90,6 +94,176 @@ namespace cse
 
         // Convert object to string
         using object_to_string_func = MonoString* (*)(MonoObject* obj, MonoObject** exc);
+
+        // System.Reflection.Assembly object to MonoAssembly
+        using reflection_assembly_get_assembly_func = MonoAssembly* (*)(MonoObject* refassembly);
+
+        // Row count of a metadata table
+        using image_get_table_rows_func = int (*)(MonoImage* image, int table_id);
+
+        // Method from a metadata token
+        using get_method_func = MonoMethod* (*)(MonoImage* image, uint32_t token, MonoClass* klass);
+
+        // Method attribute flags, implementation flags through iflags
+        using method_get_flags_func = uint32_t (*)(MonoMethod* method, uint32_t* iflags);
+
+        // Method name and declaring class
+        using method_get_name_func = const char* (*)(MonoMethod* method);
+        using method_get_class_func = MonoClass* (*)(MonoMethod* method);
+
+        // Method signature, and whether it declares generic parameters
+        using method_signature_func = MonoMethodSignature* (*)(MonoMethod* method);
+        using signature_is_generic_func = int (*)(MonoMethodSignature* sig);
+
+        // Assembly name of an image
+        using image_get_name_func = const char* (*)(MonoImage* image);
+
+        // Parsed assembly name ("Name, Version=...")
+        using assembly_name_new_func = MonoAssemblyName* (*)(const char* name);
+
+        // Frees the members of an assembly name, not the name itself
+        using assembly_name_free_func = void (*)(MonoAssemblyName* aname);
+
+        // Assembly already loaded into the current domain
+        using assembly_loaded_func = MonoAssembly* (*)(MonoAssemblyName* aname);
+
+        // String from UTF-8 that isn't NUL terminated
+        using string_new_len_func = MonoString* (*)(MonoDomain* domain, const char* text, uint32_t length);
+
+        // Native callable wrapper of a method: (this?, args..., MonoException** exc)
+        using method_get_unmanaged_thunk_func = void* (*)(MonoMethod* method);
+
+        // UTF-16 characters of a string, not terminated
+        using string_chars_func = uint16_t* (*)(MonoString* str);
+
+        // Length of a string in UTF-16 code units
+        using string_length_func = int (*)(MonoString* str);
+
+        // Element count of a one dimensional array
+        using array_length_func = uintptr_t (*)(MonoArray* array);
+
+        // Binds a native function to an extern method, name is "Namespace.Class::Method"
+        using add_internal_call_func = void (*)(const char* name, const void* method);
+
+        // managed heap in use, bytes
+        using gc_get_used_size_func = int64_t (*)();
+
+        // managed heap reserved, bytes
+        using gc_get_heap_size_func = int64_t (*)();
+
+        // collections of a generation so far
+        using gc_collection_count_func = int (*)(int generation);
+
+        // oldest generation, 1 with sgen
+        using gc_max_generation_func = int (*)();
+
+        // walks every registered runtime counter, stops when cb returns 0
+        using counters_foreach_func = void (*)(int (*cb)(MonoCounter* counter, void* user_data), void* user_data);
+
+        // copies a counter value, returns its size
+        using counters_sample_func = int (*)(MonoCounter* counter, void* buffer, int buffer_size);
+
+        // display name of a counter
+        using counter_get_name_func = const char* (*)(MonoCounter* counter);
+
+        // MONO_COUNTER_* type, unit and variance flags
+        using counter_get_type_func = int (*)(MonoCounter* counter);
+
+        // managed thread object of the calling thread
+        using thread_current_func = MonoThread* (*)();
+
+        // Thread.Abort on another thread, takes effect at its next safepoint
+        using thread_stop_func = void (*)(MonoThread* thread);
+
+        // strong handle, a pinned one also keeps the object from moving
+        using gchandle_new_func = uint32_t (*)(MonoObject* obj, int pinned);
+
+        // releases a handle from gchandle_new
+        using gchandle_free_func = void (*)(uint32_t gchandle);
+
+        // mscorlib image
+        using get_corlib_func = MonoImage* (*)();
+
+        // metadata table of an image, rows are read with metadata_decode_row
+        using image_get_table_info_func = const MonoTableInfo* (*)(MonoImage* image, int table_id);
+
+        // decodes the columns of row idx (0 based)
+        using metadata_decode_row_func = void (*)(const MonoTableInfo* t, int idx, uint32_t* res, int res_size);
+
+        // #Strings heap entry, valid as long as the image
+        using metadata_string_heap_func = const char* (*)(MonoImage* image, uint32_t index);
+
+        // resolves a handle to its object, the object may have moved since
+        using gchandle_get_target_func = MonoObject* (*)(uint32_t gchandle);
+
+        // offset of an instance field from the start of the object, header included
+        using field_get_offset_func = uint32_t (*)(MonoField* field);
+
+        // FieldAttributes of the field
+        using field_get_flags_func = uint32_t (*)(MonoField* field);
+
+        // declared type of the field
+        using field_get_type_func = MonoType* (*)(MonoField* field);
+
+        // MONO_TYPE_* element type
+        using type_get_type_func = int (*)(MonoType* type);
+
+        // non-zero for class, interface, array and string types
+        using type_is_reference_func = int (*)(MonoType* type);
+
+        // obj if it is an instance of klass or derives from it, otherwise null
+        using object_isinst_func = MonoObject* (*)(MonoObject* obj, MonoClass* klass);
+
+        // allocates an instance without running a constructor
+        using object_new_func = MonoObject* (*)(MonoDomain* domain, MonoClass* klass);
+
+        // parses "Type:Method(paramtypes)", lets overloads with the same parameter count be told apart
+        using method_desc_new_func = MonoMethodDesc* (*)(const char* name, int include_namespace);
+
+        // first method of klass matching desc
+        using method_desc_search_in_class_func = MonoMethod* (*)(MonoMethodDesc* desc, MonoClass* klass);
+
+        // releases a parsed description
+        using method_desc_free_func = void (*)(MonoMethodDesc* desc);
+
+        // image that defines klass
+        using class_get_image_func = MonoImage* (*)(MonoClass* klass);
+
+        // allocated size of obj in bytes, header included
+        using object_get_size_func = uint32_t (*)(MonoObject* obj);
+
+        // registers a profiler, handles live until the runtime shuts down
+        using profiler_create_func = MonoProfilerHandle* (*)(MonoProfiler* prof);
+
+        // decides per method at JIT time which enter/leave calls get compiled in
+        using profiler_set_call_instrumentation_filter_callback_func = void (*)(MonoProfilerHandle* handle, int (*cb)(MonoProfiler* prof, MonoMethod* method));
+
+        // called on entry of instrumented methods, null removes it
+        using profiler_set_method_enter_callback_func = void (*)(MonoProfilerHandle* handle, void (*cb)(MonoProfiler* prof, MonoMethod* method, MonoProfilerCallContext* context));
+
+        // called on return from instrumented methods
+        using profiler_set_method_leave_callback_func = void (*)(MonoProfilerHandle* handle, void (*cb)(MonoProfiler* prof, MonoMethod* method, MonoProfilerCallContext* context));
+
+        // called when an instrumented method leaves through a tail call
+        using profiler_set_method_tail_call_callback_func = void (*)(MonoProfilerHandle* handle, void (*cb)(MonoProfiler* prof, MonoMethod* method, MonoMethod* target));
+
+        // called when an exception unwinds an instrumented method
+        using profiler_set_method_exception_leave_callback_func = void (*)(MonoProfilerHandle* handle, void (*cb)(MonoProfiler* prof, MonoMethod* method, MonoObject* exception));
+
+        // called on the loading thread once an image is loaded
+        using profiler_set_image_loaded_callback_func = void (*)(MonoProfilerHandle* handle, void (*cb)(MonoProfiler* prof, MonoImage* image));
+
+        // allocation events, only honoured before the runtime has started on most builds
+        using profiler_enable_allocations_func = int (*)();
+
+        // called for every managed allocation once allocations are enabled
+        using profiler_set_gc_allocation_callback_func = void (*)(MonoProfilerHandle* handle, void (*cb)(MonoProfiler* prof, MonoObject* obj));
+
+        // unique per domain for the process, unlike its address
+        using domain_get_id_func = int32_t (*)(MonoDomain* domain);
+
+        // nullptr unless klass is nested
+        using class_get_nesting_type_func = MonoClass* (*)(MonoClass* klass);
     }
 
     struct MonoMethods::Impl
@@ -123,6 +297,64 @@ namespace cse
         typedefs::array_addr_with_size_func array_addr_with_size = nullptr;
         typedefs::get_byte_class_func get_byte_class = nullptr;
         typedefs::object_to_string_func object_to_string = nullptr;
+        typedefs::reflection_assembly_get_assembly_func reflection_assembly_get_assembly = nullptr;
+        typedefs::image_get_table_rows_func image_get_table_rows = nullptr;
+        typedefs::get_method_func get_method = nullptr;
+        typedefs::method_get_flags_func method_get_flags = nullptr;
+        typedefs::method_get_name_func method_get_name = nullptr;
+        typedefs::method_get_class_func method_get_class = nullptr;
+        typedefs::method_signature_func method_signature = nullptr;
+        typedefs::signature_is_generic_func signature_is_generic = nullptr;
+        typedefs::image_get_name_func image_get_name = nullptr;
+        typedefs::assembly_name_new_func assembly_name_new = nullptr;
+        typedefs::assembly_name_free_func assembly_name_free = nullptr;
+        typedefs::assembly_loaded_func assembly_loaded = nullptr;
+        typedefs::string_new_len_func string_new_len = nullptr;
+        typedefs::method_get_unmanaged_thunk_func method_get_unmanaged_thunk = nullptr;
+        typedefs::string_chars_func string_chars = nullptr;
+        typedefs::string_length_func string_length = nullptr;
+        typedefs::array_length_func array_length = nullptr;
+        typedefs::add_internal_call_func add_internal_call = nullptr;
+        typedefs::gc_get_used_size_func gc_get_used_size = nullptr;
+        typedefs::gc_get_heap_size_func gc_get_heap_size = nullptr;
+        typedefs::gc_collection_count_func gc_collection_count = nullptr;
+        typedefs::gc_max_generation_func gc_max_generation = nullptr;
+        typedefs::counters_foreach_func counters_foreach = nullptr;
+        typedefs::counters_sample_func counters_sample = nullptr;
+        typedefs::counter_get_name_func counter_get_name = nullptr;
+        typedefs::counter_get_type_func counter_get_type = nullptr;
+        typedefs::thread_current_func thread_current = nullptr;
+        typedefs::thread_stop_func thread_stop = nullptr;
+        typedefs::gchandle_new_func gchandle_new = nullptr;
+        typedefs::gchandle_free_func gchandle_free = nullptr;
+        typedefs::get_corlib_func get_corlib = nullptr;
+        typedefs::image_get_table_info_func image_get_table_info = nullptr;
+        typedefs::metadata_decode_row_func metadata_decode_row = nullptr;
+        typedefs::metadata_string_heap_func metadata_string_heap = nullptr;
+        typedefs::gchandle_get_target_func gchandle_get_target = nullptr;
+        typedefs::field_get_offset_func field_get_offset = nullptr;
+        typedefs::field_get_flags_func field_get_flags = nullptr;
+        typedefs::field_get_type_func field_get_type = nullptr;
+        typedefs::type_get_type_func type_get_type = nullptr;
+        typedefs::type_is_reference_func type_is_reference = nullptr;
+        typedefs::object_isinst_func object_isinst = nullptr;
+        typedefs::object_new_func object_new = nullptr;
+        typedefs::method_desc_new_func method_desc_new = nullptr;
+        typedefs::method_desc_search_in_class_func method_desc_search_in_class = nullptr;
+        typedefs::method_desc_free_func method_desc_free = nullptr;
+        typedefs::class_get_image_func class_get_image = nullptr;
+        typedefs::object_get_size_func object_get_size = nullptr;
+        typedefs::profiler_create_func profiler_create = nullptr;
+        typedefs::profiler_set_call_instrumentation_filter_callback_func profiler_set_call_instrumentation_filter_callback = nullptr;
+        typedefs::profiler_set_method_enter_callback_func profiler_set_method_enter_callback = nullptr;
+        typedefs::profiler_set_method_leave_callback_func profiler_set_method_leave_callback = nullptr;
+        typedefs::profiler_set_method_tail_call_callback_func profiler_set_method_tail_call_callback = nullptr;
+        typedefs::profiler_set_method_exception_leave_callback_func profiler_set_method_exception_leave_callback = nullptr;
+        typedefs::profiler_set_image_loaded_callback_func profiler_set_image_loaded_callback = nullptr;
+        typedefs::profiler_enable_allocations_func profiler_enable_allocations = nullptr;
+        typedefs::profiler_set_gc_allocation_callback_func profiler_set_gc_allocation_callback = nullptr;
+        typedefs::domain_get_id_func domain_get_id = nullptr;
+        typedefs::class_get_nesting_type_func class_get_nesting_type = nullptr;
 
     public:
         Impl()
@@ -160,6 +392,64 @@ namespace cse
             array_addr_with_size = (typedefs::array_addr_with_size_func)GetProcAddress(hModule, "mono_array_addr_with_size");
             get_byte_class = (typedefs::get_byte_class_func)GetProcAddress(hModule, "mono_get_byte_class");
             object_to_string = (typedefs::object_to_string_func)GetProcAddress(hModule, "mono_object_to_string");
+            reflection_assembly_get_assembly = (typedefs::reflection_assembly_get_assembly_func)GetProcAddress(hModule, "mono_reflection_assembly_get_assembly");
+            image_get_table_rows = (typedefs::image_get_table_rows_func)GetProcAddress(hModule, "mono_image_get_table_rows");
+            get_method = (typedefs::get_method_func)GetProcAddress(hModule, "mono_get_method");
+            method_get_flags = (typedefs::method_get_flags_func)GetProcAddress(hModule, "mono_method_get_flags");
+            method_get_name = (typedefs::method_get_name_func)GetProcAddress(hModule, "mono_method_get_name");
+            method_get_class = (typedefs::method_get_class_func)GetProcAddress(hModule, "mono_method_get_class");
+            method_signature = (typedefs::method_signature_func)GetProcAddress(hModule, "mono_method_signature");
+            signature_is_generic = (typedefs::signature_is_generic_func)GetProcAddress(hModule, "mono_signature_is_generic");
+            image_get_name = (typedefs::image_get_name_func)GetProcAddress(hModule, "mono_image_get_name");
+            assembly_name_new = (typedefs::assembly_name_new_func)GetProcAddress(hModule, "mono_assembly_name_new");
+            assembly_name_free = (typedefs::assembly_name_free_func)GetProcAddress(hModule, "mono_assembly_name_free");
+            assembly_loaded = (typedefs::assembly_loaded_func)GetProcAddress(hModule, "mono_assembly_loaded");
+            string_new_len = (typedefs::string_new_len_func)GetProcAddress(hModule, "mono_string_new_len");
+            method_get_unmanaged_thunk = (typedefs::method_get_unmanaged_thunk_func)GetProcAddress(hModule, "mono_method_get_unmanaged_thunk");
+            string_chars = (typedefs::string_chars_func)GetProcAddress(hModule, "mono_string_chars");
+            string_length = (typedefs::string_length_func)GetProcAddress(hModule, "mono_string_length");
+            array_length = (typedefs::array_length_func)GetProcAddress(hModule, "mono_array_length");
+            add_internal_call = (typedefs::add_internal_call_func)GetProcAddress(hModule, "mono_add_internal_call");
+            gc_get_used_size = (typedefs::gc_get_used_size_func)GetProcAddress(hModule, "mono_gc_get_used_size");
+            gc_get_heap_size = (typedefs::gc_get_heap_size_func)GetProcAddress(hModule, "mono_gc_get_heap_size");
+            gc_collection_count = (typedefs::gc_collection_count_func)GetProcAddress(hModule, "mono_gc_collection_count");
+            gc_max_generation = (typedefs::gc_max_generation_func)GetProcAddress(hModule, "mono_gc_max_generation");
+            counters_foreach = (typedefs::counters_foreach_func)GetProcAddress(hModule, "mono_counters_foreach");
+            counters_sample = (typedefs::counters_sample_func)GetProcAddress(hModule, "mono_counters_sample");
+            counter_get_name = (typedefs::counter_get_name_func)GetProcAddress(hModule, "mono_counter_get_name");
+            counter_get_type = (typedefs::counter_get_type_func)GetProcAddress(hModule, "mono_counter_get_type");
+            thread_current = (typedefs::thread_current_func)GetProcAddress(hModule, "mono_thread_current");
+            thread_stop = (typedefs::thread_stop_func)GetProcAddress(hModule, "mono_thread_stop");
+            gchandle_new = (typedefs::gchandle_new_func)GetProcAddress(hModule, "mono_gchandle_new");
+            gchandle_free = (typedefs::gchandle_free_func)GetProcAddress(hModule, "mono_gchandle_free");
+            get_corlib = (typedefs::get_corlib_func)GetProcAddress(hModule, "mono_get_corlib");
+            image_get_table_info = (typedefs::image_get_table_info_func)GetProcAddress(hModule, "mono_image_get_table_info");
+            metadata_decode_row = (typedefs::metadata_decode_row_func)GetProcAddress(hModule, "mono_metadata_decode_row");
+            metadata_string_heap = (typedefs::metadata_string_heap_func)GetProcAddress(hModule, "mono_metadata_string_heap");
+            gchandle_get_target = (typedefs::gchandle_get_target_func)GetProcAddress(hModule, "mono_gchandle_get_target");
+            field_get_offset = (typedefs::field_get_offset_func)GetProcAddress(hModule, "mono_field_get_offset");
+            field_get_flags = (typedefs::field_get_flags_func)GetProcAddress(hModule, "mono_field_get_flags");
+            field_get_type = (typedefs::field_get_type_func)GetProcAddress(hModule, "mono_field_get_type");
+            type_get_type = (typedefs::type_get_type_func)GetProcAddress(hModule, "mono_type_get_type");
+            type_is_reference = (typedefs::type_is_reference_func)GetProcAddress(hModule, "mono_type_is_reference");
+            object_isinst = (typedefs::object_isinst_func)GetProcAddress(hModule, "mono_object_isinst");
+            object_new = (typedefs::object_new_func)GetProcAddress(hModule, "mono_object_new");
+            method_desc_new = (typedefs::method_desc_new_func)GetProcAddress(hModule, "mono_method_desc_new");
+            method_desc_search_in_class = (typedefs::method_desc_search_in_class_func)GetProcAddress(hModule, "mono_method_desc_search_in_class");
+            method_desc_free = (typedefs::method_desc_free_func)GetProcAddress(hModule, "mono_method_desc_free");
+            class_get_image = (typedefs::class_get_image_func)GetProcAddress(hModule, "mono_class_get_image");
+            object_get_size = (typedefs::object_get_size_func)GetProcAddress(hModule, "mono_object_get_size");
+            profiler_create = (typedefs::profiler_create_func)GetProcAddress(hModule, "mono_profiler_create");
+            profiler_set_call_instrumentation_filter_callback = (typedefs::profiler_set_call_instrumentation_filter_callback_func)GetProcAddress(hModule, "mono_profiler_set_call_instrumentation_filter_callback");
+            profiler_set_method_enter_callback = (typedefs::profiler_set_method_enter_callback_func)GetProcAddress(hModule, "mono_profiler_set_method_enter_callback");
+            profiler_set_method_leave_callback = (typedefs::profiler_set_method_leave_callback_func)GetProcAddress(hModule, "mono_profiler_set_method_leave_callback");
+            profiler_set_method_tail_call_callback = (typedefs::profiler_set_method_tail_call_callback_func)GetProcAddress(hModule, "mono_profiler_set_method_tail_call_callback");
+            profiler_set_method_exception_leave_callback = (typedefs::profiler_set_method_exception_leave_callback_func)GetProcAddress(hModule, "mono_profiler_set_method_exception_leave_callback");
+            profiler_set_image_loaded_callback = (typedefs::profiler_set_image_loaded_callback_func)GetProcAddress(hModule, "mono_profiler_set_image_loaded_callback");
+            profiler_enable_allocations = (typedefs::profiler_enable_allocations_func)GetProcAddress(hModule, "mono_profiler_enable_allocations");
+            profiler_set_gc_allocation_callback = (typedefs::profiler_set_gc_allocation_callback_func)GetProcAddress(hModule, "mono_profiler_set_gc_allocation_callback");
+            domain_get_id = (typedefs::domain_get_id_func)GetProcAddress(hModule, "mono_domain_get_id");
+            class_get_nesting_type = (typedefs::class_get_nesting_type_func)GetProcAddress(hModule, "mono_class_get_nesting_type");
 
             int index;
             if ((index = Validate()) != -1)
@@ -168,6 +458,22 @@ namespace cse
             }
         }
 
+        // exports of MonoFeature, checked by supports() instead
+        bool IsOptional(const void* member) const
+        {
+            const void* optional[] = {
+                &profiler_create, &profiler_set_call_instrumentation_filter_callback, &profiler_set_method_enter_callback,
+                &profiler_set_method_leave_callback, &profiler_set_method_tail_call_callback, &profiler_set_method_exception_leave_callback,
+                &profiler_set_image_loaded_callback, &profiler_enable_allocations, &profiler_set_gc_allocation_callback,
+                &counters_foreach, &counters_sample, &counter_get_name, &counter_get_type,
+                &thread_stop,
+                &method_get_unmanaged_thunk,
+                &signature_is_generic,
+            };
+
+            return std::find(std::begin(optional), std::end(optional), member) != std::end(optional);
+        }
+
         // hacky way to validate that all function pointers are initialized
         int Validate() const
         {
@@ -176,7 +482,7 @@ namespace cse
 
             for (size_t i = 0 ; i < size / sizeof(void*); i++)
             {
-                if (ptr[i] == nullptr)
+                if (ptr[i] == nullptr && !IsOptional(&ptr[i]))
                 {
                     return i;
                 }
@@ -195,6 +501,42 @@ namespace cse
     MonoMethods::MonoMethods()
         : m_Impl(std::make_unique<Impl>())
     {
+        for (auto [feature, name] : { std::pair{ MonoFeature::Profiler, "profiler" }, std::pair{ MonoFeature::Counters, "counters" },
+            std::pair{ MonoFeature::ThreadAbort, "thread abort" }, std::pair{ MonoFeature::UnmanagedThunks, "unmanaged thunks" },
+            std::pair{ MonoFeature::GenericSignatures, "generic signatures" } })
+        {
+            if (!supports(feature))
+            {
+                println("[CSE] This Mono build has no %s exports, features using them are unavailable", name);
+            }
+        }
+    }
+
+    bool MonoMethods::supports(MonoFeature feature) const
+    {
+        const auto& impl = *m_Impl;
+
+        switch (feature)
+        {
+        case MonoFeature::Profiler:
+            return impl.profiler_create && impl.profiler_set_call_instrumentation_filter_callback && impl.profiler_set_method_enter_callback &&
+                impl.profiler_set_method_leave_callback && impl.profiler_set_method_tail_call_callback && impl.profiler_set_method_exception_leave_callback &&
+                impl.profiler_set_image_loaded_callback && impl.profiler_enable_allocations && impl.profiler_set_gc_allocation_callback;
+
+        case MonoFeature::Counters:
+            return impl.counters_foreach && impl.counters_sample && impl.counter_get_name && impl.counter_get_type;
+
+        case MonoFeature::ThreadAbort:
+            return impl.thread_stop != nullptr;
+
+        case MonoFeature::UnmanagedThunks:
+            return impl.method_get_unmanaged_thunk != nullptr;
+
+        case MonoFeature::GenericSignatures:
+            return impl.signature_is_generic != nullptr;
+        }
+
+        return false;
     }
 
     MonoString* MonoMethods::string_new(MonoDomain* domain, const char* str)
@@ -343,10 +685,300 @@ namespace cse
                 char* str = string_to_utf8((MonoString*)strObj);
                 if (str)
                 {
-                    printf("Mono Exception: %s\n", str);
+                    log_error("Mono Exception: %s", str);
                     free(str);
                 }
             }
         }
     }
+
+    MonoAssembly* MonoMethods::reflection_assembly_get_assembly(MonoObject* refassembly)
+    {
+        return m_Impl->reflection_assembly_get_assembly(refassembly);
+    }
+
+    int MonoMethods::image_get_table_rows(MonoImage* image, int table_id)
+    {
+        return m_Impl->image_get_table_rows(image, table_id);
+    }
+
+    MonoMethod* MonoMethods::get_method(MonoImage* image, uint32_t token, MonoClass* klass)
+    {
+        return m_Impl->get_method(image, token, klass);
+    }
+
+    uint32_t MonoMethods::method_get_flags(MonoMethod* method, uint32_t* iflags)
+    {
+        return m_Impl->method_get_flags(method, iflags);
+    }
+
+    const char* MonoMethods::method_get_name(MonoMethod* method)
+    {
+        return m_Impl->method_get_name(method);
+    }
+
+    MonoClass* MonoMethods::method_get_class(MonoMethod* method)
+    {
+        return m_Impl->method_get_class(method);
+    }
+
+    MonoMethodSignature* MonoMethods::method_signature(MonoMethod* method)
+    {
+        return m_Impl->method_signature(method);
+    }
+
+    bool MonoMethods::signature_is_generic(MonoMethodSignature* sig)
+    {
+        return m_Impl->signature_is_generic(sig) != 0;
+    }
+
+    const char* MonoMethods::image_get_name(MonoImage* image)
+    {
+        return m_Impl->image_get_name(image);
+    }
+
+    MonoAssemblyName* MonoMethods::assembly_name_new(const char* name)
+    {
+        return m_Impl->assembly_name_new(name);
+    }
+
+    void MonoMethods::assembly_name_free(MonoAssemblyName* aname)
+    {
+        m_Impl->assembly_name_free(aname);
+    }
+
+    MonoAssembly* MonoMethods::assembly_loaded(MonoAssemblyName* aname)
+    {
+        return m_Impl->assembly_loaded(aname);
+    }
+
+    MonoString* MonoMethods::string_new_len(MonoDomain* domain, const char* text, uint32_t length)
+    {
+        return m_Impl->string_new_len(domain, text, length);
+    }
+
+    void* MonoMethods::method_get_unmanaged_thunk(MonoMethod* method)
+    {
+        return m_Impl->method_get_unmanaged_thunk(method);
+    }
+
+    uint16_t* MonoMethods::string_chars(MonoString* str)
+    {
+        return m_Impl->string_chars(str);
+    }
+
+    int MonoMethods::string_length(MonoString* str)
+    {
+        return m_Impl->string_length(str);
+    }
+
+    uintptr_t MonoMethods::array_length(MonoArray* array)
+    {
+        return m_Impl->array_length(array);
+    }
+
+    void MonoMethods::add_internal_call(const char* name, const void* method)
+    {
+        m_Impl->add_internal_call(name, method);
+    }
+
+    int64_t MonoMethods::gc_get_used_size()
+    {
+        return m_Impl->gc_get_used_size();
+    }
+
+    int64_t MonoMethods::gc_get_heap_size()
+    {
+        return m_Impl->gc_get_heap_size();
+    }
+
+    int MonoMethods::gc_collection_count(int generation)
+    {
+        return m_Impl->gc_collection_count(generation);
+    }
+
+    int MonoMethods::gc_max_generation()
+    {
+        return m_Impl->gc_max_generation();
+    }
+
+    void MonoMethods::counters_foreach(int (*cb)(MonoCounter* counter, void* user_data), void* user_data)
+    {
+        m_Impl->counters_foreach(cb, user_data);
+    }
+
+    int MonoMethods::counters_sample(MonoCounter* counter, void* buffer, int buffer_size)
+    {
+        return m_Impl->counters_sample(counter, buffer, buffer_size);
+    }
+
+    const char* MonoMethods::counter_get_name(MonoCounter* counter)
+    {
+        return m_Impl->counter_get_name(counter);
+    }
+
+    int MonoMethods::counter_get_type(MonoCounter* counter)
+    {
+        return m_Impl->counter_get_type(counter);
+    }
+
+    MonoThread* MonoMethods::thread_current()
+    {
+        return m_Impl->thread_current();
+    }
+
+    void MonoMethods::thread_stop(MonoThread* thread)
+    {
+        m_Impl->thread_stop(thread);
+    }
+
+    uint32_t MonoMethods::gchandle_new(MonoObject* obj, int pinned)
+    {
+        return m_Impl->gchandle_new(obj, pinned);
+    }
+
+    void MonoMethods::gchandle_free(uint32_t gchandle)
+    {
+        m_Impl->gchandle_free(gchandle);
+    }
+
+    MonoImage* MonoMethods::get_corlib()
+    {
+        return m_Impl->get_corlib();
+    }
+
+    const MonoTableInfo* MonoMethods::image_get_table_info(MonoImage* image, int table_id)
+    {
+        return m_Impl->image_get_table_info(image, table_id);
+    }
+
+    void MonoMethods::metadata_decode_row(const MonoTableInfo* t, int idx, uint32_t* res, int res_size)
+    {
+        m_Impl->metadata_decode_row(t, idx, res, res_size);
+    }
+
+    const char* MonoMethods::metadata_string_heap(MonoImage* image, uint32_t index)
+    {
+        return m_Impl->metadata_string_heap(image, index);
+    }
+
+    MonoObject* MonoMethods::gchandle_get_target(uint32_t gchandle)
+    {
+        return m_Impl->gchandle_get_target(gchandle);
+    }
+
+    uint32_t MonoMethods::field_get_offset(MonoField* field)
+    {
+        return m_Impl->field_get_offset(field);
+    }
+
+    uint32_t MonoMethods::field_get_flags(MonoField* field)
+    {
+        return m_Impl->field_get_flags(field);
+    }
+
+    MonoType* MonoMethods::field_get_type(MonoField* field)
+    {
+        return m_Impl->field_get_type(field);
+    }
+
+    int MonoMethods::type_get_type(MonoType* type)
+    {
+        return m_Impl->type_get_type(type);
+    }
+
+    bool MonoMethods::type_is_reference(MonoType* type)
+    {
+        return m_Impl->type_is_reference(type) != 0;
+    }
+
+    MonoObject* MonoMethods::object_isinst(MonoObject* obj, MonoClass* klass)
+    {
+        return m_Impl->object_isinst(obj, klass);
+    }
+
+    MonoObject* MonoMethods::object_new(MonoDomain* domain, MonoClass* klass)
+    {
+        return m_Impl->object_new(domain, klass);
+    }
+
+    MonoMethodDesc* MonoMethods::method_desc_new(const char* name, int include_namespace)
+    {
+        return m_Impl->method_desc_new(name, include_namespace);
+    }
+
+    MonoMethod* MonoMethods::method_desc_search_in_class(MonoMethodDesc* desc, MonoClass* klass)
+    {
+        return m_Impl->method_desc_search_in_class(desc, klass);
+    }
+
+    void MonoMethods::method_desc_free(MonoMethodDesc* desc)
+    {
+        m_Impl->method_desc_free(desc);
+    }
+
+    MonoImage* MonoMethods::class_get_image(MonoClass* klass)
+    {
+        return m_Impl->class_get_image(klass);
+    }
+
+    uint32_t MonoMethods::object_get_size(MonoObject* obj)
+    {
+        return m_Impl->object_get_size(obj);
+    }
+
+    MonoProfilerHandle* MonoMethods::profiler_create(MonoProfiler* prof)
+    {
+        return m_Impl->profiler_create(prof);
+    }
+
+    void MonoMethods::profiler_set_call_instrumentation_filter_callback(MonoProfilerHandle* handle, int (*cb)(MonoProfiler* prof, MonoMethod* method))
+    {
+        m_Impl->profiler_set_call_instrumentation_filter_callback(handle, cb);
+    }
+
+    void MonoMethods::profiler_set_method_enter_callback(MonoProfilerHandle* handle, void (*cb)(MonoProfiler* prof, MonoMethod* method, MonoProfilerCallContext* context))
+    {
+        m_Impl->profiler_set_method_enter_callback(handle, cb);
+    }
+
+    void MonoMethods::profiler_set_method_leave_callback(MonoProfilerHandle* handle, void (*cb)(MonoProfiler* prof, MonoMethod* method, MonoProfilerCallContext* context))
+    {
+        m_Impl->profiler_set_method_leave_callback(handle, cb);
+    }
+
+    void MonoMethods::profiler_set_method_tail_call_callback(MonoProfilerHandle* handle, void (*cb)(MonoProfiler* prof, MonoMethod* method, MonoMethod* target))
+    {
+        m_Impl->profiler_set_method_tail_call_callback(handle, cb);
+    }
+
+    void MonoMethods::profiler_set_method_exception_leave_callback(MonoProfilerHandle* handle, void (*cb)(MonoProfiler* prof, MonoMethod* method, MonoObject* exception))
+    {
+        m_Impl->profiler_set_method_exception_leave_callback(handle, cb);
+    }
+
+    void MonoMethods::profiler_set_image_loaded_callback(MonoProfilerHandle* handle, void (*cb)(MonoProfiler* prof, MonoImage* image))
+    {
+        m_Impl->profiler_set_image_loaded_callback(handle, cb);
+    }
+
+    bool MonoMethods::profiler_enable_allocations()
+    {
+        return m_Impl->profiler_enable_allocations() != 0;
+    }
+
+    void MonoMethods::profiler_set_gc_allocation_callback(MonoProfilerHandle* handle, void (*cb)(MonoProfiler* prof, MonoObject* obj))
+    {
+        m_Impl->profiler_set_gc_allocation_callback(handle, cb);
+    }
+
+    int32_t MonoMethods::domain_get_id(MonoDomain* domain)
+    {
+        return m_Impl->domain_get_id(domain);
+    }
+
+    MonoClass* MonoMethods::class_get_nesting_type(MonoClass* klass)
+    {
+        return m_Impl->class_get_nesting_type(klass);
+    }
 }
\ No newline at end of file
@@ -0,0 +1,459 @@
+#include <cse/profiler.hpp>
+#include <cse/executor.hpp>
+#include <cse/managed_method.hpp>
+#include <cse/log.hpp>
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <map>
+#include <mutex>
+#include <unordered_map>
+#include <unordered_set>
+
+namespace cse
+{
+    namespace
+    {
+        int64_t Now()
+        {
+            return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+        }
+
+        // one distinct call path
+        struct Node
+        {
+            MonoMethod* m_Method = nullptr;
+            std::unordered_map<MonoMethod*, std::unique_ptr<Node>> m_Children;
+
+            int64_t m_SelfNs = 0;
+            uint64_t m_Allocations = 0;
+            uint64_t m_AllocatedBytes = 0;
+        };
+
+        struct MethodTotals
+        {
+            uint64_t m_Calls = 0;
+            int64_t m_InclusiveNs = 0;
+            int64_t m_ExclusiveNs = 0;
+            uint64_t m_Allocations = 0;
+            uint64_t m_AllocatedBytes = 0;
+
+            // frames of the method on the stack, inclusive time is only added when the outermost returns
+            uint32_t m_Active = 0;
+        };
+
+        struct Frame
+        {
+            MonoMethod* m_Method;
+            Node* m_Node;
+            MethodTotals* m_Totals;
+            int64_t m_Start;
+            int64_t m_ChildrenNs;
+        };
+
+        // written by its own thread only, the lock is uncontended unless a report or reset runs
+        struct ThreadProfile
+        {
+            std::mutex m_Mutex;
+            Node m_Root;
+            std::unordered_map<MonoMethod*, MethodTotals> m_Methods;
+            std::vector<Frame> m_Stack;
+
+            void Pop(int64_t now)
+            {
+                Frame frame = m_Stack.back();
+                m_Stack.pop_back();
+
+                int64_t elapsed = now - frame.m_Start;
+                int64_t self = std::max<int64_t>(elapsed - frame.m_ChildrenNs, 0);
+
+                frame.m_Node->m_SelfNs += self;
+                frame.m_Totals->m_ExclusiveNs += self;
+                if (--frame.m_Totals->m_Active == 0)
+                {
+                    frame.m_Totals->m_InclusiveNs += elapsed;
+                }
+
+                if (!m_Stack.empty())
+                {
+                    m_Stack.back().m_ChildrenNs += elapsed;
+                }
+            }
+
+            void Clear()
+            {
+                m_Root.m_Children.clear();
+                m_Root.m_SelfNs = 0;
+                m_Methods.clear();
+                m_Stack.clear();
+            }
+        };
+
+        thread_local ThreadProfile* s_Thread = nullptr;
+    }
+
+    struct ScriptProfiler::Impl
+    {
+        std::mutex m_Mutex;
+        MonoProfilerHandle* m_Handle = nullptr;
+
+        std::atomic<bool> m_Running = false;
+        bool m_Allocations = false;
+        bool m_AllocationsEnabled = false;
+
+        std::unordered_set<MonoImage*> m_Images;
+
+        // resolved when a method is compiled, reports never call into the runtime
+        std::unordered_map<MonoMethod*, std::string> m_Names;
+
+        // kept after their threads exit, their data is still part of the profile
+        std::vector<std::unique_ptr<ThreadProfile>> m_Threads;
+
+        ThreadProfile& CurrentThread()
+        {
+            if (!s_Thread)
+            {
+                std::lock_guard lock(m_Mutex);
+                s_Thread = m_Threads.emplace_back(std::make_unique<ThreadProfile>()).get();
+            }
+
+            return *s_Thread;
+        }
+
+        static Impl& From(MonoProfiler* prof)
+        {
+            return *static_cast<Impl*>(prof);
+        }
+
+        static int Filter(MonoProfiler* prof, MonoMethod* method)
+        {
+            static auto& methods = MonoMethods::GetInstance();
+            auto& self = From(prof);
+
+            if (!self.m_Running.load(std::memory_order_relaxed))
+            {
+                return MONO_PROFILER_CALL_INSTRUMENTATION_NONE;
+            }
+
+            MonoClass* klass = methods.method_get_class(method);
+            MonoImage* image = klass ? methods.class_get_image(klass) : nullptr;
+
+            std::lock_guard lock(self.m_Mutex);
+            if (!self.m_Images.contains(image))
+            {
+                return MONO_PROFILER_CALL_INSTRUMENTATION_NONE;
+            }
+
+            if (!self.m_Names.contains(method))
+            {
+                self.m_Names.emplace(method, MethodFullName(method));
+            }
+
+            return MONO_PROFILER_CALL_INSTRUMENTATION_ENTER | MONO_PROFILER_CALL_INSTRUMENTATION_LEAVE |
+                MONO_PROFILER_CALL_INSTRUMENTATION_TAIL_CALL | MONO_PROFILER_CALL_INSTRUMENTATION_EXCEPTION_LEAVE;
+        }
+
+        // the script's own assembly is loaded on the executing thread, before any of its methods is compiled
+        static void ImageLoaded(MonoProfiler* prof, MonoImage* image)
+        {
+            if (Executor::CurrentExecutionId() == 0)
+            {
+                return;
+            }
+
+            auto& self = From(prof);
+            std::lock_guard lock(self.m_Mutex);
+            self.m_Images.insert(image);
+        }
+
+        static void Enter(MonoProfiler* prof, MonoMethod* method, MonoProfilerCallContext*)
+        {
+            auto& thread = From(prof).CurrentThread();
+            std::lock_guard lock(thread.m_Mutex);
+
+            Node* parent = thread.m_Stack.empty() ? &thread.m_Root : thread.m_Stack.back().m_Node;
+            Node* node = parent;
+            if (thread.m_Stack.size() < MAX_DEPTH)
+            {
+                auto& child = parent->m_Children[method];
+                if (!child)
+                {
+                    child = std::make_unique<Node>();
+                    child->m_Method = method;
+                }
+
+                node = child.get();
+            }
+
+            auto& totals = thread.m_Methods[method];
+            totals.m_Calls++;
+            totals.m_Active++;
+
+            thread.m_Stack.push_back({ method, node, &totals, Now(), 0 });
+        }
+
+        static void Leave(MonoProfiler* prof, MonoMethod* method)
+        {
+            int64_t now = Now();
+            auto& thread = From(prof).CurrentThread();
+            std::lock_guard lock(thread.m_Mutex);
+
+            // frames above it unwound without being reported, or it was entered before the last start or reset
+            auto& stack = thread.m_Stack;
+            auto it = std::find_if(stack.rbegin(), stack.rend(), [&](const Frame& frame) { return frame.m_Method == method; });
+            if (it == stack.rend())
+            {
+                return;
+            }
+
+            size_t depth = stack.size() - 1 - std::distance(stack.rbegin(), it);
+            while (stack.size() > depth)
+            {
+                thread.Pop(now);
+            }
+        }
+
+        static void LeaveNormally(MonoProfiler* prof, MonoMethod* method, MonoProfilerCallContext*)
+        {
+            Leave(prof, method);
+        }
+
+        static void LeaveByTailCall(MonoProfiler* prof, MonoMethod* method, MonoMethod*)
+        {
+            Leave(prof, method);
+        }
+
+        static void LeaveByException(MonoProfiler* prof, MonoMethod* method, MonoObject*)
+        {
+            Leave(prof, method);
+        }
+
+        // charged to the innermost profiled frame, allocations outside profiled code are ignored
+        static void Allocation(MonoProfiler*, MonoObject* obj)
+        {
+            static auto& methods = MonoMethods::GetInstance();
+
+            ThreadProfile* thread = s_Thread;
+            if (!thread)
+            {
+                return;
+            }
+
+            std::lock_guard lock(thread->m_Mutex);
+            if (thread->m_Stack.empty())
+            {
+                return;
+            }
+
+            uint32_t size = methods.object_get_size(obj);
+            auto& frame = thread->m_Stack.back();
+            frame.m_Node->m_Allocations++;
+            frame.m_Node->m_AllocatedBytes += size;
+            frame.m_Totals->m_Allocations++;
+            frame.m_Totals->m_AllocatedBytes += size;
+        }
+
+        void Fold(const Node& node, std::string& path, std::map<std::string, uint64_t>& folded)
+        {
+            size_t length = path.size();
+            if (node.m_Method)
+            {
+                auto name = m_Names.find(node.m_Method);
+                if (!path.empty())
+                {
+                    path += ';';
+                }
+
+                path += name != m_Names.end() ? name->second : "?";
+
+                if (uint64_t us = static_cast<uint64_t>(node.m_SelfNs / 1000))
+                {
+                    folded[path] += us;
+                }
+            }
+
+            for (const auto& [method, child] : node.m_Children)
+            {
+                Fold(*child, path, folded);
+            }
+
+            path.resize(length);
+        }
+    };
+
+    ScriptProfiler& ScriptProfiler::GetInstance()
+    {
+        static ScriptProfiler instance;
+        return instance;
+    }
+
+    ScriptProfiler::ScriptProfiler()
+        : m_Impl(std::make_unique<Impl>())
+    {
+    }
+
+    ScriptProfiler::~ScriptProfiler() = default;
+
+    bool ScriptProfiler::Start(bool allocations)
+    {
+        static auto& methods = MonoMethods::GetInstance();
+        auto& impl = *m_Impl;
+
+        if (!methods.supports(MonoFeature::Profiler))
+        {
+            log_warn("[Profiler] The runtime has no profiler API");
+            return false;
+        }
+
+        std::lock_guard lock(impl.m_Mutex);
+
+        // handles can't be destroyed, one is created on the first start and reused
+        if (!impl.m_Handle)
+        {
+            impl.m_Handle = methods.profiler_create(&impl);
+        }
+
+        if (allocations && !impl.m_AllocationsEnabled)
+        {
+            impl.m_AllocationsEnabled = methods.profiler_enable_allocations();
+            if (!impl.m_AllocationsEnabled)
+            {
+                log_warn("[Profiler] The runtime refused allocation events, profiling calls only");
+            }
+        }
+
+        // frames left over from the last run will never see their leave
+        for (auto& thread : impl.m_Threads)
+        {
+            std::lock_guard threadLock(thread->m_Mutex);
+            thread->m_Stack.clear();
+            for (auto& [method, totals] : thread->m_Methods)
+            {
+                totals.m_Active = 0;
+            }
+        }
+
+        impl.m_Allocations = allocations && impl.m_AllocationsEnabled;
+
+        methods.profiler_set_call_instrumentation_filter_callback(impl.m_Handle, &Impl::Filter);
+        methods.profiler_set_image_loaded_callback(impl.m_Handle, &Impl::ImageLoaded);
+        methods.profiler_set_method_enter_callback(impl.m_Handle, &Impl::Enter);
+        methods.profiler_set_method_leave_callback(impl.m_Handle, &Impl::LeaveNormally);
+        methods.profiler_set_method_tail_call_callback(impl.m_Handle, &Impl::LeaveByTailCall);
+        methods.profiler_set_method_exception_leave_callback(impl.m_Handle, &Impl::LeaveByException);
+        methods.profiler_set_gc_allocation_callback(impl.m_Handle, impl.m_Allocations ? &Impl::Allocation : nullptr);
+
+        impl.m_Running = true;
+        log_info("[Profiler] Started (allocations: %d)", impl.m_Allocations);
+        return true;
+    }
+
+    void ScriptProfiler::Stop()
+    {
+        static auto& methods = MonoMethods::GetInstance();
+        auto& impl = *m_Impl;
+
+        std::lock_guard lock(impl.m_Mutex);
+        if (!impl.m_Running)
+        {
+            return;
+        }
+
+        // nothing of this module is called by the runtime afterwards, the handle itself only holds data
+        impl.m_Running = false;
+        methods.profiler_set_call_instrumentation_filter_callback(impl.m_Handle, nullptr);
+        methods.profiler_set_image_loaded_callback(impl.m_Handle, nullptr);
+        methods.profiler_set_method_enter_callback(impl.m_Handle, nullptr);
+        methods.profiler_set_method_leave_callback(impl.m_Handle, nullptr);
+        methods.profiler_set_method_tail_call_callback(impl.m_Handle, nullptr);
+        methods.profiler_set_method_exception_leave_callback(impl.m_Handle, nullptr);
+        methods.profiler_set_gc_allocation_callback(impl.m_Handle, nullptr);
+        log_info("[Profiler] Stopped");
+    }
+
+    void ScriptProfiler::Reset()
+    {
+        std::lock_guard lock(m_Impl->m_Mutex);
+        for (auto& thread : m_Impl->m_Threads)
+        {
+            std::lock_guard threadLock(thread->m_Mutex);
+            thread->Clear();
+        }
+    }
+
+    void ScriptProfiler::TrackImage(MonoImage* image)
+    {
+        if (!image)
+        {
+            return;
+        }
+
+        std::lock_guard lock(m_Impl->m_Mutex);
+        m_Impl->m_Images.insert(image);
+    }
+
+    ProfileReport ScriptProfiler::Report(size_t limit)
+    {
+        auto& impl = *m_Impl;
+        std::lock_guard lock(impl.m_Mutex);
+
+        ProfileReport report;
+        report.m_Running = impl.m_Running;
+        report.m_Allocations = impl.m_Allocations;
+        report.m_Instrumented = impl.m_Names.size();
+
+        std::unordered_map<MonoMethod*, MethodTotals> totals;
+        std::map<std::string, uint64_t> folded;
+        std::string path;
+
+        for (auto& thread : impl.m_Threads)
+        {
+            std::lock_guard threadLock(thread->m_Mutex);
+            if (thread->m_Methods.empty())
+            {
+                continue;
+            }
+
+            report.m_Threads++;
+            for (const auto& [method, threadTotals] : thread->m_Methods)
+            {
+                auto& total = totals[method];
+                total.m_Calls += threadTotals.m_Calls;
+                total.m_InclusiveNs += threadTotals.m_InclusiveNs;
+                total.m_ExclusiveNs += threadTotals.m_ExclusiveNs;
+                total.m_Allocations += threadTotals.m_Allocations;
+                total.m_AllocatedBytes += threadTotals.m_AllocatedBytes;
+            }
+
+            impl.Fold(thread->m_Root, path, folded);
+        }
+
+        report.m_Methods.reserve(totals.size());
+        for (const auto& [method, total] : totals)
+        {
+            auto name = impl.m_Names.find(method);
+            report.m_Methods.push_back({
+                name != impl.m_Names.end() ? name->second : "?",
+                total.m_Calls,
+                total.m_InclusiveNs / 1e6,
+                total.m_ExclusiveNs / 1e6,
+                total.m_Allocations,
+                total.m_AllocatedBytes,
+            });
+        }
+
+        std::ranges::sort(report.m_Methods, std::ranges::greater{}, &ProfiledMethod::m_ExclusiveMs);
+        if (report.m_Methods.size() > limit)
+        {
+            report.m_Methods.resize(limit);
+        }
+
+        report.m_Folded.reserve(folded.size());
+        for (const auto& [stack, us] : folded)
+        {
+            report.m_Folded.push_back(stack + " " + std::to_string(us));
+        }
+
+        return report;
+    }
+}
\ No newline at end of file
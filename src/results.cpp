@@ -0,0 +1,253 @@
+#include <cse/results.hpp>
+#include <cse/entry.hpp>
+#include <cse/executor.hpp>
+#include <cse/log.hpp>
+#include <cse/ring.hpp>
+#include <cse/utf8.hpp>
+#include <algorithm>
+#include <atomic>
+#include <cstring>
+#include <deque>
+#include <mutex>
+#include <span>
+
+namespace cse
+{
+    namespace
+    {
+        // keys longer than this (in UTF-16 units) are cut
+        constexpr size_t MAX_KEY_LENGTH = 256;
+
+        struct RecordHeader
+        {
+            uint32_t m_KeyLength;
+            uint32_t m_PayloadLength;
+            uint64_t m_Sequence;
+            uint64_t m_Timestamp;
+        };
+        static_assert(sizeof(RecordHeader) == 24);
+
+        struct Channel
+        {
+            uint64_t m_Execution;
+            MonoDomain* m_Domain;
+            std::string m_Resource;
+            std::string m_Assembly;
+            std::chrono::steady_clock::time_point m_Opened = std::chrono::steady_clock::now();
+
+            RecordRing<ResultChannels::CHANNEL_CAPACITY> m_Ring;
+            std::atomic<uint64_t> m_Sequence{ 0 };
+            std::atomic<uint64_t> m_Emitted{ 0 };
+            std::atomic<uint64_t> m_Dropped{ 0 };
+
+            // any number of threads, never blocks once the buffer exists
+            void Emit(const uint16_t* key, size_t keyLength, const uint8_t* payload, size_t payloadLength)
+            {
+                std::span<const uint16_t> keyText(key, std::min(keyLength, MAX_KEY_LENGTH));
+                size_t keyBytes = Utf8Length(keyText);
+
+                bool appended = m_Ring.Append(sizeof(RecordHeader) + keyBytes + payloadLength, [&](uint8_t* body)
+                {
+                    auto* header = reinterpret_cast<RecordHeader*>(body);
+                    header->m_KeyLength = static_cast<uint32_t>(keyBytes);
+                    header->m_PayloadLength = static_cast<uint32_t>(payloadLength);
+                    header->m_Sequence = m_Sequence.fetch_add(1, std::memory_order_relaxed);
+                    header->m_Timestamp = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - m_Opened).count();
+
+                    EncodeUtf8(keyText, body + sizeof(RecordHeader));
+                    if (payloadLength > 0)
+                    {
+                        std::memcpy(body + sizeof(RecordHeader) + keyBytes, payload, payloadLength);
+                    }
+                });
+
+                (appended ? m_Emitted : m_Dropped).fetch_add(1, std::memory_order_relaxed);
+            }
+
+            void Read(uint64_t& cursor, size_t maxBytes, ResultBatch& batch)
+            {
+                batch.m_Skipped += m_Ring.Read(cursor, maxBytes, batch.m_Records, [](const uint8_t* body, size_t length) -> std::optional<ResultRecord>
+                {
+                    RecordHeader header;
+                    std::memcpy(&header, body, sizeof(header));
+                    if (sizeof(RecordHeader) + uint64_t(header.m_KeyLength) + header.m_PayloadLength > length)
+                    {
+                        return std::nullopt;
+                    }
+
+                    ResultRecord result;
+                    result.m_Sequence = header.m_Sequence;
+                    result.m_Timestamp = header.m_Timestamp;
+                    result.m_Key.assign(reinterpret_cast<const char*>(body + sizeof(RecordHeader)), header.m_KeyLength);
+
+                    const uint8_t* payload = body + sizeof(RecordHeader) + header.m_KeyLength;
+                    result.m_Payload.assign(payload, payload + header.m_PayloadLength);
+                    return result;
+                });
+            }
+        };
+    }
+
+    struct ResultChannels::Impl
+    {
+        std::mutex m_Mutex;
+        std::deque<std::shared_ptr<Channel>> m_Channels;
+
+        // bumped whenever m_Channels changes, invalidates the per-thread lookups in Current
+        std::atomic<uint64_t> m_Generation{ 1 };
+
+        std::shared_ptr<Channel> Find(uint64_t execution)
+        {
+            std::lock_guard lock(m_Mutex);
+            for (const auto& channel : m_Channels)
+            {
+                if (channel->m_Execution == execution)
+                {
+                    return channel;
+                }
+            }
+
+            return nullptr;
+        }
+
+        // code running while its assembly loads belongs to that execution, later calls (ticks, events)
+        // to the latest execution in the calling domain
+        std::shared_ptr<Channel> Current()
+        {
+            static auto& methods = MonoMethods::GetInstance();
+
+            struct Cached
+            {
+                uint64_t m_Generation = 0;
+                uint64_t m_Execution = 0;
+                MonoDomain* m_Domain = nullptr;
+                std::shared_ptr<Channel> m_Channel;
+            };
+            static thread_local Cached s_Cached;
+
+            uint64_t execution = Executor::CurrentExecutionId();
+            MonoDomain* domain = execution ? nullptr : methods.domain_get();
+            uint64_t generation = m_Generation.load(std::memory_order_acquire);
+
+            if (s_Cached.m_Generation == generation && s_Cached.m_Execution == execution && s_Cached.m_Domain == domain)
+            {
+                return s_Cached.m_Channel;
+            }
+
+            std::shared_ptr<Channel> found;
+            {
+                std::lock_guard lock(m_Mutex);
+                for (auto it = m_Channels.rbegin(); it != m_Channels.rend(); ++it)
+                {
+                    if (execution ? (*it)->m_Execution == execution : (*it)->m_Domain == domain)
+                    {
+                        found = *it;
+                        break;
+                    }
+                }
+            }
+
+            s_Cached = { generation, execution, domain, found };
+            return found;
+        }
+
+        // Cse.CseHost.Emit(string key, byte[] payload), called from managed code
+        static void Emit(MonoString* key, MonoArray* payload)
+        {
+            static auto& methods = MonoMethods::GetInstance();
+
+            auto channel = ResultChannels::GetInstance().m_Impl->Current();
+            if (!channel)
+                return;
+
+            const uint16_t* keyChars = key ? methods.string_chars(key) : nullptr;
+            size_t keyLength = key ? methods.string_length(key) : 0;
+
+            const uint8_t* bytes = nullptr;
+            size_t length = 0;
+            if (payload)
+            {
+                length = methods.array_length(payload);
+                bytes = static_cast<const uint8_t*>(methods.array_addr_with_size(payload, sizeof(uint8_t), 0));
+            }
+
+            channel->Emit(keyChars, keyLength, bytes, length);
+        }
+    };
+
+    ResultChannels& ResultChannels::GetInstance()
+    {
+        static ResultChannels instance;
+        return instance;
+    }
+
+    ResultChannels::ResultChannels()
+        : m_Impl(std::make_unique<Impl>())
+    {
+    }
+
+    ResultChannels::~ResultChannels() = default;
+
+    void ResultChannels::Install()
+    {
+        static auto& methods = MonoMethods::GetInstance();
+        methods.add_internal_call("Cse.CseHost::Emit", reinterpret_cast<const void*>(&Impl::Emit));
+
+        // Mono can't unbind an internal call, scripts would call into freed code after an unload
+        pin_module("Cse.CseHost::Emit is bound to it");
+    }
+
+    void ResultChannels::Open(uint64_t execution, MonoDomain* domain, const std::string& resource, const std::string& assembly)
+    {
+        auto channel = std::make_shared<Channel>();
+        channel->m_Execution = execution;
+        channel->m_Domain = domain;
+        channel->m_Resource = resource;
+        channel->m_Assembly = assembly;
+
+        std::lock_guard lock(m_Impl->m_Mutex);
+        m_Impl->m_Channels.push_back(std::move(channel));
+        if (m_Impl->m_Channels.size() > MAX_CHANNELS)
+        {
+            m_Impl->m_Channels.pop_front();
+        }
+
+        m_Impl->m_Generation.fetch_add(1, std::memory_order_release);
+    }
+
+    std::optional<ResultBatch> ResultChannels::Read(uint64_t execution, uint64_t cursor, size_t maxBytes, std::chrono::milliseconds wait)
+    {
+        auto channel = m_Impl->Find(execution);
+        if (!channel)
+        {
+            return std::nullopt;
+        }
+
+        channel->m_Ring.Wait(cursor, wait);
+
+        ResultBatch batch;
+        channel->Read(cursor, maxBytes, batch);
+        batch.m_Cursor = cursor;
+        return batch;
+    }
+
+    std::vector<ResultChannelInfo> ResultChannels::List()
+    {
+        std::lock_guard lock(m_Impl->m_Mutex);
+
+        std::vector<ResultChannelInfo> result;
+        for (const auto& channel : m_Impl->m_Channels)
+        {
+            result.push_back({
+                channel->m_Execution,
+                channel->m_Resource,
+                channel->m_Assembly,
+                channel->m_Emitted.load(std::memory_order_relaxed),
+                channel->m_Dropped.load(std::memory_order_relaxed),
+                channel->m_Ring.GetWritten(),
+            });
+        }
+
+        return result;
+    }
+}
\ No newline at end of file
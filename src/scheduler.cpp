@@ -0,0 +1,372 @@
+#include <cse/scheduler.hpp>
+#include <cse/console.hpp>
+#include <mutex>
+#include <condition_variable>
+#include <thread>
+#include <deque>
+#include <array>
+#include <chrono>
+#include <unordered_map>
+#include <unordered_set>
+#include <algorithm>
+
+namespace cse
+{
+    const char* PriorityClassName(PriorityClass priority)
+    {
+        switch (priority)
+        {
+        case PriorityClass::Interactive:
+            return "interactive";
+        case PriorityClass::Execution:
+            return "execution";
+        case PriorityClass::Bulk:
+            return "bulk";
+        default:
+            return "unknown";
+        }
+    }
+
+    struct Scheduler::Impl
+    {
+        using clock = std::chrono::steady_clock;
+
+        static constexpr size_t CLASS_COUNT = static_cast<size_t>(PriorityClass::Count);
+
+        // after this many picks from a higher class while a lower one waits, the lower one gets a turn
+        static constexpr uint32_t STARVATION_LIMIT = 8;
+
+        static constexpr size_t WAIT_SAMPLES = 1024;
+
+        struct Task
+        {
+            std::function<void()> m_Function;
+            std::string m_Key;
+            clock::time_point m_Enqueued;
+
+            // virtual finish time, the smallest eligible one runs next
+            double m_Finish;
+        };
+
+        struct ClientQueue
+        {
+            std::deque<Task> m_Tasks;
+            double m_LastFinish = 0;
+        };
+
+        struct ClassQueue
+        {
+            std::unordered_map<uint64_t, ClientQueue> m_Clients;
+            double m_VirtualTime = 0;
+            size_t m_Depth = 0;
+
+            uint64_t m_Submitted = 0;
+            uint64_t m_Completed = 0;
+            double m_WaitTotalMs = 0;
+            double m_WaitMaxMs = 0;
+            std::array<double, WAIT_SAMPLES> m_WaitSamples{};
+            size_t m_WaitSampleCount = 0;
+        };
+
+        std::mutex m_Mutex;
+        std::condition_variable m_WorkAvailable;
+        std::array<ClassQueue, CLASS_COUNT> m_Classes;
+        std::unordered_map<uint64_t, uint32_t> m_Weights;
+        std::unordered_set<std::string> m_RunningKeys;
+        std::vector<std::thread> m_Workers;
+        uint32_t m_HighStreak = 0;
+        size_t m_Busy = 0;
+        bool m_Stopping = false;
+
+        Impl()
+        {
+            size_t count = std::clamp<size_t>(std::thread::hardware_concurrency(), 2, 8);
+            for (size_t i = 0; i < count; ++i)
+            {
+                // worker 0 is reserved for interactive work, its latency never depends on long executions
+                m_Workers.emplace_back(&Impl::WorkerThread, this, i == 0);
+            }
+        }
+
+        ~Impl()
+        {
+            for (auto& worker : m_Workers)
+            {
+                if (worker.joinable())
+                {
+                    worker.detach();
+                }
+            }
+        }
+
+        // requires m_Mutex, returns the client whose head task should run next
+        ClientQueue* PickClient(ClassQueue& queue, uint64_t& clientId)
+        {
+            ClientQueue* best = nullptr;
+            for (auto& [id, client] : queue.m_Clients)
+            {
+                if (client.m_Tasks.empty())
+                    continue;
+
+                const Task& head = client.m_Tasks.front();
+                if (!head.m_Key.empty() && m_RunningKeys.contains(head.m_Key))
+                    continue;
+
+                if (!best || head.m_Finish < best->m_Tasks.front().m_Finish)
+                {
+                    best = &client;
+                    clientId = id;
+                }
+            }
+
+            return best;
+        }
+
+        // requires m_Mutex
+        bool TryPop(bool interactiveOnly, Task& task, size_t& classIndex)
+        {
+            std::array<size_t, CLASS_COUNT> order;
+            for (size_t i = 0; i < CLASS_COUNT; ++i)
+            {
+                order[i] = i;
+            }
+
+            if (m_HighStreak >= STARVATION_LIMIT)
+            {
+                std::reverse(order.begin(), order.end());
+            }
+
+            for (size_t index : order)
+            {
+                if (interactiveOnly && index != static_cast<size_t>(PriorityClass::Interactive))
+                    continue;
+
+                auto& queue = m_Classes[index];
+                if (queue.m_Depth == 0)
+                    continue;
+
+                uint64_t clientId = 0;
+                ClientQueue* client = PickClient(queue, clientId);
+                if (!client)
+                    continue;
+
+                task = std::move(client->m_Tasks.front());
+                client->m_Tasks.pop_front();
+                queue.m_Depth--;
+                queue.m_VirtualTime = task.m_Finish;
+
+                if (client->m_Tasks.empty())
+                {
+                    queue.m_Clients.erase(clientId);
+                }
+
+                bool lowerWaiting = false;
+                for (size_t lower = index + 1; lower < CLASS_COUNT; ++lower)
+                {
+                    lowerWaiting |= m_Classes[lower].m_Depth != 0;
+                }
+
+                m_HighStreak = lowerWaiting ? m_HighStreak + 1 : 0;
+                if (m_HighStreak > STARVATION_LIMIT)
+                {
+                    m_HighStreak = 0;
+                }
+
+                if (!task.m_Key.empty())
+                {
+                    m_RunningKeys.insert(task.m_Key);
+                }
+
+                classIndex = index;
+                return true;
+            }
+
+            return false;
+        }
+
+        // requires m_Mutex
+        void RecordWait(ClassQueue& queue, double waitMs)
+        {
+            queue.m_WaitTotalMs += waitMs;
+            queue.m_WaitMaxMs = std::max(queue.m_WaitMaxMs, waitMs);
+            queue.m_WaitSamples[queue.m_WaitSampleCount % WAIT_SAMPLES] = waitMs;
+            queue.m_WaitSampleCount++;
+        }
+
+        void WorkerThread(bool interactiveOnly)
+        {
+            while (true)
+            {
+                Task task;
+                size_t classIndex = 0;
+                {
+                    std::unique_lock lock(m_Mutex);
+                    m_WorkAvailable.wait(lock, [&]
+                    {
+                        if (TryPop(interactiveOnly, task, classIndex))
+                            return true;
+
+                        return m_Stopping && (interactiveOnly ? m_Classes[0].m_Depth == 0 : AllEmpty());
+                    });
+
+                    if (!task.m_Function)
+                    {
+                        return;
+                    }
+
+                    double waitMs = std::chrono::duration<double, std::milli>(clock::now() - task.m_Enqueued).count();
+                    RecordWait(m_Classes[classIndex], waitMs);
+                    m_Busy++;
+                }
+
+                task.m_Function();
+
+                {
+                    std::lock_guard lock(m_Mutex);
+                    m_Busy--;
+                    m_Classes[classIndex].m_Completed++;
+
+                    if (!task.m_Key.empty())
+                    {
+                        m_RunningKeys.erase(task.m_Key);
+                    }
+                }
+
+                // a freed key may unblock tasks any worker could take
+                m_WorkAvailable.notify_all();
+            }
+        }
+
+        // requires m_Mutex
+        bool AllEmpty() const
+        {
+            return std::all_of(m_Classes.begin(), m_Classes.end(), [](const ClassQueue& q) { return q.m_Depth == 0; });
+        }
+    };
+
+    Scheduler& Scheduler::GetInstance()
+    {
+        static Scheduler instance;
+        return instance;
+    }
+
+    Scheduler::Scheduler()
+        : m_Impl(std::make_unique<Impl>())
+    {
+    }
+
+    Scheduler::~Scheduler() = default;
+
+    bool Scheduler::Submit(std::function<void()> task, PriorityClass priority, uint64_t clientId, const std::string& serialKey)
+    {
+        {
+            std::lock_guard lock(m_Impl->m_Mutex);
+            if (m_Impl->m_Stopping)
+            {
+                return false;
+            }
+
+            auto& queue = m_Impl->m_Classes[static_cast<size_t>(priority)];
+            auto& client = queue.m_Clients[clientId];
+
+            auto weightIt = m_Impl->m_Weights.find(clientId);
+            double weight = weightIt != m_Impl->m_Weights.end() ? weightIt->second : 1.0;
+
+            // self-clocked fair queuing: a client's tasks are spaced 1/weight apart in virtual time
+            double start = std::max(client.m_LastFinish, queue.m_VirtualTime);
+            double finish = start + 1.0 / weight;
+            client.m_LastFinish = finish;
+
+            client.m_Tasks.push_back({ std::move(task), serialKey, Impl::clock::now(), finish });
+            queue.m_Depth++;
+            queue.m_Submitted++;
+        }
+
+        m_Impl->m_WorkAvailable.notify_all();
+        return true;
+    }
+
+    void Scheduler::SetClientWeight(uint64_t clientId, uint32_t weight)
+    {
+        std::lock_guard lock(m_Impl->m_Mutex);
+        m_Impl->m_Weights[clientId] = std::max<uint32_t>(weight, 1);
+    }
+
+    void Scheduler::RemoveClient(uint64_t clientId)
+    {
+        std::lock_guard lock(m_Impl->m_Mutex);
+        m_Impl->m_Weights.erase(clientId);
+    }
+
+    SchedulerStats Scheduler::GetStats()
+    {
+        std::lock_guard lock(m_Impl->m_Mutex);
+
+        SchedulerStats stats;
+        stats.m_Workers = m_Impl->m_Workers.size();
+        stats.m_Busy = m_Impl->m_Busy;
+
+        std::unordered_map<uint64_t, size_t> clientDepth;
+
+        for (size_t i = 0; i < Impl::CLASS_COUNT; ++i)
+        {
+            const auto& queue = m_Impl->m_Classes[i];
+
+            SchedulerClassStats classStats;
+            classStats.m_Class = static_cast<PriorityClass>(i);
+            classStats.m_Depth = queue.m_Depth;
+            classStats.m_Submitted = queue.m_Submitted;
+            classStats.m_Completed = queue.m_Completed;
+            classStats.m_WaitMaxMs = queue.m_WaitMaxMs;
+
+            size_t started = queue.m_WaitSampleCount;
+            if (started)
+            {
+                classStats.m_WaitAvgMs = queue.m_WaitTotalMs / started;
+
+                std::vector<double> samples(queue.m_WaitSamples.begin(), queue.m_WaitSamples.begin() + std::min(started, Impl::WAIT_SAMPLES));
+                std::sort(samples.begin(), samples.end());
+                classStats.m_WaitP50Ms = samples[samples.size() / 2];
+                classStats.m_WaitP99Ms = samples[std::min(samples.size() - 1, samples.size() * 99 / 100)];
+            }
+
+            stats.m_Classes.push_back(classStats);
+
+            for (const auto& [id, client] : queue.m_Clients)
+            {
+                clientDepth[id] += client.m_Tasks.size();
+            }
+        }
+
+        for (const auto& [id, weight] : m_Impl->m_Weights)
+        {
+            clientDepth.try_emplace(id, 0);
+        }
+
+        for (const auto& [id, depth] : clientDepth)
+        {
+            auto weightIt = m_Impl->m_Weights.find(id);
+            stats.m_Clients.push_back({ id, weightIt != m_Impl->m_Weights.end() ? weightIt->second : 1u, depth });
+        }
+
+        return stats;
+    }
+
+    void Scheduler::Shutdown()
+    {
+        {
+            std::lock_guard lock(m_Impl->m_Mutex);
+            m_Impl->m_Stopping = true;
+        }
+
+        m_Impl->m_WorkAvailable.notify_all();
+
+        for (auto& worker : m_Impl->m_Workers)
+        {
+            if (worker.joinable())
+            {
+                worker.join();
+            }
+        }
+    }
+}
\ No newline at end of file
@@ -0,0 +1,535 @@
+#include <cse/store.hpp>
+#include <cse/console.hpp>
+#include <cse/log.hpp>
+#include <fstream>
+#include <chrono>
+#include <cstring>
+#include <algorithm>
+
+namespace cse
+{
+    namespace
+    {
+        struct IndexHeader
+        {
+            static constexpr uint32_t MAGIC = 0x49455343; // "CSEI"
+            static constexpr uint32_t VERSION = 1;
+
+            uint32_t m_Magic;
+            uint32_t m_Version;
+            uint32_t m_Capacity;
+            uint32_t m_RecordSize;
+            uint8_t m_Reserved[48];
+        };
+
+        static_assert(sizeof(IndexHeader) == 64);
+
+        constexpr uint32_t INDEX_CAPACITY = 4096;
+
+        int64_t UnixNow()
+        {
+            return std::chrono::duration_cast<std::chrono::seconds>(std::chrono::system_clock::now().time_since_epoch()).count();
+        }
+
+        template <size_t N>
+        void CopyString(char (&out)[N], std::string_view value)
+        {
+            size_t length = std::min(value.size(), N - 1);
+            std::memcpy(out, value.data(), length);
+            std::memset(out + length, 0, N - length);
+        }
+
+        template <size_t N>
+        std::string_view ReadString(const char (&value)[N])
+        {
+            return std::string_view(value, strnlen(value, N));
+        }
+    }
+
+    struct AssemblyStore::Record
+    {
+        static constexpr uint8_t USED = 1;
+        static constexpr uint8_t HAS_PDB = 2;
+
+        Hash256 m_Hash;
+        uint64_t m_Size;
+        uint64_t m_StoredSize;
+        uint64_t m_PdbSize;
+        int64_t m_Created;
+        int64_t m_LastUsed;
+        uint32_t m_UseCount;
+        uint8_t m_Flags;
+        uint8_t m_Reserved[3];
+        char m_Name[64];
+
+        // comma separated, most recent first, older ones fall off when it is full
+        char m_Resources[176];
+    };
+
+    AssemblyStore& AssemblyStore::GetInstance()
+    {
+        static AssemblyStore instance;
+        return instance;
+    }
+
+    bool AssemblyStore::Open(const std::filesystem::path& directory)
+    {
+        std::lock_guard lock(m_Mutex);
+        return OpenLocked(directory);
+    }
+
+    bool AssemblyStore::OpenLocked(const std::filesystem::path& directory)
+    {
+        std::error_code ec;
+        std::filesystem::create_directories(directory / "blobs", ec);
+        if (ec)
+        {
+            println("[Store] Failed to create %s: %s", directory.string().c_str(), ec.message().c_str());
+            return false;
+        }
+
+        auto index = MappedFile::OpenWrite(directory / "index.bin", sizeof(IndexHeader) + INDEX_CAPACITY * sizeof(Record));
+        if (!index)
+        {
+            println("[Store] Failed to open the index in %s", directory.string().c_str());
+            return false;
+        }
+
+        auto* header = reinterpret_cast<IndexHeader*>(index->GetData().data());
+        if (header->m_Magic != IndexHeader::MAGIC || header->m_Version != IndexHeader::VERSION || header->m_RecordSize != sizeof(Record) ||
+            header->m_Capacity == 0 || sizeof(IndexHeader) + header->m_Capacity * sizeof(Record) > index->GetSize())
+        {
+            if (header->m_Magic != 0)
+            {
+                println("[Store] Index in %s is incompatible, starting empty", directory.string().c_str());
+            }
+
+            std::memset(index->GetData().data(), 0, index->GetSize());
+            header->m_Magic = IndexHeader::MAGIC;
+            header->m_Version = IndexHeader::VERSION;
+            header->m_Capacity = INDEX_CAPACITY;
+            header->m_RecordSize = sizeof(Record);
+        }
+
+        m_Directory = directory;
+        m_Index = std::move(index);
+        m_Slots.clear();
+        m_Bytes = 0;
+
+        Record* records = GetRecords();
+        for (uint32_t slot = 0; slot < GetCapacity(); ++slot)
+        {
+            Record& record = records[slot];
+            if (!(record.m_Flags & Record::USED))
+                continue;
+
+            // blobs removed behind our back
+            if (!std::filesystem::exists(BlobPath(record.m_Hash, false), ec))
+            {
+                std::memset(&record, 0, sizeof(Record));
+                continue;
+            }
+
+            m_Slots[record.m_Hash] = slot;
+            m_Bytes += record.m_StoredSize;
+        }
+
+        log_info("[Store] Opened %s with %zu assemblies", m_Directory.string(), m_Slots.size());
+        return true;
+    }
+
+    bool AssemblyStore::EnsureOpen()
+    {
+        if (m_Index)
+        {
+            return true;
+        }
+
+        std::error_code ec;
+        auto temp = std::filesystem::temp_directory_path(ec);
+        if (ec)
+        {
+            return false;
+        }
+
+        return OpenLocked(temp / "cse_store");
+    }
+
+    AssemblyStore::Record* AssemblyStore::GetRecords()
+    {
+        static_assert(sizeof(Record) == 320, "the index layout is persisted");
+        return reinterpret_cast<Record*>(m_Index->GetData().data() + sizeof(IndexHeader));
+    }
+
+    uint32_t AssemblyStore::GetCapacity()
+    {
+        return reinterpret_cast<const IndexHeader*>(m_Index->GetData().data())->m_Capacity;
+    }
+
+    std::filesystem::path AssemblyStore::BlobPath(const Hash256& hash, bool pdb) const
+    {
+        return m_Directory / "blobs" / (ToHex(hash) + (pdb ? ".pdb.blob" : ".dll.blob"));
+    }
+
+    bool AssemblyStore::Contains(const Hash256& hash)
+    {
+        std::lock_guard lock(m_Mutex);
+        return EnsureOpen() && m_Slots.contains(hash);
+    }
+
+    static bool WriteBlob(const std::filesystem::path& path, const std::vector<uint8_t>& blob)
+    {
+        // write aside and rename, a crash never leaves a truncated blob under the real name
+        auto temp = path;
+        temp += ".tmp";
+
+        {
+            std::ofstream file(temp, std::ios::binary | std::ios::trunc);
+            if (!file.write(reinterpret_cast<const char*>(blob.data()), blob.size()))
+            {
+                return false;
+            }
+        }
+
+        std::error_code ec;
+        std::filesystem::rename(temp, path, ec);
+        return !ec;
+    }
+
+    bool AssemblyStore::Put(const Hash256& hash, const std::string& name, std::span<const uint8_t> image, std::optional<std::span<const uint8_t>> pdb, const std::string& resource)
+    {
+        std::lock_guard lock(m_Mutex);
+        if (!EnsureOpen())
+        {
+            return false;
+        }
+
+        auto existing = m_Slots.find(hash);
+        if (existing != m_Slots.end())
+        {
+            TouchSlot(existing->second, resource);
+            return true;
+        }
+
+        auto packedImage = PackBlob(image, m_Codec);
+
+        std::vector<uint8_t> packedPdb;
+        if (pdb.has_value())
+        {
+            packedPdb = PackBlob(*pdb, m_Codec);
+        }
+
+        uint64_t storedSize = packedImage.size() + packedPdb.size();
+        if (storedSize > m_Budget)
+        {
+            return false;
+        }
+
+        Evict(storedSize);
+
+        Record* records = GetRecords();
+        uint32_t capacity = GetCapacity();
+
+        uint32_t slot = capacity;
+        for (uint32_t i = 0; i < capacity; ++i)
+        {
+            if (!(records[i].m_Flags & Record::USED))
+            {
+                slot = i;
+                break;
+            }
+        }
+
+        if (slot == capacity)
+        {
+            // index full, reuse the least recently used slot
+            slot = static_cast<uint32_t>(std::min_element(records, records + capacity, [](const Record& a, const Record& b) { return a.m_LastUsed < b.m_LastUsed; }) - records);
+            RemoveSlot(slot);
+            m_Evicted++;
+        }
+
+        if (!WriteBlob(BlobPath(hash, false), packedImage) || (pdb.has_value() && !WriteBlob(BlobPath(hash, true), packedPdb)))
+        {
+            println("[Store] Failed to write blobs for %s", ToHex(hash).c_str());
+            return false;
+        }
+
+        Record& record = records[slot];
+        std::memset(&record, 0, sizeof(Record));
+        record.m_Hash = hash;
+        record.m_Size = image.size();
+        record.m_StoredSize = storedSize;
+        record.m_PdbSize = pdb.has_value() ? pdb->size() : 0;
+        record.m_Created = UnixNow();
+        record.m_Flags = Record::USED | (pdb.has_value() ? Record::HAS_PDB : 0);
+        CopyString(record.m_Name, name);
+
+        m_Slots[hash] = slot;
+        m_Bytes += storedSize;
+
+        TouchSlot(slot, resource);
+        return true;
+    }
+
+    std::optional<StoredPayload> AssemblyStore::MapBlob(const Hash256& hash, bool pdb)
+    {
+        auto it = m_Slots.find(hash);
+        if (it == m_Slots.end())
+        {
+            return std::nullopt;
+        }
+
+        const Record& record = GetRecords()[it->second];
+        if (pdb && !(record.m_Flags & Record::HAS_PDB))
+        {
+            return std::nullopt;
+        }
+
+        std::shared_ptr<MappedFile> file = MappedFile::OpenRead(BlobPath(hash, pdb));
+        auto payload = file ? UnpackBlob(file->GetData()) : std::nullopt;
+
+        if (!payload.has_value() || payload->m_Size != (pdb ? record.m_PdbSize : record.m_Size))
+        {
+            println("[Store] Blob for %s is missing or damaged, dropping it", ToHex(hash).c_str());
+            RemoveSlot(it->second);
+            return std::nullopt;
+        }
+
+        return StoredPayload{ std::move(file), *payload };
+    }
+
+    std::optional<StoredPayload> AssemblyStore::GetImage(const Hash256& hash)
+    {
+        std::lock_guard lock(m_Mutex);
+        if (!EnsureOpen())
+        {
+            return std::nullopt;
+        }
+
+        return MapBlob(hash, false);
+    }
+
+    std::optional<StoredPayload> AssemblyStore::GetPdb(const Hash256& hash)
+    {
+        std::lock_guard lock(m_Mutex);
+        if (!EnsureOpen())
+        {
+            return std::nullopt;
+        }
+
+        return MapBlob(hash, true);
+    }
+
+    void AssemblyStore::Touch(const Hash256& hash, const std::string& resource)
+    {
+        std::lock_guard lock(m_Mutex);
+        if (!EnsureOpen())
+        {
+            return;
+        }
+
+        auto it = m_Slots.find(hash);
+        if (it != m_Slots.end())
+        {
+            TouchSlot(it->second, resource);
+        }
+    }
+
+    void AssemblyStore::TouchSlot(uint32_t slot, const std::string& resource)
+    {
+        Record& record = GetRecords()[slot];
+        record.m_LastUsed = UnixNow();
+        record.m_UseCount++;
+
+        if (resource.empty())
+            return;
+
+        std::vector<std::string_view> resources = { resource };
+
+        std::string_view existing = ReadString(record.m_Resources);
+        while (!existing.empty())
+        {
+            size_t comma = existing.find(',');
+            auto item = existing.substr(0, comma);
+            if (item != resource)
+            {
+                resources.push_back(item);
+            }
+
+            existing = comma == std::string_view::npos ? std::string_view() : existing.substr(comma + 1);
+        }
+
+        std::string joined;
+        for (auto item : resources)
+        {
+            if (joined.size() + item.size() + 1 >= sizeof(record.m_Resources))
+                break;
+
+            if (!joined.empty())
+            {
+                joined.push_back(',');
+            }
+
+            joined.append(item);
+        }
+
+        CopyString(record.m_Resources, joined);
+    }
+
+    void AssemblyStore::RemoveSlot(uint32_t slot)
+    {
+        Record& record = GetRecords()[slot];
+        if (!(record.m_Flags & Record::USED))
+            return;
+
+        std::error_code ec;
+        std::filesystem::remove(BlobPath(record.m_Hash, false), ec);
+        std::filesystem::remove(BlobPath(record.m_Hash, true), ec);
+
+        m_Slots.erase(record.m_Hash);
+        m_Bytes -= std::min(m_Bytes, record.m_StoredSize);
+        std::memset(&record, 0, sizeof(Record));
+    }
+
+    void AssemblyStore::Evict(uint64_t incoming)
+    {
+        Record* records = GetRecords();
+
+        while (!m_Slots.empty() && m_Bytes + incoming > m_Budget)
+        {
+            uint32_t oldest = 0;
+            int64_t oldestUse = INT64_MAX;
+            for (const auto& [hash, slot] : m_Slots)
+            {
+                if (records[slot].m_LastUsed < oldestUse)
+                {
+                    oldest = slot;
+                    oldestUse = records[slot].m_LastUsed;
+                }
+            }
+
+            log_debug("[Store] Evicting %s", ToHex(records[oldest].m_Hash));
+            RemoveSlot(oldest);
+            m_Evicted++;
+        }
+    }
+
+    StoreEntry AssemblyStore::ToEntry(const Record& record)
+    {
+        StoreEntry entry;
+        entry.m_Hash = record.m_Hash;
+        entry.m_Name = std::string(ReadString(record.m_Name));
+        entry.m_Size = record.m_Size;
+        entry.m_StoredSize = record.m_StoredSize;
+        entry.m_PdbSize = record.m_PdbSize;
+        entry.m_HasPdb = record.m_Flags & Record::HAS_PDB;
+        entry.m_Created = record.m_Created;
+        entry.m_LastUsed = record.m_LastUsed;
+        entry.m_UseCount = record.m_UseCount;
+
+        std::string_view resources = ReadString(record.m_Resources);
+        while (!resources.empty())
+        {
+            size_t comma = resources.find(',');
+            entry.m_Resources.emplace_back(resources.substr(0, comma));
+            resources = comma == std::string_view::npos ? std::string_view() : resources.substr(comma + 1);
+        }
+
+        return entry;
+    }
+
+    std::optional<StoreEntry> AssemblyStore::Find(const Hash256& hash)
+    {
+        std::lock_guard lock(m_Mutex);
+        if (!EnsureOpen())
+        {
+            return std::nullopt;
+        }
+
+        auto it = m_Slots.find(hash);
+        if (it == m_Slots.end())
+        {
+            return std::nullopt;
+        }
+
+        return ToEntry(GetRecords()[it->second]);
+    }
+
+    std::vector<StoreEntry> AssemblyStore::List()
+    {
+        std::lock_guard lock(m_Mutex);
+
+        std::vector<StoreEntry> entries;
+        if (!EnsureOpen())
+        {
+            return entries;
+        }
+
+        Record* records = GetRecords();
+        for (const auto& [hash, slot] : m_Slots)
+        {
+            entries.push_back(ToEntry(records[slot]));
+        }
+
+        std::sort(entries.begin(), entries.end(), [](const StoreEntry& a, const StoreEntry& b) { return a.m_LastUsed > b.m_LastUsed; });
+        return entries;
+    }
+
+    bool AssemblyStore::Remove(const Hash256& hash)
+    {
+        std::lock_guard lock(m_Mutex);
+        if (!EnsureOpen())
+        {
+            return false;
+        }
+
+        auto it = m_Slots.find(hash);
+        if (it == m_Slots.end())
+        {
+            return false;
+        }
+
+        RemoveSlot(it->second);
+        return true;
+    }
+
+    void AssemblyStore::SetBudget(uint64_t bytes)
+    {
+        std::lock_guard lock(m_Mutex);
+        m_Budget = bytes;
+
+        if (m_Index)
+        {
+            Evict(0);
+        }
+    }
+
+    void AssemblyStore::SetCodec(Codec codec)
+    {
+        std::lock_guard lock(m_Mutex);
+        m_Codec = codec;
+    }
+
+    StoreStats AssemblyStore::GetStats()
+    {
+        std::lock_guard lock(m_Mutex);
+        EnsureOpen();
+
+        StoreStats stats;
+        stats.m_Directory = m_Directory;
+        stats.m_Entries = m_Slots.size();
+        stats.m_Bytes = m_Bytes;
+        stats.m_Budget = m_Budget;
+        stats.m_Evicted = m_Evicted;
+        return stats;
+    }
+
+    void AssemblyStore::Flush()
+    {
+        std::lock_guard lock(m_Mutex);
+        if (m_Index)
+        {
+            m_Index->Flush();
+        }
+    }
+}
\ No newline at end of file
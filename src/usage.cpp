@@ -0,0 +1,261 @@
+#include <cse/usage.hpp>
+#include <cse/log.hpp>
+#include <algorithm>
+#include <cstring>
+#include <string_view>
+
+namespace cse
+{
+    // names differ between Mono versions, the first one found is used
+    static constexpr std::string_view METHODS_COUNTERS[] = { "Compiled methods", "Methods JITted using mono JIT" };
+    static constexpr std::string_view JIT_TIME_COUNTERS[] = { "Total time spent JITting", "Total time spent JITting (sec)", "JIT time" };
+
+    // MONO_COUNTER_TIME unit, longs with it count 100ns ticks
+    static constexpr int MONO_COUNTER_UNIT_MASK = 0xf << 24;
+    static constexpr int MONO_COUNTER_TIME = 2 << 24;
+
+    static std::optional<double> SampleNumber(MonoCounter* counter, bool time)
+    {
+        static auto& methods = MonoMethods::GetInstance();
+
+        if (!counter)
+        {
+            return std::nullopt;
+        }
+
+        uint8_t buffer[16] = {};
+        if (methods.counters_sample(counter, buffer, sizeof(buffer)) <= 0)
+        {
+            return std::nullopt;
+        }
+
+        int type = methods.counter_get_type(counter);
+        switch (type & MONO_COUNTER_TYPE_MASK)
+        {
+        case MONO_COUNTER_INT:
+        {
+            int32_t value;
+            std::memcpy(&value, buffer, sizeof(value));
+            return value;
+        }
+        case MONO_COUNTER_UINT:
+        {
+            uint32_t value;
+            std::memcpy(&value, buffer, sizeof(value));
+            return value;
+        }
+        case MONO_COUNTER_WORD:
+        case MONO_COUNTER_LONG:
+        case MONO_COUNTER_ULONG:
+        {
+            int64_t value;
+            std::memcpy(&value, buffer, sizeof(value));
+            if (time && (type & MONO_COUNTER_UNIT_MASK) == MONO_COUNTER_TIME)
+            {
+                return value / 10000.0;
+            }
+
+            return static_cast<double>(value);
+        }
+        case MONO_COUNTER_DOUBLE:
+        {
+            double value;
+            std::memcpy(&value, buffer, sizeof(value));
+
+            // only ever seconds for time counters
+            return time ? value * 1000.0 : value;
+        }
+        case MONO_COUNTER_TIME_INTERVAL:
+        {
+            int64_t value;
+            std::memcpy(&value, buffer, sizeof(value));
+            return value / 1000.0;
+        }
+        default:
+            return std::nullopt;
+        }
+    }
+
+    UsageTracker& UsageTracker::GetInstance()
+    {
+        static UsageTracker instance;
+        return instance;
+    }
+
+    void UsageTracker::ResolveCounters()
+    {
+        static auto& methods = MonoMethods::GetInstance();
+
+        if (!methods.supports(MonoFeature::Counters))
+        {
+            log_warn("[Usage] The runtime has no counters API, JIT deltas are reported as -1");
+            return;
+        }
+
+        methods.counters_foreach([](MonoCounter* counter, void* user) -> int
+        {
+            auto* self = static_cast<UsageTracker*>(user);
+            const char* name = MonoMethods::GetInstance().counter_get_name(counter);
+            if (!name)
+            {
+                return 1;
+            }
+
+            if (!self->m_MethodsCounter && std::ranges::find(METHODS_COUNTERS, std::string_view(name)) != std::end(METHODS_COUNTERS))
+            {
+                self->m_MethodsCounter = counter;
+            }
+
+            if (!self->m_JitTimeCounter && std::ranges::find(JIT_TIME_COUNTERS, std::string_view(name)) != std::end(JIT_TIME_COUNTERS))
+            {
+                self->m_JitTimeCounter = counter;
+            }
+
+            return 1;
+        }, this);
+
+        if (!m_MethodsCounter || !m_JitTimeCounter)
+        {
+            log_warn("[Usage] JIT counters not found (methods: %d, time: %d), their deltas are reported as -1",
+                m_MethodsCounter != nullptr, m_JitTimeCounter != nullptr);
+        }
+    }
+
+    RuntimeSample UsageTracker::Sample()
+    {
+        static auto& methods = MonoMethods::GetInstance();
+        static const int maxGeneration = methods.gc_max_generation();
+
+        std::call_once(m_CountersResolved, [this]() { ResolveCounters(); });
+
+        RuntimeSample sample;
+        sample.m_HeapUsed = methods.gc_get_used_size();
+        sample.m_HeapSize = methods.gc_get_heap_size();
+        sample.m_MinorCollections = methods.gc_collection_count(0);
+        sample.m_MajorCollections = maxGeneration > 0 ? methods.gc_collection_count(maxGeneration) : 0;
+
+        if (auto value = SampleNumber(m_MethodsCounter, false))
+        {
+            sample.m_MethodsCompiled = static_cast<int64_t>(*value);
+        }
+
+        if (auto value = SampleNumber(m_JitTimeCounter, true))
+        {
+            sample.m_JitMs = *value;
+        }
+
+        return sample;
+    }
+
+    UsageWindow UsageTracker::Begin()
+    {
+        UsageWindow window;
+        window.m_Overlapped = m_InFlight.fetch_add(1) > 0;
+        window.m_Begun = m_Begun.fetch_add(1) + 1;
+        window.m_Before = Sample();
+        return window;
+    }
+
+    void UsageTracker::Record(uint64_t execution, const std::string& resource, const std::string& assembly, bool success,
+        const UsageWindow& window, const RuntimeSample& after, double elapsedMs)
+    {
+        m_InFlight.fetch_sub(1);
+
+        const auto& before = window.m_Before;
+
+        ExecutionUsage usage;
+        usage.m_Execution = execution;
+        usage.m_Resource = resource;
+        usage.m_Assembly = assembly;
+        usage.m_Success = success;
+        usage.m_HeapDelta = after.m_HeapUsed - before.m_HeapUsed;
+        usage.m_HeapAfter = after.m_HeapUsed;
+        usage.m_MinorCollections = after.m_MinorCollections - before.m_MinorCollections;
+        usage.m_MajorCollections = after.m_MajorCollections - before.m_MajorCollections;
+        usage.m_ElapsedMs = elapsedMs;
+        // overlapping if one was running when this began or one began since
+        usage.m_Shared = window.m_Overlapped || m_Begun.load() != window.m_Begun;
+
+        if (before.m_MethodsCompiled >= 0 && after.m_MethodsCompiled >= 0)
+        {
+            usage.m_MethodsCompiled = after.m_MethodsCompiled - before.m_MethodsCompiled;
+        }
+
+        if (before.m_JitMs >= 0 && after.m_JitMs >= 0)
+        {
+            usage.m_JitMs = after.m_JitMs - before.m_JitMs;
+        }
+
+        log_debug("[Usage] Execution %llu in %s: heap %+lld bytes, %lld methods compiled%s",
+            (unsigned long long)execution, resource, (long long)usage.m_HeapDelta, (long long)usage.m_MethodsCompiled, usage.m_Shared ? " (shared)" : "");
+
+        std::lock_guard lock(m_Mutex);
+
+        auto& total = m_Resources[resource];
+        total.m_Resource = resource;
+        total.m_Executions++;
+        total.m_HeapDelta += usage.m_HeapDelta;
+        total.m_PeakHeapDelta = std::max(total.m_PeakHeapDelta, usage.m_HeapDelta);
+        total.m_MinorCollections += usage.m_MinorCollections;
+        total.m_MajorCollections += usage.m_MajorCollections;
+        total.m_MethodsCompiled += std::max<int64_t>(usage.m_MethodsCompiled, 0);
+        total.m_JitMs += std::max(usage.m_JitMs, 0.0);
+        total.m_ElapsedMs += usage.m_ElapsedMs;
+        total.m_SharedExecutions += usage.m_Shared ? 1 : 0;
+
+        m_Executions.push_back(std::move(usage));
+        if (m_Executions.size() > MAX_EXECUTIONS)
+        {
+            m_Executions.pop_front();
+        }
+    }
+
+    std::optional<ExecutionUsage> UsageTracker::Find(uint64_t execution)
+    {
+        std::lock_guard lock(m_Mutex);
+
+        // recent executions are looked up right after they finish, search from the back
+        for (auto it = m_Executions.rbegin(); it != m_Executions.rend(); ++it)
+        {
+            if (it->m_Execution == execution)
+            {
+                return *it;
+            }
+        }
+
+        return std::nullopt;
+    }
+
+    std::vector<ExecutionUsage> UsageTracker::GetExecutions(uint64_t since)
+    {
+        std::lock_guard lock(m_Mutex);
+
+        std::vector<ExecutionUsage> result;
+        for (const auto& usage : m_Executions)
+        {
+            if (usage.m_Execution > since)
+            {
+                result.push_back(usage);
+            }
+        }
+
+        // concurrent loads can finish out of order
+        std::ranges::sort(result, {}, &ExecutionUsage::m_Execution);
+        return result;
+    }
+
+    std::vector<ResourceUsage> UsageTracker::GetResources()
+    {
+        std::lock_guard lock(m_Mutex);
+
+        std::vector<ResourceUsage> result;
+        result.reserve(m_Resources.size());
+        for (const auto& [resource, usage] : m_Resources)
+        {
+            result.push_back(usage);
+        }
+
+        std::ranges::sort(result, {}, &ResourceUsage::m_Resource);
+        return result;
+    }
+}
\ No newline at end of file
@@ -0,0 +1,75 @@
+#include <cse/utf8.hpp>
+
+namespace cse
+{
+    namespace
+    {
+        // code point starting at text[i], advances i past a surrogate pair
+        uint32_t Decode(std::span<const uint16_t> text, size_t& i)
+        {
+            uint32_t c = text[i];
+            if (c >= 0xD800 && c <= 0xDBFF && i + 1 < text.size() && text[i + 1] >= 0xDC00 && text[i + 1] <= 0xDFFF)
+            {
+                return 0x10000 + ((c - 0xD800) << 10) + (text[++i] - 0xDC00);
+            }
+
+            if (c >= 0xD800 && c <= 0xDFFF)
+            {
+                return 0xFFFD;
+            }
+
+            return c;
+        }
+    }
+
+    size_t Utf8Length(std::span<const uint16_t> text)
+    {
+        size_t bytes = 0;
+        for (size_t i = 0; i < text.size(); ++i)
+        {
+            uint32_t c = Decode(text, i);
+            bytes += c < 0x80 ? 1 : c < 0x800 ? 2 : c < 0x10000 ? 3 : 4;
+        }
+
+        return bytes;
+    }
+
+    uint8_t* EncodeUtf8(std::span<const uint16_t> text, uint8_t* out)
+    {
+        for (size_t i = 0; i < text.size(); ++i)
+        {
+            uint32_t c = Decode(text, i);
+            if (c < 0x80)
+            {
+                *out++ = static_cast<uint8_t>(c);
+            }
+            else if (c < 0x800)
+            {
+                *out++ = static_cast<uint8_t>(0xC0 | (c >> 6));
+                *out++ = static_cast<uint8_t>(0x80 | (c & 0x3F));
+            }
+            else if (c < 0x10000)
+            {
+                *out++ = static_cast<uint8_t>(0xE0 | (c >> 12));
+                *out++ = static_cast<uint8_t>(0x80 | ((c >> 6) & 0x3F));
+                *out++ = static_cast<uint8_t>(0x80 | (c & 0x3F));
+            }
+            else
+            {
+                *out++ = static_cast<uint8_t>(0xF0 | (c >> 18));
+                *out++ = static_cast<uint8_t>(0x80 | ((c >> 12) & 0x3F));
+                *out++ = static_cast<uint8_t>(0x80 | ((c >> 6) & 0x3F));
+                *out++ = static_cast<uint8_t>(0x80 | (c & 0x3F));
+            }
+        }
+
+        return out;
+    }
+
+    void AppendUtf8(std::string& out, std::span<const uint16_t> text)
+    {
+        size_t offset = out.size();
+        out.resize(offset + Utf8Length(text));
+        EncodeUtf8(text, reinterpret_cast<uint8_t*>(out.data() + offset));
+    }
+}
\ No newline at end of file
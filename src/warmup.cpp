@@ -0,0 +1,224 @@
+#include <cse/warmup.hpp>
+#include <cse/executor.hpp>
+#include <cse/managed_method.hpp>
+#include <cse/scheduler.hpp>
+#include <cse/log.hpp>
+#include <unordered_set>
+#include <algorithm>
+#include <cstring>
+
+namespace cse
+{
+    // methods compiled between checks that the domain is still loaded
+    static constexpr size_t BATCH_SIZE = 64;
+
+    // the resource may have been restarted (and its domain unloaded) while queued or while compiling
+    static bool IsRuntimeAlive(MonoDomain* domain, int32_t id)
+    {
+        auto runtimes = Executor::GetInstance().GetRuntimes();
+        return std::any_of(runtimes.begin(), runtimes.end(), [&](const RuntimeInfo& runtime)
+        {
+            return runtime.m_Domain == domain && runtime.m_DomainId == id;
+        });
+    }
+
+    // open generics can only be compiled per instantiation, that includes every member of a type nested in a generic one
+    static bool IsInOpenGenericType(MonoClass* klass)
+    {
+        static auto& methods = MonoMethods::GetInstance();
+
+        for (; klass; klass = methods.class_get_nesting_type(klass))
+        {
+            if (std::strchr(methods.class_get_name(klass), '`'))
+            {
+                return true;
+            }
+        }
+
+        return false;
+    }
+
+    JitWarmup& JitWarmup::GetInstance()
+    {
+        static JitWarmup instance;
+        return instance;
+    }
+
+    void JitWarmup::SetOptions(WarmupOptions options)
+    {
+        std::lock_guard lock(m_Mutex);
+        m_Options = std::move(options);
+    }
+
+    WarmupOptions JitWarmup::GetOptions()
+    {
+        std::lock_guard lock(m_Mutex);
+        return m_Options;
+    }
+
+    void JitWarmup::Schedule(MonoDomain* domain, MonoAssembly* assembly, const std::string& resource)
+    {
+        static auto& methods = MonoMethods::GetInstance();
+
+        auto options = GetOptions();
+        if (!options.m_Enabled || !domain || !assembly)
+            return;
+
+        // generic methods can't be told apart without it, compiling an open one fails inside the JIT
+        if (!methods.supports(MonoFeature::GenericSignatures))
+        {
+            static std::once_flag warned;
+            std::call_once(warned, [] { log_warn("[Warmup] The runtime has no mono_signature_is_generic, warm-up is unavailable"); });
+            return;
+        }
+
+        MonoImage* image = methods.assembly_get_image(assembly);
+        if (!image)
+            return;
+
+        int32_t id = methods.domain_get_id(domain);
+
+        // one warm-up at a time, it competes with the game for the JIT lock
+        Scheduler::GetInstance().Submit([this, domain, id, image, resource, options = std::move(options)]
+        {
+            Run(domain, id, image, resource, options);
+        }, PriorityClass::Bulk, 0, "jit_warmup");
+    }
+
+    void JitWarmup::Run(MonoDomain* domain, int32_t domainId, MonoImage* image, const std::string& resource, const WarmupOptions& options)
+    {
+        using clock = std::chrono::steady_clock;
+        static auto& methods = MonoMethods::GetInstance();
+
+        if (!IsRuntimeAlive(domain, domainId))
+        {
+            return;
+        }
+
+        MonoScope scope(domain);
+        if (!scope.thread)
+            return;
+
+        WarmupReport report;
+        report.m_Assembly = methods.image_get_name(image) ? methods.image_get_name(image) : "";
+        report.m_Resource = resource;
+
+        int rows = methods.image_get_table_rows(image, MONO_TABLE_METHOD);
+
+        std::unordered_set<std::string> hot(options.m_HotMethods.begin(), options.m_HotMethods.end());
+        std::vector<MonoMethod*> hotMethods;
+        std::vector<MonoMethod*> otherMethods;
+
+        for (int row = 1; row <= rows; ++row)
+        {
+            MonoMethod* method = methods.get_method(image, MONO_TOKEN_METHOD_DEF | row, nullptr);
+            if (!method)
+            {
+                report.m_Failed++;
+                continue;
+            }
+
+            report.m_Methods++;
+
+            uint32_t iflags = 0;
+            uint32_t flags = methods.method_get_flags(method, &iflags);
+
+            bool nothingToCompile = (flags & (METHOD_ATTRIBUTE_ABSTRACT | METHOD_ATTRIBUTE_PINVOKE_IMPL)) ||
+                (iflags & METHOD_IMPL_ATTRIBUTE_INTERNAL_CALL) ||
+                (iflags & METHOD_IMPL_ATTRIBUTE_CODE_TYPE_MASK) == METHOD_IMPL_ATTRIBUTE_RUNTIME;
+
+            MonoClass* klass = methods.method_get_class(method);
+            MonoMethodSignature* signature = methods.method_signature(method);
+
+            if (nothingToCompile || IsInOpenGenericType(klass) || !signature || methods.signature_is_generic(signature))
+            {
+                report.m_Skipped++;
+                continue;
+            }
+
+            if (!hot.empty() && klass)
+            {
+                if (hot.contains(MethodFullName(method)))
+                {
+                    hotMethods.push_back(method);
+                    continue;
+                }
+            }
+
+            otherMethods.push_back(method);
+        }
+
+        auto start = clock::now();
+        auto deadline = start + options.m_Budget;
+
+        size_t attempted = 0;
+        bool unloaded = false;
+
+        for (auto* list : { &hotMethods, &otherMethods })
+        {
+            for (MonoMethod* method : *list)
+            {
+                if (clock::now() >= deadline)
+                {
+                    report.m_BudgetExhausted = true;
+                    break;
+                }
+
+                if (++attempted % BATCH_SIZE == 0 && !IsRuntimeAlive(domain, domainId))
+                {
+                    unloaded = true;
+                    break;
+                }
+
+                if (methods.compile_method(method))
+                {
+                    report.m_Compiled++;
+                }
+                else
+                {
+                    report.m_Failed++;
+                }
+            }
+
+            if (report.m_BudgetExhausted || unloaded)
+            {
+                break;
+            }
+        }
+
+        if (unloaded)
+        {
+            log_info("[Warmup] %s in %s: domain unloaded after %zu methods, stopped", report.m_Assembly, resource, report.m_Compiled);
+            return;
+        }
+
+        report.m_JitMs = std::chrono::duration<double, std::milli>(clock::now() - start).count();
+
+        log_info("[Warmup] %s in %s: compiled %zu/%zu methods in %.1f ms%s", report.m_Assembly, resource,
+            report.m_Compiled, report.m_Methods, report.m_JitMs, report.m_BudgetExhausted ? " (budget exhausted)" : "");
+
+        std::lock_guard lock(m_Mutex);
+        report.m_Sequence = m_NextSequence++;
+        m_Reports.push_back(std::move(report));
+        if (m_Reports.size() > MAX_REPORTS)
+        {
+            m_Reports.pop_front();
+        }
+    }
+
+    std::vector<WarmupReport> JitWarmup::GetReports(uint64_t since)
+    {
+        std::lock_guard lock(m_Mutex);
+
+        std::vector<WarmupReport> reports;
+        for (const auto& report : m_Reports)
+        {
+            if (report.m_Sequence > since)
+            {
+                reports.push_back(report);
+            }
+        }
+
+        return reports;
+    }
+}
\ No newline at end of file
@@ -0,0 +1,445 @@
+#include <cse/watchdog.hpp>
+#include <cse/entry.hpp>
+#include <cse/log.hpp>
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace cse
+{
+    using clock = std::chrono::steady_clock;
+
+    static thread_local std::optional<std::chrono::milliseconds> s_Deadline;
+
+    const char* ExecutionOutcomeName(ExecutionOutcome outcome)
+    {
+        switch (outcome)
+        {
+        case ExecutionOutcome::Completed: return "completed";
+        case ExecutionOutcome::Failed: return "failed";
+        case ExecutionOutcome::TimedOut: return "timed_out";
+        }
+
+        return "unknown";
+    }
+
+    namespace
+    {
+        enum class RunStage
+        {
+            Running,
+            Aborted,
+            Abandoned,
+        };
+
+        // one execution, shared by the caller, its runner and the watchdog
+        struct RunState
+        {
+            uint64_t m_Execution = 0;
+            clock::time_point m_Deadline;
+
+            MonoDomain* m_Domain = nullptr;
+            std::function<void()> m_Task;
+
+            // held around aborting and around the runner publishing or withdrawing its thread,
+            // so an abort never reaches a runner that already detached
+            std::mutex m_Gate;
+            MonoThread* m_Thread = nullptr;
+
+            std::atomic<RunStage> m_Stage = RunStage::Running;
+
+            // guarded by the watchdog mutex
+            bool m_Finished = false;
+        };
+
+        struct Runner
+        {
+            std::mutex m_Mutex;
+            std::condition_variable m_Wake;
+            std::shared_ptr<RunState> m_Run;
+            bool m_Exit = false;
+
+            // set by the runner once it will never touch the watchdog again
+            bool m_Done = false;
+            std::thread m_Thread;
+        };
+    }
+
+    struct ExecutionWatchdog::Impl
+    {
+        // idle runners kept around, more are started on demand and exit once idle
+        static constexpr size_t MAX_IDLE_RUNNERS = 4;
+
+        // one lock for options, runs, runners and stats, none of it is held while scripts run
+        std::mutex m_Mutex;
+        std::condition_variable m_Changed;
+        std::condition_variable m_RunDone;
+
+        WatchdogOptions m_Options;
+        WatchdogStats m_Stats;
+
+        std::vector<std::shared_ptr<RunState>> m_Runs;
+        std::vector<std::shared_ptr<Runner>> m_Idle;
+
+        // every runner started, joined once done, Shutdown joins the rest
+        std::vector<std::shared_ptr<Runner>> m_Runners;
+
+        std::thread m_Watchdog;
+        bool m_Stop = false;
+
+        Impl()
+        {
+            m_Watchdog = std::thread([this]() { WatchLoop(); });
+        }
+
+        void RunnerLoop(std::shared_ptr<Runner> runner)
+        {
+            static auto& methods = MonoMethods::GetInstance();
+
+            for (;;)
+            {
+                std::shared_ptr<RunState> run;
+                {
+                    std::unique_lock lock(runner->m_Mutex);
+                    runner->m_Wake.wait(lock, [&]() { return runner->m_Run || runner->m_Exit; });
+                    if (!runner->m_Run)
+                    {
+                        break;
+                    }
+
+                    run = std::move(runner->m_Run);
+                }
+
+                {
+                    MonoScope scope(run->m_Domain);
+
+                    // the deadline may already have passed while this runner was starting
+                    bool started = false;
+                    {
+                        std::lock_guard gate(run->m_Gate);
+                        if (run->m_Stage == RunStage::Running)
+                        {
+                            run->m_Thread = methods.thread_current();
+                            started = true;
+                        }
+                    }
+
+                    if (started)
+                    {
+                        run->m_Task();
+                    }
+
+                    std::lock_guard gate(run->m_Gate);
+                    run->m_Thread = nullptr;
+                }
+
+                std::lock_guard lock(m_Mutex);
+                run->m_Finished = true;
+                run->m_Task = nullptr;
+                std::erase(m_Runs, run);
+
+                // a runner that saw an abort may still carry its state, it isn't trusted with another script
+                bool retire = run->m_Stage != RunStage::Running || clock::now() > run->m_Deadline;
+                if (run->m_Stage == RunStage::Aborted)
+                {
+                    m_Stats.m_Aborted++;
+                }
+                else if (run->m_Stage == RunStage::Abandoned)
+                {
+                    m_Stats.m_Stuck--;
+                    log_warn("[Watchdog] Abandoned execution %llu returned after all", (unsigned long long)run->m_Execution);
+                }
+
+                m_RunDone.notify_all();
+                m_Changed.notify_all();
+
+                if (retire || m_Stop || m_Idle.size() >= MAX_IDLE_RUNNERS)
+                {
+                    break;
+                }
+
+                m_Idle.push_back(runner);
+            }
+
+            std::lock_guard lock(m_Mutex);
+            runner->m_Done = true;
+            m_RunDone.notify_all();
+        }
+
+        // requires m_Mutex, a thread can't join itself so the runner's own exit leaves its handle to the next start or Shutdown
+        void ReapRunners()
+        {
+            std::erase_if(m_Runners, [](const std::shared_ptr<Runner>& runner)
+            {
+                if (!runner->m_Done)
+                {
+                    return false;
+                }
+
+                if (runner->m_Thread.joinable())
+                {
+                    runner->m_Thread.join();
+                }
+
+                return true;
+            });
+        }
+
+        void WatchLoop()
+        {
+            static auto& methods = MonoMethods::GetInstance();
+
+            std::unique_lock lock(m_Mutex);
+            while (!m_Stop)
+            {
+                auto now = clock::now();
+                auto wake = clock::time_point::max();
+
+                for (auto& run : m_Runs)
+                {
+                    if (run->m_Finished)
+                    {
+                        continue;
+                    }
+
+                    if (run->m_Stage == RunStage::Running && now >= run->m_Deadline)
+                    {
+                        log_warn("[Watchdog] Execution %llu passed its deadline, %s", (unsigned long long)run->m_Execution,
+                            methods.supports(MonoFeature::ThreadAbort) ? "aborting" : "the runtime can't abort it");
+
+                        auto target = run;
+                        lock.unlock();
+                        {
+                            std::lock_guard gate(target->m_Gate);
+                            target->m_Stage = RunStage::Aborted;
+
+                            // Thread.Abort, raised at the script's next safepoint and unwinds back into the runner.
+                            // Without mono_thread_stop the run can only be abandoned once the grace period is over
+                            if (target->m_Thread && methods.supports(MonoFeature::ThreadAbort))
+                            {
+                                MonoScope scope;
+                                methods.thread_stop(target->m_Thread);
+                            }
+                        }
+                        lock.lock();
+
+                        // the list may have changed while unlocked
+                        wake = now;
+                        break;
+                    }
+
+                    if (run->m_Stage == RunStage::Aborted && now >= run->m_Deadline + m_Options.m_Grace)
+                    {
+                        // blocked in native code or swallowing the abort, nothing short of killing the process gets it back
+                        log_error("[Watchdog] Execution %llu ignored the abort, abandoning its runner", (unsigned long long)run->m_Execution);
+                        run->m_Stage = RunStage::Abandoned;
+                        m_Stats.m_Abandoned++;
+                        m_Stats.m_Stuck++;
+                        continue;
+                    }
+
+                    if (run->m_Stage == RunStage::Running)
+                    {
+                        wake = std::min(wake, run->m_Deadline);
+                    }
+                    else if (run->m_Stage == RunStage::Aborted)
+                    {
+                        wake = std::min(wake, run->m_Deadline + m_Options.m_Grace);
+                    }
+                }
+
+                if (wake == now)
+                {
+                    continue;
+                }
+
+                if (wake == clock::time_point::max())
+                {
+                    m_Changed.wait(lock);
+                }
+                else
+                {
+                    m_Changed.wait_until(lock, wake);
+                }
+            }
+        }
+
+        std::shared_ptr<Runner> AcquireRunner()
+        {
+            if (!m_Idle.empty())
+            {
+                auto runner = std::move(m_Idle.back());
+                m_Idle.pop_back();
+                return runner;
+            }
+
+            ReapRunners();
+
+            auto runner = std::make_shared<Runner>();
+            runner->m_Thread = std::thread([this, runner]() { RunnerLoop(runner); });
+            m_Runners.push_back(runner);
+            return runner;
+        }
+    };
+
+    ExecutionWatchdog& ExecutionWatchdog::GetInstance()
+    {
+        static ExecutionWatchdog instance;
+        return instance;
+    }
+
+    ExecutionWatchdog::ExecutionWatchdog()
+        : m_Impl(std::make_unique<Impl>())
+    {
+    }
+
+    ExecutionWatchdog::~ExecutionWatchdog()
+    {
+        Shutdown();
+    }
+
+    void ExecutionWatchdog::SetOptions(WatchdogOptions options)
+    {
+        std::lock_guard lock(m_Impl->m_Mutex);
+        m_Impl->m_Options = options;
+        m_Impl->m_Changed.notify_all();
+    }
+
+    WatchdogOptions ExecutionWatchdog::GetOptions()
+    {
+        std::lock_guard lock(m_Impl->m_Mutex);
+        return m_Impl->m_Options;
+    }
+
+    WatchdogStats ExecutionWatchdog::GetStats()
+    {
+        std::lock_guard lock(m_Impl->m_Mutex);
+
+        auto stats = m_Impl->m_Stats;
+        stats.m_IdleRunners = m_Impl->m_Idle.size();
+        return stats;
+    }
+
+    ExecutionOutcome ExecutionWatchdog::Run(MonoDomain* domain, uint64_t execution, std::function<void()> task, std::optional<std::chrono::milliseconds> deadline)
+    {
+        auto& impl = *m_Impl;
+
+        std::unique_lock lock(impl.m_Mutex);
+        auto limit = deadline.value_or(DeadlineScope::Current().value_or(impl.m_Options.m_Deadline));
+        impl.m_Stats.m_Runs++;
+
+        if (limit.count() <= 0 || impl.m_Stop)
+        {
+            lock.unlock();
+            task();
+            return ExecutionOutcome::Completed;
+        }
+
+        auto run = std::make_shared<RunState>();
+        run->m_Execution = execution;
+        run->m_Deadline = clock::now() + limit;
+        run->m_Domain = domain;
+        run->m_Task = std::move(task);
+        impl.m_Runs.push_back(run);
+
+        auto runner = impl.AcquireRunner();
+        {
+            std::lock_guard runnerLock(runner->m_Mutex);
+            runner->m_Run = run;
+        }
+
+        runner->m_Wake.notify_one();
+        impl.m_Changed.notify_all();
+
+        if (impl.m_RunDone.wait_until(lock, run->m_Deadline, [&]() { return run->m_Finished; }))
+        {
+            return ExecutionOutcome::Completed;
+        }
+
+        impl.m_Stats.m_TimedOut++;
+        log_warn("[Watchdog] Execution %llu timed out after %lld ms", (unsigned long long)execution, (long long)limit.count());
+        return ExecutionOutcome::TimedOut;
+    }
+
+    void ExecutionWatchdog::Shutdown()
+    {
+        auto& impl = *m_Impl;
+
+        std::unique_lock lock(impl.m_Mutex);
+        if (impl.m_Stop)
+        {
+            return;
+        }
+
+        impl.m_Stop = true;
+        for (auto& runner : impl.m_Idle)
+        {
+            std::lock_guard runnerLock(runner->m_Mutex);
+            runner->m_Exit = true;
+            runner->m_Wake.notify_one();
+        }
+
+        impl.m_Idle.clear();
+        impl.m_Changed.notify_all();
+        lock.unlock();
+
+        if (impl.m_Watchdog.joinable())
+        {
+            impl.m_Watchdog.join();
+        }
+
+        // idle runners exit right away and busy ones once their run returns, a stuck one never does
+        lock.lock();
+        impl.m_RunDone.wait_for(lock, impl.m_Options.m_Grace, [&]()
+        {
+            return std::all_of(impl.m_Runners.begin(), impl.m_Runners.end(), [](const auto& runner) { return runner->m_Done; });
+        });
+
+        std::vector<std::shared_ptr<Runner>> runners;
+        runners.swap(impl.m_Runners);
+        lock.unlock();
+
+        bool stuck = false;
+        for (auto& runner : runners)
+        {
+            if (runner->m_Done)
+            {
+                runner->m_Thread.join();
+            }
+            else
+            {
+                // still inside a script, its code (and ours it returns into) has to stay mapped
+                runner->m_Thread.detach();
+                stuck = true;
+            }
+        }
+
+        if (stuck)
+        {
+            log_error("[Watchdog] Runners still inside scripts at shutdown, keeping the module loaded");
+            pin_module("watchdog runners are stuck in scripts");
+        }
+    }
+
+    ExecutionWatchdog::DeadlineScope::DeadlineScope(std::optional<std::chrono::milliseconds> deadline)
+        : m_Previous(s_Deadline)
+    {
+        if (deadline.has_value())
+        {
+            s_Deadline = deadline;
+        }
+    }
+
+    ExecutionWatchdog::DeadlineScope::~DeadlineScope()
+    {
+        s_Deadline = m_Previous;
+    }
+
+    std::optional<std::chrono::milliseconds> ExecutionWatchdog::DeadlineScope::Current()
+    {
+        return s_Deadline;
+    }
+}
\ No newline at end of file
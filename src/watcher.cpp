@@ -0,0 +1,458 @@
+#include <cse/watcher.hpp>
+#include <cse/commands.hpp>
+#include <cse/console.hpp>
+#include <cse/log.hpp>
+#include <cse/wildcard.hpp>
+#include <windows.h>
+#include <filesystem>
+#include <fstream>
+#include <atomic>
+#include <mutex>
+#include <thread>
+#include <deque>
+#include <map>
+#include <unordered_map>
+#include <algorithm>
+#include <cwctype>
+
+namespace cse
+{
+    static std::string PathToUtf8(const std::filesystem::path& path)
+    {
+        auto text = path.u8string();
+        return std::string(reinterpret_cast<const char*>(text.data()), text.size());
+    }
+
+    static std::filesystem::path PathFromUtf8(const std::string& text)
+    {
+        return std::filesystem::path(std::u8string(reinterpret_cast<const char8_t*>(text.data()), text.size()));
+    }
+
+    struct ScriptWatcher::Impl
+    {
+        using clock = std::chrono::steady_clock;
+
+        static constexpr size_t MAX_RESULTS = 64;
+
+        // a file still locked by the build gets this many debounce periods before it is reported as failed
+        static constexpr uint32_t MAX_READ_RETRIES = 10;
+
+        struct Watch
+        {
+            uint64_t m_Id;
+            WatchRule m_Rule;
+            std::filesystem::path m_Root;
+            std::wstring m_Pattern;
+
+            HANDLE m_Directory = INVALID_HANDLE_VALUE;
+            HANDLE m_Stop = nullptr;
+            std::thread m_Thread;
+
+            std::atomic<uint64_t> m_Changes{ 0 };
+            std::atomic<uint64_t> m_Executions{ 0 };
+            std::atomic<uint64_t> m_Skipped{ 0 };
+
+            // set by the watch thread when it gave up, 0 while it is watching
+            std::atomic<uint32_t> m_Error{ 0 };
+
+            // watch thread only, keyed by absolute path
+            std::map<std::wstring, clock::time_point> m_Pending;
+            std::unordered_map<std::wstring, Hash256> m_Hashes;
+            std::unordered_map<std::wstring, uint32_t> m_Retries;
+        };
+
+        std::mutex m_Mutex;
+        std::map<uint64_t, std::unique_ptr<Watch>> m_Watches;
+        std::deque<WatchResult> m_Results;
+        uint64_t m_NextId = 1;
+        uint64_t m_NextSequence = 1;
+
+        ~Impl()
+        {
+            for (auto& [id, watch] : m_Watches)
+            {
+                if (watch->m_Thread.joinable())
+                {
+                    watch->m_Thread.detach();
+                }
+            }
+        }
+
+        void Report(Watch& watch, const std::wstring& path, const Hash256& hash, bool success, std::string error, double elapsedMs)
+        {
+            WatchResult result;
+            result.m_RuleId = watch.m_Id;
+            result.m_Path = PathToUtf8(path);
+            result.m_Resource = watch.m_Rule.m_Resource;
+            result.m_Hash = hash;
+            result.m_Success = success;
+            result.m_Error = std::move(error);
+            result.m_ElapsedMs = elapsedMs;
+
+            if (success)
+            {
+                log_info("[Watcher] Reloaded %s in %s (%.1f ms)", result.m_Path, result.m_Resource, elapsedMs);
+            }
+            else
+            {
+                log_warn("[Watcher] Reloading %s in %s failed: %s", result.m_Path, result.m_Resource, result.m_Error);
+            }
+
+            std::lock_guard lock(m_Mutex);
+            result.m_Sequence = m_NextSequence++;
+            m_Results.push_back(std::move(result));
+            if (m_Results.size() > MAX_RESULTS)
+            {
+                m_Results.pop_front();
+            }
+        }
+
+        void Process(Watch& watch, const std::wstring& path)
+        {
+            static auto& registry = CommandRegistry::GetInstance();
+
+            auto start = clock::now();
+
+            std::vector<uint8_t> bytes;
+            {
+                std::ifstream file(std::filesystem::path(path), std::ios::binary);
+                if (file)
+                {
+                    bytes.assign(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+                }
+            }
+
+            if (bytes.empty())
+            {
+                // deleted, or still being written by the compiler
+                std::error_code ec;
+                if (!std::filesystem::exists(std::filesystem::path(path), ec))
+                {
+                    watch.m_Hashes.erase(path);
+                    watch.m_Retries.erase(path);
+                    return;
+                }
+
+                if (++watch.m_Retries[path] < MAX_READ_RETRIES)
+                {
+                    watch.m_Pending[path] = clock::now() + watch.m_Rule.m_Debounce;
+                    return;
+                }
+
+                watch.m_Retries.erase(path);
+                Report(watch, path, {}, false, "failed to read file", 0);
+                return;
+            }
+
+            watch.m_Retries.erase(path);
+
+            auto hash = Sha256::Of(bytes);
+            auto known = watch.m_Hashes.find(path);
+            if (known != watch.m_Hashes.end() && known->second == hash)
+            {
+                // touched or rewritten with identical output
+                watch.m_Skipped++;
+                log_debug("[Watcher] %s unchanged, skipping", PathToUtf8(path));
+                return;
+            }
+
+            nlohmann::json request = {
+                { "cmd", "execute_in_resource" },
+                { "resource", watch.m_Rule.m_Resource },
+                { "script", nlohmann::json::binary(std::move(bytes)) },
+            };
+
+            std::filesystem::path pdbPath(path);
+            pdbPath.replace_extension(L".pdb");
+
+            std::error_code ec;
+            if (std::filesystem::is_regular_file(pdbPath, ec))
+            {
+                std::ifstream pdbFile(pdbPath, std::ios::binary);
+                std::vector<uint8_t> pdb((std::istreambuf_iterator<char>(pdbFile)), std::istreambuf_iterator<char>());
+                if (!pdb.empty())
+                {
+                    request["pdb"] = nlohmann::json::binary(std::move(pdb));
+                }
+            }
+
+            watch.m_Executions++;
+            auto response = registry.Dispatch(request);
+
+            double elapsedMs = std::chrono::duration<double, std::milli>(clock::now() - start).count();
+
+            bool success = response.value("success", false);
+            if (success)
+            {
+                watch.m_Hashes[path] = hash;
+            }
+            else
+            {
+                // retry on the next save even if the bytes are the same, e.g. the resource wasn't running yet
+                watch.m_Hashes.erase(path);
+            }
+
+            Report(watch, path, hash, success, success ? std::string() : response.value("error", std::string("execution failed")), elapsedMs);
+        }
+
+        void RunDue(Watch& watch)
+        {
+            auto now = clock::now();
+
+            std::vector<std::wstring> due;
+            for (auto it = watch.m_Pending.begin(); it != watch.m_Pending.end();)
+            {
+                if (it->second <= now)
+                {
+                    due.push_back(it->first);
+                    it = watch.m_Pending.erase(it);
+                }
+                else
+                {
+                    ++it;
+                }
+            }
+
+            for (const auto& path : due)
+            {
+                Process(watch, path);
+            }
+        }
+
+        void Queue(Watch& watch, std::wstring_view relative)
+        {
+            std::filesystem::path path = watch.m_Root / std::filesystem::path(relative);
+            // case insensitive like the file system
+            auto fold = [](wchar_t a, wchar_t b) { return std::towlower(a) == std::towlower(b); };
+            if (!MatchWildcard<wchar_t>(watch.m_Pattern, path.filename().wstring(), fold))
+                return;
+
+            // every further change restarts the debounce, a build writing the file in chunks triggers one run
+            watch.m_Pending[path.wstring()] = clock::now() + watch.m_Rule.m_Debounce;
+            watch.m_Changes++;
+        }
+
+        void WatchThread(Watch& watch)
+        {
+            alignas(DWORD) static thread_local uint8_t buffer[64 * 1024];
+
+            OVERLAPPED overlapped{};
+            overlapped.hEvent = CreateEventW(nullptr, TRUE, FALSE, nullptr);
+
+            constexpr DWORD filter = FILE_NOTIFY_CHANGE_FILE_NAME | FILE_NOTIFY_CHANGE_LAST_WRITE | FILE_NOTIFY_CHANGE_SIZE;
+
+            bool pending = false;
+            while (true)
+            {
+                if (!pending)
+                {
+                    ResetEvent(overlapped.hEvent);
+                    if (!ReadDirectoryChangesW(watch.m_Directory, buffer, sizeof(buffer), watch.m_Rule.m_Recursive, filter, nullptr, &overlapped, nullptr))
+                    {
+                        watch.m_Error = GetLastError();
+                        log_error("[Watcher] Failed to watch %s. Error: %x", watch.m_Rule.m_Directory, watch.m_Error.load());
+                        break;
+                    }
+
+                    pending = true;
+                }
+
+                DWORD timeout = INFINITE;
+                if (!watch.m_Pending.empty())
+                {
+                    auto next = std::min_element(watch.m_Pending.begin(), watch.m_Pending.end(), [](const auto& a, const auto& b) { return a.second < b.second; })->second;
+                    auto wait = std::chrono::duration_cast<std::chrono::milliseconds>(next - clock::now()).count();
+                    timeout = static_cast<DWORD>(std::max<long long>(wait, 0));
+                }
+
+                HANDLE handles[] = { watch.m_Stop, overlapped.hEvent };
+                DWORD result = WaitForMultipleObjects(2, handles, FALSE, timeout);
+
+                if (result == WAIT_OBJECT_0)
+                {
+                    break;
+                }
+
+                if (result == WAIT_OBJECT_0 + 1)
+                {
+                    pending = false;
+
+                    DWORD bytes = 0;
+                    if (!GetOverlappedResult(watch.m_Directory, &overlapped, &bytes, FALSE))
+                    {
+                        watch.m_Error = GetLastError();
+                        log_error("[Watcher] Watch on %s failed. Error: %x", watch.m_Rule.m_Directory, watch.m_Error.load());
+                        break;
+                    }
+
+                    if (bytes == 0)
+                    {
+                        // the notification buffer overflowed, recheck every file seen so far
+                        for (const auto& [path, hash] : watch.m_Hashes)
+                        {
+                            watch.m_Pending[path] = clock::now() + watch.m_Rule.m_Debounce;
+                        }
+                    }
+
+                    for (size_t offset = 0; bytes != 0;)
+                    {
+                        const auto* info = reinterpret_cast<const FILE_NOTIFY_INFORMATION*>(buffer + offset);
+
+                        if (info->Action == FILE_ACTION_ADDED || info->Action == FILE_ACTION_MODIFIED || info->Action == FILE_ACTION_RENAMED_NEW_NAME)
+                        {
+                            Queue(watch, std::wstring_view(info->FileName, info->FileNameLength / sizeof(WCHAR)));
+                        }
+
+                        if (info->NextEntryOffset == 0)
+                            break;
+
+                        offset += info->NextEntryOffset;
+                    }
+                }
+                else if (result == WAIT_FAILED)
+                {
+                    watch.m_Error = GetLastError();
+                    log_error("[Watcher] Wait failed. Error: %x", watch.m_Error.load());
+                    break;
+                }
+
+                RunDue(watch);
+            }
+
+            if (pending)
+            {
+                DWORD bytes = 0;
+                CancelIoEx(watch.m_Directory, &overlapped);
+                GetOverlappedResult(watch.m_Directory, &overlapped, &bytes, TRUE);
+            }
+
+            CloseHandle(overlapped.hEvent);
+        }
+
+        static void Stop(Watch& watch)
+        {
+            SetEvent(watch.m_Stop);
+            if (watch.m_Thread.joinable())
+            {
+                watch.m_Thread.join();
+            }
+
+            CloseHandle(watch.m_Directory);
+            CloseHandle(watch.m_Stop);
+        }
+    };
+
+    ScriptWatcher& ScriptWatcher::GetInstance()
+    {
+        static ScriptWatcher instance;
+        return instance;
+    }
+
+    ScriptWatcher::ScriptWatcher()
+        : m_Impl(std::make_unique<Impl>())
+    {
+    }
+
+    ScriptWatcher::~ScriptWatcher() = default;
+
+    uint64_t ScriptWatcher::AddRule(const WatchRule& rule)
+    {
+        auto watch = std::make_unique<Impl::Watch>();
+        watch->m_Rule = rule;
+        watch->m_Pattern = PathFromUtf8(rule.m_Pattern).wstring();
+
+        std::error_code ec;
+        watch->m_Root = std::filesystem::absolute(PathFromUtf8(rule.m_Directory), ec);
+        if (ec)
+        {
+            println("[Watcher] Invalid directory: %s", rule.m_Directory.c_str());
+            return 0;
+        }
+
+        watch->m_Directory = CreateFileW(watch->m_Root.wstring().c_str(), FILE_LIST_DIRECTORY, FILE_SHARE_READ | FILE_SHARE_WRITE | FILE_SHARE_DELETE,
+            nullptr, OPEN_EXISTING, FILE_FLAG_BACKUP_SEMANTICS | FILE_FLAG_OVERLAPPED, nullptr);
+
+        if (watch->m_Directory == INVALID_HANDLE_VALUE)
+        {
+            println("[Watcher] Failed to open directory %s. Error: %x", rule.m_Directory.c_str(), GetLastError());
+            return 0;
+        }
+
+        watch->m_Stop = CreateEventW(nullptr, TRUE, FALSE, nullptr);
+
+        // the thread is running before the watch is published, RemoveRule and Shutdown always find it joinable
+        uint64_t id;
+        {
+            std::lock_guard lock(m_Impl->m_Mutex);
+            id = watch->m_Id = m_Impl->m_NextId++;
+            watch->m_Thread = std::thread(&Impl::WatchThread, m_Impl.get(), std::ref(*watch));
+            m_Impl->m_Watches.emplace(id, std::move(watch));
+        }
+
+        log_info("[Watcher] Watching %s (%s) for %s", rule.m_Directory, rule.m_Pattern, rule.m_Resource);
+        return id;
+    }
+
+    bool ScriptWatcher::RemoveRule(uint64_t id)
+    {
+        std::unique_ptr<Impl::Watch> watch;
+        {
+            std::lock_guard lock(m_Impl->m_Mutex);
+            auto it = m_Impl->m_Watches.find(id);
+            if (it == m_Impl->m_Watches.end())
+            {
+                return false;
+            }
+
+            watch = std::move(it->second);
+            m_Impl->m_Watches.erase(it);
+        }
+
+        Impl::Stop(*watch);
+        return true;
+    }
+
+    std::vector<WatchRuleInfo> ScriptWatcher::GetRules()
+    {
+        std::lock_guard lock(m_Impl->m_Mutex);
+
+        std::vector<WatchRuleInfo> rules;
+        for (const auto& [id, watch] : m_Impl->m_Watches)
+        {
+            uint32_t error = watch->m_Error.load();
+            rules.push_back({ id, watch->m_Rule, watch->m_Changes.load(), watch->m_Executions.load(), watch->m_Skipped.load(), error != 0, error });
+        }
+
+        return rules;
+    }
+
+    std::vector<WatchResult> ScriptWatcher::GetResults(uint64_t since)
+    {
+        std::lock_guard lock(m_Impl->m_Mutex);
+
+        std::vector<WatchResult> results;
+        for (const auto& result : m_Impl->m_Results)
+        {
+            if (result.m_Sequence > since)
+            {
+                results.push_back(result);
+            }
+        }
+
+        return results;
+    }
+
+    void ScriptWatcher::Shutdown()
+    {
+        std::map<uint64_t, std::unique_ptr<Impl::Watch>> watches;
+        {
+            std::lock_guard lock(m_Impl->m_Mutex);
+            watches.swap(m_Impl->m_Watches);
+        }
+
+        for (auto& [id, watch] : watches)
+        {
+            Impl::Stop(*watch);
+        }
+    }
+}
\ No newline at end of file